@@ -4,8 +4,10 @@
 
 FLocalizedText::FLocalizedText
 (
-) : CurrentValueLanguageId()
+) : CurrentValueLanguageEpoch(0)
     , Current(FText::GetEmpty())
+    , StringPool(nullptr)
+    , StringPoolIndex(INDEX_NONE)
     , LanguageSwitcher(nullptr)
     , TextByLanguageId()
 {
@@ -14,8 +16,10 @@ FLocalizedText::FLocalizedText
 FLocalizedText::FLocalizedText
 (
 	const FLocalizedText& Other
-) : CurrentValueLanguageId(Other.CurrentValueLanguageId)
+) : CurrentValueLanguageEpoch(Other.CurrentValueLanguageEpoch)
     , Current(Other.Current)
+    , StringPool(Other.StringPool)
+    , StringPoolIndex(Other.StringPoolIndex)
     , LanguageSwitcher(Other.LanguageSwitcher)
     , TextByLanguageId(Other.TextByLanguageId)
 {
@@ -25,13 +29,57 @@ FLocalizedText::FLocalizedText
 (
 	const TMap<FString, FText>& TextByLanguageId,
 	ULanguageSwitcher* LanguageSwitcher
-) : CurrentValueLanguageId()
+) : CurrentValueLanguageEpoch(0)
     , Current(FText::GetEmpty())
+    , StringPool(nullptr)
+    , StringPoolIndex(INDEX_NONE)
     , LanguageSwitcher(LanguageSwitcher)
     , TextByLanguageId(TextByLanguageId)
 {
 }
 
+FLocalizedText::FLocalizedText
+(
+	const TSharedPtr<const FGameDataLocalizedStringPool>& StringPool,
+	const int32 StringPoolIndex,
+	ULanguageSwitcher* LanguageSwitcher
+) : CurrentValueLanguageEpoch(0)
+    , Current(FText::GetEmpty())
+    , StringPool(StringPool)
+    , StringPoolIndex(StringPoolIndex)
+    , LanguageSwitcher(LanguageSwitcher)
+    , TextByLanguageId()
+{
+}
+
+bool FLocalizedText::TryGetPooledText(const FString& LanguageId, FText& OutText) const
+{
+	// FText is created only for requested language, other languages stay as UTF-8 in pool
+	const int32 LanguageIndex = StringPool->FindLanguage(LanguageId);
+	if (!StringPool->HasText(LanguageIndex, StringPoolIndex))
+	{
+		return false;
+	}
+	OutText = StringPool->GetText(LanguageIndex, StringPoolIndex);
+	return true;
+}
+
+bool FLocalizedText::TryGetText(const FString& LanguageId, FText& OutText) const
+{
+	if (StringPool.IsValid())
+	{
+		return TryGetPooledText(LanguageId, OutText);
+	}
+
+	const FText* FoundText = TextByLanguageId.Find(LanguageId);
+	if (FoundText == nullptr || FoundText->IsEmpty())
+	{
+		return false;
+	}
+	OutText = *FoundText;
+	return true;
+}
+
 FText FLocalizedText::GetCurrent() const
 {
 	if (LanguageSwitcher == nullptr)
@@ -39,64 +87,34 @@ FText FLocalizedText::GetCurrent() const
 		return FText::GetEmpty();
 	}
 
-	const auto CurrentLanguageId = LanguageSwitcher->CurrentLanguageId;
-	if (CurrentLanguageId == CurrentValueLanguageId)
+	if (LanguageSwitcher->LanguageEpoch == CurrentValueLanguageEpoch)
 	{
 		return Current;
 	}
+	CurrentValueLanguageEpoch = LanguageSwitcher->LanguageEpoch;
 
-	const FText* FoundText;
-	switch (LanguageSwitcher->FallbackOption)
+	// pool keeps only non-empty texts, so all fallback options resolve the same way for pooled text
+	const bool bSkipEmpty = LanguageSwitcher->FallbackOption != ELocalizedTextFallbackOption::OnNull &&
+		LanguageSwitcher->FallbackOption != ELocalizedTextFallbackOption::OnNotDefined;
+	for (const FString& LanguageId : LanguageSwitcher->GetLanguageLookupOrder())
 	{
-	case ELocalizedTextFallbackOption::OnNull:
-	case ELocalizedTextFallbackOption::OnNotDefined:
-		FoundText = TextByLanguageId.Find(LanguageSwitcher->CurrentLanguageId);
-		if (FoundText != nullptr)
-		{
-			Current = *FoundText;
-			break;
-		}
-		FoundText = TextByLanguageId.Find(LanguageSwitcher->FallbackLanguageId);
-		if (FoundText != nullptr)
-		{
-			Current = *FoundText;
-			break;
-		}
-		FoundText = TextByLanguageId.Find(LanguageSwitcher->PrimaryLanguageId);
-		if (FoundText != nullptr)
+		if (StringPool.IsValid())
 		{
-			Current = *FoundText;
-			break;
-		}
-		Current = FText::GetEmpty();
-		break;
-	default:
-	case ELocalizedTextFallbackOption::OnEmpty:
-		CurrentValueLanguageId = CurrentLanguageId;
-		FoundText = TextByLanguageId.Find(LanguageSwitcher->CurrentLanguageId);
-		if (FoundText != nullptr && !FoundText->IsEmpty())
-		{
-			Current = *FoundText;
-			break;
+			if (TryGetPooledText(LanguageId, Current))
+			{
+				return Current;
+			}
+			continue;
 		}
 
-		FoundText = TextByLanguageId.Find(LanguageSwitcher->FallbackLanguageId);
-		if (FoundText != nullptr && !FoundText->IsEmpty())
+		const FText* FoundText = TextByLanguageId.Find(LanguageId);
+		if (FoundText != nullptr && (!bSkipEmpty || !FoundText->IsEmpty()))
 		{
 			Current = *FoundText;
-			break;
+			return Current;
 		}
-
-		FoundText = TextByLanguageId.Find(LanguageSwitcher->PrimaryLanguageId);
-		if (FoundText != nullptr && !FoundText->IsEmpty())
-		{
-			Current = *FoundText;
-			break;
-		}
-
-		Current = FText::GetEmpty();
-		break;
 	}
 
+	Current = FText::GetEmpty();
 	return Current;
 }
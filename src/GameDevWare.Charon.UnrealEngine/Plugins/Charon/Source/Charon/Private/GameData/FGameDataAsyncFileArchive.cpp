@@ -0,0 +1,141 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "FGameDataAsyncFileArchive.h"
+
+#include "Async/AsyncFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+
+FGameDataAsyncFileArchive::FGameDataAsyncFileArchive()
+	: FileHandle()
+	  , PendingRequest(nullptr)
+	  , CurrentChunk(0)
+	  , CurrentChunkOffset(0)
+	  , CurrentChunkSize(0)
+	  , PendingChunkOffset(0)
+	  , PendingChunkSize(0)
+	  , FileSize(0)
+	  , Position(0)
+	  , OnChunkRead()
+{
+	this->SetIsLoading(true);
+}
+
+FGameDataAsyncFileArchive::~FGameDataAsyncFileArchive()
+{
+	// request should be completed before its memory and file handle are released
+	WaitPendingRequest();
+	FileHandle.Reset();
+}
+
+bool FGameDataAsyncFileArchive::Open(const FString& FilePath, TFunction<void(int64 BytesRead, int64 TotalBytes)> InOnChunkRead)
+{
+	OnChunkRead = MoveTemp(InOnChunkRead);
+	FileHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*FilePath));
+	if (!FileHandle.IsValid())
+	{
+		return false;
+	}
+
+	IAsyncReadRequest* SizeRequest = FileHandle->SizeRequest();
+	if (SizeRequest == nullptr)
+	{
+		return false;
+	}
+	SizeRequest->WaitCompletion();
+	FileSize = SizeRequest->GetSizeResults();
+	delete SizeRequest;
+
+	if (FileSize < 0)
+	{
+		FileSize = 0;
+		return false;
+	}
+
+	RequestChunk(0);
+	return true;
+}
+
+void FGameDataAsyncFileArchive::RequestChunk(const int64 Offset)
+{
+	check(PendingRequest == nullptr);
+
+	if (Offset >= FileSize)
+	{
+		return;
+	}
+
+	TArray<uint8>& ChunkBuffer = ChunkBuffers[1 - CurrentChunk];
+	PendingChunkOffset = Offset;
+	PendingChunkSize = FMath::Min(CHUNK_SIZE, FileSize - Offset);
+	if (ChunkBuffer.Num() < PendingChunkSize)
+	{
+		ChunkBuffer.SetNumUninitialized(static_cast<int32>(PendingChunkSize));
+	}
+	PendingRequest = FileHandle->ReadRequest(PendingChunkOffset, PendingChunkSize, AIOP_Normal, nullptr, ChunkBuffer.GetData());
+}
+
+void FGameDataAsyncFileArchive::WaitPendingRequest()
+{
+	if (PendingRequest == nullptr)
+	{
+		return;
+	}
+	PendingRequest->WaitCompletion();
+	delete PendingRequest;
+	PendingRequest = nullptr;
+}
+
+bool FGameDataAsyncFileArchive::SwitchToPendingChunk()
+{
+	if (PendingRequest == nullptr)
+	{
+		return false;
+	}
+
+	PendingRequest->WaitCompletion();
+	const bool IsRead = PendingRequest->GetReadResults() != nullptr;
+	delete PendingRequest;
+	PendingRequest = nullptr;
+	if (!IsRead)
+	{
+		return false;
+	}
+
+	CurrentChunk = 1 - CurrentChunk;
+	CurrentChunkOffset = PendingChunkOffset;
+	CurrentChunkSize = PendingChunkSize;
+
+	if (OnChunkRead)
+	{
+		OnChunkRead(CurrentChunkOffset + CurrentChunkSize, FileSize);
+	}
+
+	// next chunk is read while this one is decoded
+	RequestChunk(CurrentChunkOffset + CurrentChunkSize);
+	return true;
+}
+
+void FGameDataAsyncFileArchive::Serialize(void* Data, int64 Length)
+{
+	uint8* Destination = static_cast<uint8*>(Data);
+	while (Length > 0)
+	{
+		const int64 ChunkPosition = Position - CurrentChunkOffset;
+		if (ChunkPosition >= CurrentChunkSize)
+		{
+			if (!SwitchToPendingChunk())
+			{
+				FMemory::Memzero(Destination, Length);
+				SetError();
+				return;
+			}
+			continue;
+		}
+
+		const int64 CopySize = FMath::Min(Length, CurrentChunkSize - ChunkPosition);
+		FMemory::Memcpy(Destination, ChunkBuffers[CurrentChunk].GetData() + ChunkPosition, CopySize);
+		Destination += CopySize;
+		Position += CopySize;
+		Length -= CopySize;
+	}
+}
@@ -0,0 +1,51 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/Archive.h"
+#include "Templates/Function.h"
+#include "Templates/UniquePtr.h"
+
+class IAsyncReadFileHandle;
+class IAsyncReadRequest;
+
+/*
+ * Read-only FArchive over file with double-buffered asynchronous reads. Next chunk of file is requested
+ * while current chunk is being consumed, so decoding overlaps with file I/O. Only sequential reading is supported.
+ */
+class FGameDataAsyncFileArchive final : public FArchive
+{
+private:
+	static constexpr int64 CHUNK_SIZE = 1 * 1024 * 1024; // 1 Mib
+
+	TUniquePtr<IAsyncReadFileHandle> FileHandle;
+	IAsyncReadRequest* PendingRequest;
+	TArray<uint8> ChunkBuffers[2];
+	int32 CurrentChunk;
+	int64 CurrentChunkOffset;
+	int64 CurrentChunkSize;
+	int64 PendingChunkOffset;
+	int64 PendingChunkSize;
+	int64 FileSize;
+	int64 Position;
+	TFunction<void(int64 BytesRead, int64 TotalBytes)> OnChunkRead;
+
+	void RequestChunk(int64 Offset);
+	bool SwitchToPendingChunk();
+	void WaitPendingRequest();
+
+public:
+	FGameDataAsyncFileArchive();
+	virtual ~FGameDataAsyncFileArchive() override;
+
+	/*
+	 * Open file and request first chunk. OnChunkRead is called from reading thread after each chunk is received.
+	 */
+	bool Open(const FString& FilePath, TFunction<void(int64 BytesRead, int64 TotalBytes)> OnChunkRead = nullptr);
+
+	virtual void Serialize(void* Data, int64 Length) override;
+	virtual int64 Tell() override { return Position; }
+	virtual int64 TotalSize() override { return FileSize; }
+	virtual FString GetArchiveName() const override { return TEXT("FGameDataAsyncFileArchive"); }
+};
@@ -0,0 +1,113 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/FGameDataCompiledCache.h"
+
+#include "GameData/Formatters/FCompiledGameDataFormat.h"
+#include "GameData/Formatters/FCompiledGameDataReader.h"
+#include "GameData/Formatters/FCompiledGameDataWriter.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+DEFINE_LOG_CATEGORY(LogFGameDataCompiledCache);
+
+bool FGameDataCompiledCache::IsCacheEnabled = false;
+
+/*
+ * Cache entry is this header followed by compiled image. Header is 8-byte sized, so image stays aligned in mapped file.
+ */
+struct FGameDataCompiledCache_EntryHeader
+{
+	static constexpr uint32 EntryMagic = 0x43444743u; // 'CGDC'
+
+	uint32 Magic;
+	uint32 Reserved;
+	double SourceLoadSeconds;
+};
+static_assert(sizeof(FGameDataCompiledCache_EntryHeader) % FCompiledGameDataFormat::SectionAlignment == 0, "Cache entry header should keep image aligned.");
+
+FString FGameDataCompiledCache::GetCacheDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Charon"), TEXT("Cache"));
+}
+
+FString FGameDataCompiledCache::GetCacheFilePath(const FString& CacheKey)
+{
+	return FPaths::Combine(GetCacheDirectory(), CacheKey + FCompiledGameDataWriter::COMPILED_FILE_EXTENSION);
+}
+
+bool FGameDataCompiledCache::GetCacheKey(const TArrayView<const uint8> GameDataBuffer, EGameDataFormat Format, const FStringView& GeneratorVersion, FString& OutCacheKey)
+{
+	FString RevisionHash;
+	if (Format == EGameDataFormat::Compiled || !FCompiledGameDataWriter::ReadRevisionHash(GameDataBuffer, Format, RevisionHash))
+	{
+		return false;
+	}
+
+	const FString KeySource = RevisionHash + TEXT("|") + FString(GeneratorVersion) +
+		FString::Printf(TEXT("|%d|%u"), static_cast<int32>(Format), FCompiledGameDataFormat::FormatVersion);
+	const FTCHARToUTF8 KeySourceUtf8(*KeySource);
+	FSHAHash KeyHash;
+	FSHA1::HashBuffer(KeySourceUtf8.Get(), KeySourceUtf8.Length(), KeyHash.Hash);
+	OutCacheKey = KeyHash.ToString();
+	return true;
+}
+
+bool FGameDataCompiledCache::TryOpen(const FString& CacheKey, FGameDataMappedFile& CacheFile, TArrayView<const uint8>& OutImage, double& OutSourceLoadSeconds)
+{
+	const FString CacheFilePath = GetCacheFilePath(CacheKey);
+	if (!IFileManager::Get().FileExists(*CacheFilePath) || !CacheFile.Open(CacheFilePath))
+	{
+		return false;
+	}
+
+	const TArrayView<const uint8> Entry = CacheFile.GetData();
+	FGameDataCompiledCache_EntryHeader EntryHeader;
+	FCompiledGameDataHeader ImageHeader;
+	if (Entry.Num() < static_cast<int32>(sizeof(FGameDataCompiledCache_EntryHeader)))
+	{
+		return false;
+	}
+	FMemory::Memcpy(&EntryHeader, Entry.GetData(), sizeof(FGameDataCompiledCache_EntryHeader));
+	const TArrayView<const uint8> Image = Entry.RightChop(sizeof(FGameDataCompiledCache_EntryHeader));
+	if (EntryHeader.Magic != FGameDataCompiledCache_EntryHeader::EntryMagic || !FCompiledGameDataReader::ReadHeader(Image, ImageHeader))
+	{
+		UE_LOG(LogFGameDataCompiledCache, Warning, TEXT("Ignoring broken or outdated compiled game data cache entry '%s'."), *CacheFilePath);
+		return false;
+	}
+
+	OutImage = Image;
+	OutSourceLoadSeconds = EntryHeader.SourceLoadSeconds;
+	return true;
+}
+
+bool FGameDataCompiledCache::Write(const FString& CacheKey, const TArrayView<const uint8> Image, const double SourceLoadSeconds)
+{
+	FGameDataCompiledCache_EntryHeader EntryHeader;
+	EntryHeader.Magic = FGameDataCompiledCache_EntryHeader::EntryMagic;
+	EntryHeader.Reserved = 0;
+	EntryHeader.SourceLoadSeconds = SourceLoadSeconds;
+
+	TArray<uint8> Entry;
+	Entry.Reserve(sizeof(FGameDataCompiledCache_EntryHeader) + Image.Num());
+	Entry.Append(reinterpret_cast<const uint8*>(&EntryHeader), sizeof(FGameDataCompiledCache_EntryHeader));
+	Entry.Append(Image);
+
+	// write to unique temporary file and rename it, so other processes see either no entry or complete entry
+	const FString CacheFilePath = GetCacheFilePath(CacheKey);
+	const FString TemporaryFilePath = FString::Printf(TEXT("%s.%s.tmp"), *CacheFilePath, *FGuid::NewGuid().ToString());
+	if (!FFileHelper::SaveArrayToFile(Entry, *TemporaryFilePath))
+	{
+		UE_LOG(LogFGameDataCompiledCache, Warning, TEXT("Failed to write compiled game data cache entry '%s'."), *TemporaryFilePath);
+		return false;
+	}
+	if (!IFileManager::Get().Move(*CacheFilePath, *TemporaryFilePath, /* Replace */ true, /* EvenIfReadOnly */ false, /* Attributes */ false, /* bDoNotRetryOrError */ true))
+	{
+		// entry is opened by other process, which already wrote the same content
+		IFileManager::Get().Delete(*TemporaryFilePath, /* RequireExists */ false, /* EvenReadOnly */ false, /* Quiet */ true);
+		return IFileManager::Get().FileExists(*CacheFilePath);
+	}
+	return true;
+}
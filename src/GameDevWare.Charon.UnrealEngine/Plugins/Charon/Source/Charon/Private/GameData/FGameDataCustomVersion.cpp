@@ -0,0 +1,9 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/FGameDataCustomVersion.h"
+
+#include "Serialization/CustomVersion.h"
+
+const FGuid FGameDataCustomVersion::GUID(0x6C3B1E52, 0x8F0D4A7B, 0x9E21C4D3, 0x5A7F0B86);
+
+static FCustomVersionRegistration GFGameDataCustomVersion_Registration(FGameDataCustomVersion::GUID, FGameDataCustomVersion::LatestVersion, TEXT("CharonGameDataVer"));
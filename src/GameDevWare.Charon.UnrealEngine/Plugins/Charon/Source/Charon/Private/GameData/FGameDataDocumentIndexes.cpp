@@ -0,0 +1,331 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/FGameDataDocumentIndexes.h"
+
+#include "GameData/FLocalizedText.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+#include "UObject/UnrealType.h"
+#include "UObject/EnumProperty.h"
+
+DEFINE_LOG_CATEGORY(LogFGameDataDocumentIndexes);
+
+enum class EGameDataDocumentIndexKeyType : uint8
+{
+	None,
+	Integer,
+	Number,
+	String,
+	LocalizedText
+};
+
+static EGameDataDocumentIndexKeyType FGameDataDocumentIndexes_GetKeyType(const FProperty* Property)
+{
+	if (Property->IsA<FEnumProperty>() || Property->IsA<FBoolProperty>())
+	{
+		return EGameDataDocumentIndexKeyType::Integer;
+	}
+	if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+	{
+		return NumericProperty->IsFloatingPoint() ? EGameDataDocumentIndexKeyType::Number : EGameDataDocumentIndexKeyType::Integer;
+	}
+	if (Property->IsA<FStrProperty>() || Property->IsA<FNameProperty>())
+	{
+		return EGameDataDocumentIndexKeyType::String;
+	}
+	const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+	if (StructProperty != nullptr && StructProperty->Struct == FLocalizedText::StaticStruct())
+	{
+		return EGameDataDocumentIndexKeyType::LocalizedText;
+	}
+	return EGameDataDocumentIndexKeyType::None;
+}
+
+static const FProperty* FGameDataDocumentIndexes_FindProperty(const UClass* DocumentClass, const FName PropertyName)
+{
+	if (DocumentClass == nullptr)
+	{
+		return nullptr;
+	}
+	if (const FProperty* Property = DocumentClass->FindPropertyByName(PropertyName))
+	{
+		return Property;
+	}
+	// localized text is exposed as GetXXX() function over XXXRaw property
+	return DocumentClass->FindPropertyByName(FName(PropertyName.ToString() + TEXT("Raw")));
+}
+
+static int64 FGameDataDocumentIndexes_GetIntegerKey(const FProperty* Property, const void* ValuePtr)
+{
+	if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	{
+		return EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr);
+	}
+	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		return BoolProperty->GetPropertyValue(ValuePtr) ? 1 : 0;
+	}
+	return CastFieldChecked<FNumericProperty>(Property)->GetSignedIntPropertyValue(ValuePtr);
+}
+
+static FString FGameDataDocumentIndexes_GetStringKey(const FProperty* Property, const void* ValuePtr, const FString& PrimaryLanguageId)
+{
+	if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+	{
+		return NameProperty->GetPropertyValue(ValuePtr).ToString();
+	}
+	if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+	{
+		return StrProperty->GetPropertyValue(ValuePtr);
+	}
+	FText Text;
+	if (!static_cast<const FLocalizedText*>(ValuePtr)->TryGetText(PrimaryLanguageId, Text))
+	{
+		return FString();
+	}
+	return Text.ToString();
+}
+
+static int64 FGameDataDocumentIndexes_ClampToInteger(const double Value)
+{
+	// 2^63 is exactly representable as double, values in [-2^63, 2^63) are converted without overflow
+	if (Value >= 9223372036854775808.0)
+	{
+		return MAX_int64;
+	}
+	if (Value <= -9223372036854775808.0)
+	{
+		return MIN_int64;
+	}
+	return static_cast<int64>(Value);
+}
+
+template <typename KeyType>
+static void FGameDataDocumentIndexes_GroupByKey(TArray<TPair<KeyType, UGameDataDocument*>>& KeysAndDocuments,
+	TArray<UGameDataDocument*>& OutDocuments, TMap<KeyType, TPair<int32, int32>>& OutDocumentsRangeByKey)
+{
+	// stable sort keeps documents with same key in collection order
+	Algo::StableSortBy(KeysAndDocuments, [](const TPair<KeyType, UGameDataDocument*>& KeyAndDocument) -> const KeyType& { return KeyAndDocument.Key; });
+
+	OutDocuments.Reset(KeysAndDocuments.Num());
+	for (int32 Index = 0; Index < KeysAndDocuments.Num(); Index++)
+	{
+		TPair<int32, int32>& Range = OutDocumentsRangeByKey.FindOrAdd(KeysAndDocuments[Index].Key, TPair<int32, int32>(Index, 0));
+		Range.Value++;
+		OutDocuments.Add(KeysAndDocuments[Index].Value);
+	}
+}
+
+bool FGameDataDocumentIndexes::Build(const FGameDataDocumentIndexDeclaration& Declaration, const UClass* DocumentClass, const TArrayView<UGameDataDocument* const> Documents,
+	const FString& PrimaryLanguageId)
+{
+	if (FindIndex(Declaration.SchemaName, Declaration.PropertyName, Declaration.Type) != nullptr)
+	{
+		return true; // same index is declared twice
+	}
+
+	const FProperty* Property = FGameDataDocumentIndexes_FindProperty(DocumentClass, Declaration.PropertyName);
+	if (Property == nullptr)
+	{
+		UE_LOG(LogFGameDataDocumentIndexes, Error, TEXT("Failed to build index on '%s.%s' because schema or property is not found."),
+			*Declaration.SchemaName, *Declaration.PropertyName.ToString());
+		return false;
+	}
+
+	const EGameDataDocumentIndexKeyType KeyType = FGameDataDocumentIndexes_GetKeyType(Property);
+	const bool IsIndexable = Declaration.Type == EGameDataDocumentIndexType::Hash ?
+		KeyType == EGameDataDocumentIndexKeyType::Integer || KeyType == EGameDataDocumentIndexKeyType::String ||
+		KeyType == EGameDataDocumentIndexKeyType::LocalizedText :
+		KeyType == EGameDataDocumentIndexKeyType::Integer || KeyType == EGameDataDocumentIndexKeyType::Number;
+	if (!IsIndexable)
+	{
+		UE_LOG(LogFGameDataDocumentIndexes, Error, TEXT("Failed to build %s index on '%s.%s' because property of type '%s' could not be indexed this way."),
+			Declaration.Type == EGameDataDocumentIndexType::Hash ? TEXT("hash") : TEXT("sorted"),
+			*Declaration.SchemaName, *Declaration.PropertyName.ToString(), *Property->GetCPPType());
+		return false;
+	}
+
+	FIndex& Index = Indexes.AddDefaulted_GetRef();
+	Index.SchemaName = Declaration.SchemaName;
+	Index.PropertyName = Declaration.PropertyName;
+	Index.Type = Declaration.Type;
+
+	if (Declaration.Type == EGameDataDocumentIndexType::Sorted && KeyType == EGameDataDocumentIndexKeyType::Integer)
+	{
+		TArray<TPair<int64, UGameDataDocument*>> KeysAndDocuments;
+		KeysAndDocuments.Reserve(Documents.Num());
+		for (UGameDataDocument* Document : Documents)
+		{
+			if (Document == nullptr || !Document->IsA(DocumentClass))
+			{
+				continue;
+			}
+			KeysAndDocuments.Emplace(FGameDataDocumentIndexes_GetIntegerKey(Property, Property->ContainerPtrToValuePtr<void>(Document)), Document);
+		}
+
+		Algo::StableSortBy(KeysAndDocuments, [](const TPair<int64, UGameDataDocument*>& KeyAndDocument) { return KeyAndDocument.Key; });
+
+		Index.HasIntegerKeys = true;
+		Index.SortedIntegerKeys.Reset(KeysAndDocuments.Num());
+		Index.Documents.Reset(KeysAndDocuments.Num());
+		for (const TPair<int64, UGameDataDocument*>& KeyAndDocument : KeysAndDocuments)
+		{
+			Index.SortedIntegerKeys.Add(KeyAndDocument.Key);
+			Index.Documents.Add(KeyAndDocument.Value);
+		}
+	}
+	else if (Declaration.Type == EGameDataDocumentIndexType::Sorted)
+	{
+		TArray<TPair<double, UGameDataDocument*>> KeysAndDocuments;
+		KeysAndDocuments.Reserve(Documents.Num());
+		for (UGameDataDocument* Document : Documents)
+		{
+			if (Document == nullptr || !Document->IsA(DocumentClass))
+			{
+				continue;
+			}
+			const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Document);
+			KeysAndDocuments.Emplace(CastFieldChecked<FNumericProperty>(Property)->GetFloatingPointPropertyValue(ValuePtr), Document);
+		}
+
+		Algo::StableSortBy(KeysAndDocuments, [](const TPair<double, UGameDataDocument*>& KeyAndDocument) { return KeyAndDocument.Key; });
+
+		Index.SortedKeys.Reset(KeysAndDocuments.Num());
+		Index.Documents.Reset(KeysAndDocuments.Num());
+		for (const TPair<double, UGameDataDocument*>& KeyAndDocument : KeysAndDocuments)
+		{
+			Index.SortedKeys.Add(KeyAndDocument.Key);
+			Index.Documents.Add(KeyAndDocument.Value);
+		}
+	}
+	else if (KeyType == EGameDataDocumentIndexKeyType::String || KeyType == EGameDataDocumentIndexKeyType::LocalizedText)
+	{
+		TArray<TPair<FString, UGameDataDocument*>> KeysAndDocuments;
+		KeysAndDocuments.Reserve(Documents.Num());
+		for (UGameDataDocument* Document : Documents)
+		{
+			if (Document == nullptr || !Document->IsA(DocumentClass))
+			{
+				continue;
+			}
+			KeysAndDocuments.Emplace(FGameDataDocumentIndexes_GetStringKey(Property, Property->ContainerPtrToValuePtr<void>(Document), PrimaryLanguageId), Document);
+		}
+		FGameDataDocumentIndexes_GroupByKey(KeysAndDocuments, Index.Documents, Index.DocumentsRangeByString);
+	}
+	else
+	{
+		TArray<TPair<int64, UGameDataDocument*>> KeysAndDocuments;
+		KeysAndDocuments.Reserve(Documents.Num());
+		for (UGameDataDocument* Document : Documents)
+		{
+			if (Document == nullptr || !Document->IsA(DocumentClass))
+			{
+				continue;
+			}
+			KeysAndDocuments.Emplace(FGameDataDocumentIndexes_GetIntegerKey(Property, Property->ContainerPtrToValuePtr<void>(Document)), Document);
+		}
+		FGameDataDocumentIndexes_GroupByKey(KeysAndDocuments, Index.Documents, Index.DocumentsRangeByInteger);
+	}
+	return true;
+}
+
+void FGameDataDocumentIndexes::Reset()
+{
+	Indexes.Empty();
+}
+
+const FGameDataDocumentIndexes::FIndex* FGameDataDocumentIndexes::FindIndex(const FString& SchemaName, const FName PropertyName, const EGameDataDocumentIndexType Type) const
+{
+	// few indexes are declared, so linear search is fine and doesn't allocate key
+	for (const FIndex& Index : Indexes)
+	{
+		if (Index.Type == Type && Index.PropertyName == PropertyName && Index.SchemaName.Equals(SchemaName, ESearchCase::IgnoreCase))
+		{
+			return &Index;
+		}
+	}
+	return nullptr;
+}
+
+TArrayView<UGameDataDocument* const> FGameDataDocumentIndexes::Find(const FString& SchemaName, const FName PropertyName, const FString& Value) const
+{
+	const FIndex* Index = FindIndex(SchemaName, PropertyName, EGameDataDocumentIndexType::Hash);
+	const TPair<int32, int32>* Range = Index != nullptr ? Index->DocumentsRangeByString.Find(Value) : nullptr;
+	if (Range == nullptr)
+	{
+		return TArrayView<UGameDataDocument* const>();
+	}
+	return TArrayView<UGameDataDocument* const>(Index->Documents.GetData() + Range->Key, Range->Value);
+}
+
+TArrayView<UGameDataDocument* const> FGameDataDocumentIndexes::Find(const FString& SchemaName, const FName PropertyName, const int64 Value) const
+{
+	const FIndex* Index = FindIndex(SchemaName, PropertyName, EGameDataDocumentIndexType::Hash);
+	const TPair<int32, int32>* Range = Index != nullptr ? Index->DocumentsRangeByInteger.Find(Value) : nullptr;
+	if (Range == nullptr)
+	{
+		return TArrayView<UGameDataDocument* const>();
+	}
+	return TArrayView<UGameDataDocument* const>(Index->Documents.GetData() + Range->Key, Range->Value);
+}
+
+TArrayView<UGameDataDocument* const> FGameDataDocumentIndexes::FindInRange(const FString& SchemaName, const FName PropertyName, const double Min, const double Max) const
+{
+	const FIndex* Index = FindIndex(SchemaName, PropertyName, EGameDataDocumentIndexType::Sorted);
+	if (Index == nullptr || !(Min <= Max))
+	{
+		return TArrayView<UGameDataDocument* const>();
+	}
+
+	if (Index->HasIntegerKeys)
+	{
+		// range which is above or below all int64 values is empty, other bounds are clamped
+		const double IntegerMin = FMath::CeilToDouble(Min);
+		const double IntegerMax = FMath::FloorToDouble(Max);
+		if (IntegerMin > IntegerMax || IntegerMin >= 9223372036854775808.0 || IntegerMax < -9223372036854775808.0)
+		{
+			return TArrayView<UGameDataDocument* const>();
+		}
+		return FindInIntegerRange(SchemaName, PropertyName, FGameDataDocumentIndexes_ClampToInteger(IntegerMin), FGameDataDocumentIndexes_ClampToInteger(IntegerMax));
+	}
+
+	const int32 Start = Algo::LowerBound(Index->SortedKeys, Min);
+	const int32 End = Algo::UpperBound(Index->SortedKeys, Max);
+	if (Start >= End)
+	{
+		return TArrayView<UGameDataDocument* const>();
+	}
+	return TArrayView<UGameDataDocument* const>(Index->Documents.GetData() + Start, End - Start);
+}
+
+TArrayView<UGameDataDocument* const> FGameDataDocumentIndexes::FindInIntegerRange(const FString& SchemaName, const FName PropertyName, const int64 Min, const int64 Max) const
+{
+	const FIndex* Index = FindIndex(SchemaName, PropertyName, EGameDataDocumentIndexType::Sorted);
+	if (Index == nullptr || !Index->HasIntegerKeys || Min > Max)
+	{
+		return TArrayView<UGameDataDocument* const>();
+	}
+
+	const int32 Start = Algo::LowerBound(Index->SortedIntegerKeys, Min);
+	const int32 End = Algo::UpperBound(Index->SortedIntegerKeys, Max);
+	if (Start >= End)
+	{
+		return TArrayView<UGameDataDocument* const>();
+	}
+	return TArrayView<UGameDataDocument* const>(Index->Documents.GetData() + Start, End - Start);
+}
+
+SIZE_T FGameDataDocumentIndexes::GetAllocatedSize() const
+{
+	SIZE_T AllocatedSize = Indexes.GetAllocatedSize();
+	for (const FIndex& Index : Indexes)
+	{
+		AllocatedSize += Index.SchemaName.GetAllocatedSize() + Index.Documents.GetAllocatedSize() + Index.SortedKeys.GetAllocatedSize() + Index.SortedIntegerKeys.GetAllocatedSize() +
+			Index.DocumentsRangeByString.GetAllocatedSize() + Index.DocumentsRangeByInteger.GetAllocatedSize();
+		for (const TPair<FString, TPair<int32, int32>>& RangeByString : Index.DocumentsRangeByString)
+		{
+			AllocatedSize += RangeByString.Key.GetAllocatedSize();
+		}
+	}
+	return AllocatedSize;
+}
@@ -0,0 +1,114 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/FGameDataLazyDocuments.h"
+
+#include "GameData/Formatters/FGameDataReaderFactory.h"
+
+FGameDataLazyDocuments::FGameDataLazyDocuments()
+	: Buffer()
+	  , Reader()
+	  , RawDocumentsBySchema()
+	  , EmbeddedDocumentOwners()
+	  , RawDocumentCount(0)
+{
+}
+
+TSharedPtr<IGameDataReader> FGameDataLazyDocuments::Open(const TArrayView<const uint8> GameDataBuffer, const EGameDataFormat Format)
+{
+	Reset();
+
+	// heap allocation is aligned enough for compiled image, so it is read in place
+	Buffer = TArray<uint8>(GameDataBuffer.GetData(), GameDataBuffer.Num());
+	switch (Format)
+	{
+	case EGameDataFormat::Json:
+		Reader = FGameDataReaderFactory::CreateJsonReader(Buffer);
+		break;
+	case EGameDataFormat::MessagePack:
+		Reader = FGameDataReaderFactory::CreateMessagePackReader(Buffer);
+		break;
+	case EGameDataFormat::Compiled:
+		Reader = FGameDataReaderFactory::CreateCompiledReader(Buffer);
+		break;
+	default:
+		Reset();
+		break;
+	}
+	return Reader;
+}
+
+void FGameDataLazyDocuments::Add(const FString& SchemaName, const FString& DocumentId, const TArrayView<const uint8> RawDocument,
+	const TArray<FString>& EmbeddedDocumentIds)
+{
+	TMap<FString, TArrayView<const uint8>>& RawDocuments = RawDocumentsBySchema.FindOrAdd(SchemaName);
+	const int32 CountBefore = RawDocuments.Num();
+	RawDocuments.Add(DocumentId, RawDocument);
+	RawDocumentCount += RawDocuments.Num() - CountBefore;
+
+	for (const FString& EmbeddedDocumentId : EmbeddedDocumentIds)
+	{
+		EmbeddedDocumentOwners.AddUnique(EmbeddedDocumentId, TPair<FString, FString>(SchemaName, DocumentId));
+	}
+}
+
+bool FGameDataLazyDocuments::Contains(const FString& SchemaName, const FString& DocumentId) const
+{
+	const TMap<FString, TArrayView<const uint8>>* RawDocuments = RawDocumentsBySchema.Find(SchemaName);
+	return RawDocuments != nullptr && RawDocuments->Contains(DocumentId);
+}
+
+TSharedPtr<IGameDataReader> FGameDataLazyDocuments::Take(const FString& SchemaName, const FString& DocumentId)
+{
+	TMap<FString, TArrayView<const uint8>>* RawDocuments = RawDocumentsBySchema.Find(SchemaName);
+	TArrayView<const uint8> RawDocument;
+	if (!Reader.IsValid() || RawDocuments == nullptr || !RawDocuments->RemoveAndCopyValue(DocumentId, RawDocument))
+	{
+		return nullptr;
+	}
+	RawDocumentCount--;
+
+	const TSharedPtr<IGameDataReader> DocumentReader = Reader->CreateRawValueReader(RawDocument);
+	if (DocumentReader.IsValid())
+	{
+		DocumentReader->ReadNext(); // document's start
+	}
+	return DocumentReader;
+}
+
+void FGameDataLazyDocuments::GetEmbeddedDocumentOwners(const FString& DocumentId, TArray<TPair<FString, FString>>& OutOwners) const
+{
+	EmbeddedDocumentOwners.MultiFind(DocumentId, OutOwners, /* bMaintainOrder */ true);
+}
+
+void FGameDataLazyDocuments::GetSchemaNames(TArray<FString>& OutSchemaNames) const
+{
+	for (const auto& RawDocumentsById : RawDocumentsBySchema)
+	{
+		if (RawDocumentsById.Value.Num() > 0)
+		{
+			OutSchemaNames.Add(RawDocumentsById.Key);
+		}
+	}
+}
+
+void FGameDataLazyDocuments::GetDocumentIds(const FString& SchemaName, TArray<FString>& OutDocumentIds) const
+{
+	const TMap<FString, TArrayView<const uint8>>* RawDocuments = RawDocumentsBySchema.Find(SchemaName);
+	if (RawDocuments == nullptr)
+	{
+		return;
+	}
+	for (const auto& RawDocumentById : *RawDocuments)
+	{
+		OutDocumentIds.Add(RawDocumentById.Key);
+	}
+}
+
+void FGameDataLazyDocuments::Reset()
+{
+	RawDocumentsBySchema.Reset();
+	EmbeddedDocumentOwners.Reset();
+	RawDocumentCount = 0;
+	Reader.Reset();
+	Buffer.Empty();
+}
@@ -0,0 +1,130 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/FGameDataLoadStats.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/UObjectArray.h"
+
+DEFINE_LOG_CATEGORY(LogFGameDataLoadStats);
+
+UE_TRACE_CHANNEL_DEFINE(CharonChannel);
+
+static FGameDataLoadStats GFGameDataLoadStats_LastLoadStats;
+
+static FAutoConsoleCommand GFGameDataLoadStats_DumpCommand(
+	TEXT("Charon.DumpLoadStats"),
+	TEXT("Print stats of last game data load: time, bytes, documents, references and allocations per collection and load phases."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		TArray<FString> Lines;
+		FGameDataLoadStats::GetLastLoadStats().ToTable().ParseIntoArrayLines(Lines, /* InCullEmpty */ false);
+		for (const FString& Line : Lines)
+		{
+			UE_LOG(LogFGameDataLoadStats, Display, TEXT("%s"), *Line);
+		}
+	}));
+
+static int32 FGameDataLoadStats_GetObjectCount()
+{
+	return GUObjectArray.GetObjectArrayNumMinusAvailable();
+}
+
+static const TCHAR* FGameDataLoadStats_GetFormatName(const EGameDataFormat Format)
+{
+	switch (Format)
+	{
+	case EGameDataFormat::Json: return TEXT("Json");
+	case EGameDataFormat::MessagePack: return TEXT("MessagePack");
+	case EGameDataFormat::Compiled: return TEXT("Compiled");
+	default: return TEXT("Unknown");
+	}
+}
+
+void FGameDataLoadStats::BeginCollection(const FStringView& Name, const int64 Bytes, const int32 DocumentCount, const int32 ReferenceCount)
+{
+	// counters hold start values until EndCollection()
+	FGameDataCollectionLoadStats& CollectionStats = Collections.AddDefaulted_GetRef();
+	CollectionStats.Name = FString(Name);
+	CollectionStats.Bytes = Bytes;
+	CollectionStats.Seconds = FPlatformTime::Seconds();
+	CollectionStats.Documents = DocumentCount;
+	CollectionStats.References = ReferenceCount;
+	CollectionStats.Allocations = FGameDataLoadStats_GetObjectCount();
+}
+
+void FGameDataLoadStats::EndCollection(const int32 DocumentCount, const int32 ReferenceCount)
+{
+	if (Collections.Num() == 0)
+	{
+		return;
+	}
+
+	FGameDataCollectionLoadStats& CollectionStats = Collections.Last();
+	CollectionStats.Seconds = FPlatformTime::Seconds() - CollectionStats.Seconds;
+	CollectionStats.Documents = DocumentCount - CollectionStats.Documents;
+	CollectionStats.References = ReferenceCount - CollectionStats.References;
+	CollectionStats.Allocations = FGameDataLoadStats_GetObjectCount() - CollectionStats.Allocations;
+}
+
+int32 FGameDataLoadStats::GetTotalDocuments() const
+{
+	int32 TotalDocuments = 0;
+	for (const FGameDataCollectionLoadStats& CollectionStats : Collections)
+	{
+		TotalDocuments += CollectionStats.Documents;
+	}
+	return TotalDocuments;
+}
+
+int64 FGameDataLoadStats::GetTotalBytes() const
+{
+	int64 TotalBytes = 0;
+	for (const FGameDataCollectionLoadStats& CollectionStats : Collections)
+	{
+		TotalBytes += CollectionStats.Bytes;
+	}
+	return TotalBytes;
+}
+
+FString FGameDataLoadStats::ToTable() const
+{
+	if (GameDataName.IsEmpty())
+	{
+		return TEXT("No game data was loaded yet.");
+	}
+
+	FString Table = FString::Printf(TEXT("Game data '%s' (%s) %s in %.2f ms: parse %.2f ms, patch merge %.2f ms, find all documents %.2f ms, update settings %.2f ms, resolve references %.2f ms (%d unresolved), referrers index %lld bytes, build document indexes %.2f ms (%lld bytes).\n"),
+		*GameDataName, FGameDataLoadStats_GetFormatName(Format), IsSucceeded ? TEXT("loaded") : TEXT("failed to load"),
+		TotalSeconds * 1000.0, ParseSeconds * 1000.0, PatchMergeSeconds * 1000.0, FindAllDocumentsSeconds * 1000.0, UpdateSettingsSeconds * 1000.0,
+		ResolveReferencesSeconds * 1000.0, UnresolvedReferences, ReferrersIndexBytes, BuildIndexesSeconds * 1000.0, DocumentIndexesBytes);
+	Table += FString::Printf(TEXT("%-32s %10s %12s %10s %10s %11s\n"), TEXT("Collection"), TEXT("Time, ms"), TEXT("Bytes"), TEXT("Documents"), TEXT("References"), TEXT("Allocations"));
+
+	TArray<const FGameDataCollectionLoadStats*> SortedCollections;
+	for (const FGameDataCollectionLoadStats& CollectionStats : Collections)
+	{
+		SortedCollections.Add(&CollectionStats);
+	}
+	SortedCollections.Sort([](const FGameDataCollectionLoadStats& Left, const FGameDataCollectionLoadStats& Right)
+	{
+		return Left.Seconds > Right.Seconds;
+	});
+
+	for (const FGameDataCollectionLoadStats* CollectionStats : SortedCollections)
+	{
+		Table += FString::Printf(TEXT("%-32s %10.2f %12lld %10d %10d %11d\n"), *CollectionStats->Name, CollectionStats->Seconds * 1000.0,
+			CollectionStats->Bytes, CollectionStats->Documents, CollectionStats->References, CollectionStats->Allocations);
+	}
+	Table += FString::Printf(TEXT("%-32s %10s %12lld %10d\n"), TEXT("Total"), TEXT(""), GetTotalBytes(), GetTotalDocuments());
+	return Table;
+}
+
+void FGameDataLoadStats::SetLastLoadStats(const FGameDataLoadStats& LoadStats)
+{
+	GFGameDataLoadStats_LastLoadStats = LoadStats;
+}
+
+const FGameDataLoadStats& FGameDataLoadStats::GetLastLoadStats()
+{
+	return GFGameDataLoadStats_LastLoadStats;
+}
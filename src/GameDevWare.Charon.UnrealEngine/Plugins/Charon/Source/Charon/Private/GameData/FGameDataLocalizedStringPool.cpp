@@ -0,0 +1,116 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/FGameDataLocalizedStringPool.h"
+
+FGameDataLocalizedStringPool::FGameDataLocalizedStringPool() : TextCount(0), LastColumnIndex(INDEX_NONE)
+{
+}
+
+int32 FGameDataLocalizedStringPool::AddText()
+{
+	return TextCount++;
+}
+
+void FGameDataLocalizedStringPool::SetText(const int32 TextIndex, const FStringView LanguageId, const FStringView Text)
+{
+	check(TextIndex >= 0 && TextIndex < TextCount);
+
+	if (LanguageId.IsEmpty() || Text.IsEmpty())
+	{
+		return;
+	}
+
+	FLanguageColumn& Column = Columns[FindOrAddLanguage(LanguageId)];
+	if (Column.Ranges.Num() <= TextIndex)
+	{
+		Column.Ranges.SetNum(TextIndex + 1);
+	}
+
+	const FTCHARToUTF8 Utf8Text(Text.GetData(), Text.Len());
+	FTextRange& Range = Column.Ranges[TextIndex];
+	Range.Offset = Column.Chars.Num();
+	Range.Length = Utf8Text.Length();
+	Column.Chars.Append(reinterpret_cast<const UTF8CHAR*>(Utf8Text.Get()), Utf8Text.Length());
+}
+
+int32 FGameDataLocalizedStringPool::FindOrAddLanguage(const FStringView LanguageId)
+{
+	// texts are read language by language in same order, so last used column is checked first
+	if (Columns.IsValidIndex(LastColumnIndex) && Columns[LastColumnIndex].LanguageId.Equals(LanguageId, ESearchCase::IgnoreCase))
+	{
+		return LastColumnIndex;
+	}
+
+	LastColumnIndex = FindLanguage(LanguageId);
+	if (LastColumnIndex == INDEX_NONE)
+	{
+		LastColumnIndex = Columns.AddDefaulted();
+		Columns[LastColumnIndex].LanguageId = FString(LanguageId);
+	}
+	return LastColumnIndex;
+}
+
+int32 FGameDataLocalizedStringPool::FindLanguage(const FStringView LanguageId) const
+{
+	for (int32 ColumnIndex = 0; ColumnIndex < Columns.Num(); ColumnIndex++)
+	{
+		if (Columns[ColumnIndex].LanguageId.Equals(LanguageId, ESearchCase::IgnoreCase))
+		{
+			return ColumnIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+bool FGameDataLocalizedStringPool::HasText(const int32 LanguageIndex, const int32 TextIndex) const
+{
+	if (!Columns.IsValidIndex(LanguageIndex))
+	{
+		return false;
+	}
+	const FLanguageColumn& Column = Columns[LanguageIndex];
+	return Column.Ranges.IsValidIndex(TextIndex) && Column.Ranges[TextIndex].Offset != INDEX_NONE;
+}
+
+FText FGameDataLocalizedStringPool::GetText(const int32 LanguageIndex, const int32 TextIndex) const
+{
+	if (!HasText(LanguageIndex, TextIndex))
+	{
+		return FText::GetEmpty();
+	}
+
+	const FLanguageColumn& Column = Columns[LanguageIndex];
+	const FTextRange& Range = Column.Ranges[TextIndex];
+	const FUTF8ToTCHAR Text(reinterpret_cast<const ANSICHAR*>(Column.Chars.GetData() + Range.Offset), Range.Length);
+	return FText::FromStringView(FStringView(Text.Get(), Text.Length()));
+}
+
+void FGameDataLocalizedStringPool::GetTexts(const int32 TextIndex, TMap<FString, FText>& TextByLanguageId) const
+{
+	for (int32 ColumnIndex = 0; ColumnIndex < Columns.Num(); ColumnIndex++)
+	{
+		if (HasText(ColumnIndex, TextIndex))
+		{
+			TextByLanguageId.Add(Columns[ColumnIndex].LanguageId, GetText(ColumnIndex, TextIndex));
+		}
+	}
+}
+
+void FGameDataLocalizedStringPool::RemoveLanguagesExcept(const TArray<FString>& LanguageIds)
+{
+	Columns.RemoveAll([&LanguageIds](const FLanguageColumn& Column)
+	{
+		return !LanguageIds.Contains(Column.LanguageId);
+	});
+	LastColumnIndex = INDEX_NONE;
+}
+
+SIZE_T FGameDataLocalizedStringPool::GetAllocatedSize() const
+{
+	SIZE_T AllocatedSize = Columns.GetAllocatedSize();
+	for (const FLanguageColumn& Column : Columns)
+	{
+		AllocatedSize += Column.LanguageId.GetAllocatedSize() + Column.Chars.GetAllocatedSize() + Column.Ranges.GetAllocatedSize();
+	}
+	return AllocatedSize;
+}
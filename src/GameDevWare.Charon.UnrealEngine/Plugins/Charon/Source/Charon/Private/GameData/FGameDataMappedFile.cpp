@@ -0,0 +1,61 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/FGameDataMappedFile.h"
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/FileHelper.h"
+
+FGameDataMappedFile::FGameDataMappedFile()
+	: MappedFileHandle()
+	  , MappedFileRegion()
+	  , FileBytes()
+	  , Data()
+{
+}
+
+FGameDataMappedFile::~FGameDataMappedFile()
+{
+	// region should be unmapped before file handle is closed
+	MappedFileRegion.Reset();
+	MappedFileHandle.Reset();
+}
+
+bool FGameDataMappedFile::Open(const FString& FilePath)
+{
+	MappedFileRegion.Reset();
+	MappedFileHandle.Reset();
+	FileBytes.Empty();
+	Data = TArrayView<const uint8>();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+#if UE_VERSION_NEWER_THAN(5, 3, -1)
+	FOpenMappedResult OpenResult = PlatformFile.OpenMappedEx(*FilePath);
+	if (OpenResult.HasValue())
+	{
+		MappedFileHandle = OpenResult.StealValue();
+	}
+#else
+	MappedFileHandle.Reset(PlatformFile.OpenMapped(*FilePath));
+#endif
+
+	// TArrayView is limited to int32 size, larger files are not supported by readers anyway
+	if (MappedFileHandle.IsValid() && MappedFileHandle->GetFileSize() > 0 && MappedFileHandle->GetFileSize() <= MAX_int32)
+	{
+		MappedFileRegion.Reset(MappedFileHandle->MapRegion(0, MappedFileHandle->GetFileSize()));
+		if (MappedFileRegion.IsValid())
+		{
+			Data = TArrayView<const uint8>(MappedFileRegion->GetMappedPtr(), static_cast<int32>(MappedFileRegion->GetMappedSize()));
+			return true;
+		}
+	}
+	MappedFileHandle.Reset();
+
+	if (!FFileHelper::LoadFileToArray(FileBytes, *FilePath))
+	{
+		return false;
+	}
+	Data = FileBytes;
+	return true;
+}
@@ -0,0 +1,236 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/FGameDataPatchIndex.h"
+
+#include "GameData/UGameDataBase.h"
+
+FGameDataPatchIndex::FGameDataPatchIndex()
+	: PatchesBySchema()
+	  , ChangeNumber()
+	  , RevisionHash()
+	  , PatchedDocumentCount(0)
+{
+}
+
+bool FGameDataPatchIndex::AddPatch(IGameDataReader& PatchReader, UGameDataBase& GameData)
+{
+	if (!PatchReader.ReadObjectBegin())
+	{
+		return false;
+	}
+
+	while (PatchReader.GetNotation() != EJsonNotation::ObjectEnd)
+	{
+		if (PatchReader.IsError())
+		{
+			return false;
+		}
+
+		const FStringView MemberName = PatchReader.ReadMemberView();
+		if (MemberName == TEXT("ChangeNumber") && !PatchReader.IsNull())
+		{
+			int32 PatchChangeNumber = 0;
+			PatchReader.ReadValue(PatchChangeNumber);
+			PatchReader.ReadNext();
+			ChangeNumber = PatchChangeNumber;
+		}
+		else if (MemberName == TEXT("RevisionHash") && !PatchReader.IsNull())
+		{
+			FString PatchRevisionHash;
+			PatchReader.ReadValue(PatchRevisionHash);
+			PatchReader.ReadNext();
+			RevisionHash = MoveTemp(PatchRevisionHash);
+		}
+		else if (MemberName == TEXT("Collections") && !PatchReader.IsNull())
+		{
+			if (!ReadCollections(PatchReader, GameData))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			PatchReader.SkipAny();
+		}
+	}
+	PatchReader.ReadObjectEnd();
+
+	return !PatchReader.IsError();
+}
+
+bool FGameDataPatchIndex::ReadCollections(IGameDataReader& PatchReader, UGameDataBase& GameData)
+{
+	PatchReader.ReadObjectBegin();
+	while (PatchReader.GetNotation() != EJsonNotation::ObjectEnd)
+	{
+		if (PatchReader.IsError())
+		{
+			return false;
+		}
+
+		const FString SchemaName = PatchReader.ReadMember();
+		const UClass* DocumentClass = GameData.FindDocumentSchemaClass(SchemaName);
+		if (DocumentClass == nullptr || PatchReader.IsNull())
+		{
+			PatchReader.SkipAny(); // unknown schema is ignored
+			continue;
+		}
+
+		const bool IsByIdCollection = PatchReader.GetNotation() == EJsonNotation::ObjectStart;
+		if (IsByIdCollection)
+		{
+			PatchReader.ReadObjectBegin();
+		}
+		else
+		{
+			PatchReader.ReadArrayBegin();
+		}
+
+		while (PatchReader.GetNotation() != EJsonNotation::ArrayEnd &&
+			PatchReader.GetNotation() != EJsonNotation::ObjectEnd)
+		{
+			if (PatchReader.IsError())
+			{
+				return false;
+			}
+
+			// document id is collection's key or document's 'Id', documents without id could not be matched and are skipped
+			FString DocumentId = IsByIdCollection ? FString(PatchReader.GetIdentifierView()) : FString();
+			TSharedPtr<FJsonValue> DocumentPatch;
+			if (!PatchReader.ReadAny(DocumentPatch) || !DocumentPatch.IsValid())
+			{
+				return false;
+			}
+
+			const TSharedPtr<FJsonObject>* DocumentObjectPtr;
+			if (!IsByIdCollection && (!DocumentPatch->TryGetObject(DocumentObjectPtr) || !DocumentObjectPtr->IsValid() ||
+				!GetDocumentId(*DocumentObjectPtr->Get(), DocumentId)))
+			{
+				continue;
+			}
+			AddDocumentPatch(DocumentClass, SchemaName, DocumentId, DocumentPatch);
+		}
+
+		if (IsByIdCollection)
+		{
+			PatchReader.ReadObjectEnd();
+		}
+		else
+		{
+			PatchReader.ReadArrayEnd();
+		}
+	}
+	PatchReader.ReadObjectEnd();
+
+	return !PatchReader.IsError();
+}
+
+void FGameDataPatchIndex::AddDocumentPatch(const UClass* DocumentClass, const FStringView SchemaName, const FString& DocumentId, const TSharedPtr<FJsonValue>& DocumentPatch)
+{
+	FSchemaPatches& SchemaPatches = PatchesBySchema.FindOrAdd(DocumentClass);
+	if (SchemaPatches.SchemaName.IsEmpty())
+	{
+		SchemaPatches.SchemaName = FString(SchemaName);
+	}
+
+	TArray<TSharedPtr<FJsonValue>>& DocumentPatches = SchemaPatches.PatchesByDocumentId.FindOrAdd(DocumentId);
+	if (DocumentPatches.Num() == 0)
+	{
+		PatchedDocumentCount++;
+	}
+	DocumentPatches.Add(DocumentPatch);
+}
+
+bool FGameDataPatchIndex::HasPatches(const UClass* DocumentClass) const
+{
+	const FSchemaPatches* SchemaPatches = PatchesBySchema.Find(DocumentClass);
+	return SchemaPatches != nullptr && SchemaPatches->PatchesByDocumentId.Num() > 0;
+}
+
+bool FGameDataPatchIndex::Take(const UClass* DocumentClass, const FString& DocumentId, TArray<TSharedPtr<FJsonValue>>& OutDocumentPatches)
+{
+	FSchemaPatches* SchemaPatches = PatchesBySchema.Find(DocumentClass);
+	if (SchemaPatches == nullptr || !SchemaPatches->PatchesByDocumentId.RemoveAndCopyValue(DocumentId, OutDocumentPatches))
+	{
+		return false;
+	}
+	PatchedDocumentCount--;
+	return true;
+}
+
+void FGameDataPatchIndex::TakeAll(const UClass* DocumentClass, TArray<TPair<FString, TArray<TSharedPtr<FJsonValue>>>>& OutPatchesByDocumentId)
+{
+	OutPatchesByDocumentId.Reset();
+
+	FSchemaPatches* SchemaPatches = PatchesBySchema.Find(DocumentClass);
+	if (SchemaPatches == nullptr)
+	{
+		return;
+	}
+
+	for (TPair<FString, TArray<TSharedPtr<FJsonValue>>>& DocumentPatches : SchemaPatches->PatchesByDocumentId)
+	{
+		OutPatchesByDocumentId.Emplace(MoveTemp(DocumentPatches.Key), MoveTemp(DocumentPatches.Value));
+	}
+	PatchedDocumentCount -= SchemaPatches->PatchesByDocumentId.Num();
+	SchemaPatches->PatchesByDocumentId.Empty();
+}
+
+void FGameDataPatchIndex::GetSchemaNames(TArray<FString>& OutSchemaNames) const
+{
+	for (const TPair<const UClass*, FSchemaPatches>& SchemaPatches : PatchesBySchema)
+	{
+		if (SchemaPatches.Value.PatchesByDocumentId.Num() > 0)
+		{
+			OutSchemaNames.Add(SchemaPatches.Value.SchemaName);
+		}
+	}
+}
+
+void FGameDataPatchIndex::Reset()
+{
+	PatchesBySchema.Empty();
+	ChangeNumber.Reset();
+	RevisionHash.Reset();
+	PatchedDocumentCount = 0;
+}
+
+bool FGameDataPatchIndex::GetDocumentId(const FJsonObject& Document, FString& OutDocumentId)
+{
+	return GetDocumentId(Document.TryGetField(TEXT("Id")), OutDocumentId);
+}
+
+bool FGameDataPatchIndex::ReadDocumentId(IGameDataReader& DocumentReader, FString& OutDocumentId)
+{
+	if (!DocumentReader.ReadObjectBegin())
+	{
+		return false;
+	}
+	while (DocumentReader.GetNotation() != EJsonNotation::ObjectEnd && !DocumentReader.IsError())
+	{
+		if (DocumentReader.ReadMemberView().Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+		{
+			// id is read as FJsonValue, so it is converted to string the same way as ids of patches
+			TSharedPtr<FJsonValue> IdValue;
+			return DocumentReader.ReadAny(IdValue) && GetDocumentId(IdValue, OutDocumentId);
+		}
+		DocumentReader.SkipAny();
+	}
+	return false;
+}
+
+bool FGameDataPatchIndex::GetDocumentId(const TSharedPtr<FJsonValue>& IdValue, FString& OutDocumentId)
+{
+	if (!IdValue.IsValid() || IdValue->IsNull())
+	{
+		return false;
+	}
+
+	bool IdValueBool;
+	if (IdValue->Type == EJson::Boolean && IdValue->TryGetBool(IdValueBool))
+	{
+		OutDocumentId = IdValueBool ? TEXT("True") : TEXT("False");
+		return true;
+	}
+	return IdValue->TryGetString(OutDocumentId);
+}
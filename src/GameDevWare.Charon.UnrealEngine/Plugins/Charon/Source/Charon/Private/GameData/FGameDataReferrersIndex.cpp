@@ -0,0 +1,55 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/FGameDataReferrersIndex.h"
+
+#include "Algo/StableSort.h"
+
+void FGameDataReferrersIndex::Add(const UGameDataDocument* ReferencedDocument, UGameDataDocument* Referrer, const FName PropertyName)
+{
+	FGameDataDocumentReferrer DocumentReferrer;
+	DocumentReferrer.Document = Referrer;
+	DocumentReferrer.PropertyName = PropertyName;
+	PendingReferrers.Emplace(ReferencedDocument, DocumentReferrer);
+}
+
+void FGameDataReferrersIndex::Finalize()
+{
+	// stable sort keeps referrers of each document in visiting order
+	Algo::StableSortBy(PendingReferrers, [](const TPair<const UGameDataDocument*, FGameDataDocumentReferrer>& PendingReferrer)
+	{
+		return reinterpret_cast<UPTRINT>(PendingReferrer.Key);
+	});
+
+	Referrers.Reset(PendingReferrers.Num());
+	ReferrersRangeByDocument.Reset();
+	for (int32 Index = 0; Index < PendingReferrers.Num(); Index++)
+	{
+		const UGameDataDocument* ReferencedDocument = PendingReferrers[Index].Key;
+		TPair<int32, int32>& Range = ReferrersRangeByDocument.FindOrAdd(ReferencedDocument, TPair<int32, int32>(Index, 0));
+		Range.Value++;
+		Referrers.Add(PendingReferrers[Index].Value);
+	}
+	PendingReferrers.Empty();
+}
+
+void FGameDataReferrersIndex::Reset()
+{
+	PendingReferrers.Empty();
+	Referrers.Empty();
+	ReferrersRangeByDocument.Empty();
+}
+
+TArrayView<const FGameDataDocumentReferrer> FGameDataReferrersIndex::GetReferrers(const UGameDataDocument* Document) const
+{
+	const TPair<int32, int32>* Range = ReferrersRangeByDocument.Find(Document);
+	if (Range == nullptr)
+	{
+		return TArrayView<const FGameDataDocumentReferrer>();
+	}
+	return TArrayView<const FGameDataDocumentReferrer>(Referrers.GetData() + Range->Key, Range->Value);
+}
+
+SIZE_T FGameDataReferrersIndex::GetAllocatedSize() const
+{
+	return PendingReferrers.GetAllocatedSize() + Referrers.GetAllocatedSize() + ReferrersRangeByDocument.GetAllocatedSize();
+}
@@ -0,0 +1,389 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/Formatters/FCompiledGameDataReader.h"
+
+#include "Containers/StringConv.h"
+
+FCompiledGameDataReader::FCompiledGameDataReader(FArchive* const Stream)
+	: OwnedBuffer()
+	  , Image(nullptr)
+	  , ImageSize(0)
+	  , Strings(nullptr)
+	  , StringData(nullptr)
+	  , Tokens(nullptr)
+	  , StringCount(0)
+	  , FirstTokenIndex(0)
+	  , EndTokenIndex(0)
+	  , TokenIndex(0)
+	  , Token(nullptr)
+	  , Notation(EJsonNotation::Null)
+	  , ErrorMessage()
+	  , EmptyString()
+	  , DecodedStrings(MakeShared<TArray<FString>>())
+{
+	if (Stream == nullptr)
+	{
+		SetErrorMessage(TEXT("Null Stream"));
+		return;
+	}
+
+	const int64 RemainingSize = Stream->TotalSize() - Stream->Tell();
+	if (RemainingSize > MAX_int32)
+	{
+		SetErrorMessage(TEXT("Input is too large."));
+		return;
+	}
+	if (RemainingSize > 0)
+	{
+		OwnedBuffer.SetNumUninitialized(static_cast<int32>(RemainingSize));
+		Stream->Serialize(OwnedBuffer.GetData(), RemainingSize);
+		if (Stream->IsError())
+		{
+			SetErrorMessage(TEXT("Unexpected end of data."));
+			return;
+		}
+	}
+	Initialize(OwnedBuffer);
+}
+
+FCompiledGameDataReader::FCompiledGameDataReader(const TArrayView<const uint8> Buffer)
+	: OwnedBuffer()
+	  , Image(nullptr)
+	  , ImageSize(0)
+	  , Strings(nullptr)
+	  , StringData(nullptr)
+	  , Tokens(nullptr)
+	  , StringCount(0)
+	  , FirstTokenIndex(0)
+	  , EndTokenIndex(0)
+	  , TokenIndex(0)
+	  , Token(nullptr)
+	  , Notation(EJsonNotation::Null)
+	  , ErrorMessage()
+	  , EmptyString()
+	  , DecodedStrings(MakeShared<TArray<FString>>())
+{
+	if (!IsAligned(Buffer.GetData(), FCompiledGameDataFormat::SectionAlignment))
+	{
+		// records are accessed in place, so they should be aligned
+		OwnedBuffer = Buffer;
+		Initialize(OwnedBuffer);
+		return;
+	}
+	Initialize(Buffer);
+}
+
+FCompiledGameDataReader::FCompiledGameDataReader(const FCompiledGameDataReader& ParentReader, const int64 FirstTokenIndex, const int64 EndTokenIndex)
+	: OwnedBuffer()
+	  , Image(ParentReader.Image)
+	  , ImageSize(ParentReader.ImageSize)
+	  , Strings(ParentReader.Strings)
+	  , StringData(ParentReader.StringData)
+	  , Tokens(ParentReader.Tokens)
+	  , StringCount(ParentReader.StringCount)
+	  , FirstTokenIndex(FirstTokenIndex)
+	  , EndTokenIndex(EndTokenIndex)
+	  , TokenIndex(FirstTokenIndex)
+	  , Token(nullptr)
+	  , Notation(EJsonNotation::Null)
+	  , ErrorMessage()
+	  , EmptyString()
+	  , DecodedStrings(ParentReader.DecodedStrings)
+{
+}
+
+bool FCompiledGameDataReader::ReadHeader(const TArrayView<const uint8> Buffer, FCompiledGameDataHeader& OutHeader)
+{
+	if (Buffer.Num() < static_cast<int32>(sizeof(FCompiledGameDataHeader)))
+	{
+		return false;
+	}
+	FMemory::Memcpy(&OutHeader, Buffer.GetData(), sizeof(FCompiledGameDataHeader));
+	return OutHeader.Magic == FCompiledGameDataFormat::Magic &&
+		OutHeader.FormatVersion == FCompiledGameDataFormat::FormatVersion &&
+		OutHeader.ImageSize == static_cast<uint64>(Buffer.Num());
+}
+
+void FCompiledGameDataReader::Initialize(const TArrayView<const uint8> Buffer)
+{
+	FCompiledGameDataHeader Header;
+	if (!ReadHeader(Buffer, Header))
+	{
+		SetErrorMessage(TEXT("Invalid compiled game data image. Image is truncated, broken or compiled with different format version."));
+		return;
+	}
+
+	const uint64 StringDirectoryEnd = Header.StringDirectoryOffset + static_cast<uint64>(Header.StringCount) * sizeof(FCompiledGameDataString);
+	const uint64 TokenTableEnd = Header.TokenTableOffset + static_cast<uint64>(Header.TokenCount) * sizeof(FCompiledGameDataToken);
+	if (Header.StringDirectoryOffset < sizeof(FCompiledGameDataHeader) ||
+		Header.StringDirectoryOffset % FCompiledGameDataFormat::SectionAlignment != 0 ||
+		Header.TokenTableOffset % FCompiledGameDataFormat::SectionAlignment != 0 ||
+		StringDirectoryEnd > Header.StringDataOffset ||
+		Header.StringDataOffset > Header.TokenTableOffset ||
+		TokenTableEnd > Header.ImageSize)
+	{
+		SetErrorMessage(TEXT("Invalid compiled game data image. Section offsets are out of image bounds."));
+		return;
+	}
+
+	Image = Buffer.GetData();
+	ImageSize = Buffer.Num();
+	Strings = reinterpret_cast<const FCompiledGameDataString*>(Image + Header.StringDirectoryOffset);
+	StringData = Image + Header.StringDataOffset;
+	Tokens = reinterpret_cast<const FCompiledGameDataToken*>(Image + Header.TokenTableOffset);
+	StringCount = Header.StringCount;
+	FirstTokenIndex = 0;
+	EndTokenIndex = Header.TokenCount;
+	TokenIndex = 0;
+
+	// validate string directory once, so string access doesn't need bound checks
+	const uint64 StringDataLength = Header.TokenTableOffset - Header.StringDataOffset;
+	for (uint32 StringIndex = 0; StringIndex < StringCount; ++StringIndex)
+	{
+		if (static_cast<uint64>(Strings[StringIndex].Offset) + Strings[StringIndex].Length > StringDataLength)
+		{
+			SetErrorMessage(FString::Printf(TEXT("Invalid compiled game data image. String #%u is out of image bounds."), StringIndex));
+			return;
+		}
+	}
+}
+
+bool FCompiledGameDataReader::ReadNext()
+{
+	if (!ErrorMessage.IsEmpty())
+	{
+		Notation = EJsonNotation::Error;
+		return false;
+	}
+
+	if (TokenIndex >= EndTokenIndex)
+	{
+		Token = nullptr;
+		Notation = EJsonNotation::Null;
+		return false;
+	}
+
+	const FCompiledGameDataToken* NextToken = &Tokens[TokenIndex];
+	if (!IsValidToken(*NextToken))
+	{
+		Token = nullptr;
+		Notation = EJsonNotation::Error;
+		SetErrorMessage(FString::Printf(TEXT("Invalid compiled game data image. Token #%lld is broken."), TokenIndex));
+		return false;
+	}
+
+	Token = NextToken;
+	Notation = static_cast<EJsonNotation>(Token->Notation);
+	TokenIndex++;
+	return true;
+}
+
+bool FCompiledGameDataReader::IsValidToken(const FCompiledGameDataToken& NextToken) const
+{
+	if (NextToken.Notation >= static_cast<uint8>(EJsonNotation::Error) ||
+		NextToken.ValueType > static_cast<uint8>(ECompiledGameDataValueType::ClosingToken) ||
+		(NextToken.Identifier != FCompiledGameDataFormat::NoIdentifier && NextToken.Identifier >= StringCount) ||
+		(NextToken.ValueType == static_cast<uint8>(ECompiledGameDataValueType::String) && NextToken.Value >= StringCount))
+	{
+		return false;
+	}
+
+	EJsonNotation ClosingNotation;
+	switch (static_cast<EJsonNotation>(NextToken.Notation))
+	{
+	case EJsonNotation::ObjectStart: ClosingNotation = EJsonNotation::ObjectEnd; break;
+	case EJsonNotation::ArrayStart: ClosingNotation = EJsonNotation::ArrayEnd; break;
+	default:
+		// only container start could point to closing token
+		return NextToken.ValueType != static_cast<uint8>(ECompiledGameDataValueType::ClosingToken);
+	}
+
+	// SkipAny() and ReadRawValue() jump to closing token, so it should be matching end token ahead of current one and inside reader's range
+	return NextToken.ValueType == static_cast<uint8>(ECompiledGameDataValueType::ClosingToken) &&
+		NextToken.Value > static_cast<uint64>(TokenIndex) &&
+		NextToken.Value < static_cast<uint64>(EndTokenIndex) &&
+		Tokens[NextToken.Value].Notation == static_cast<uint8>(ClosingNotation);
+}
+
+const FString& FCompiledGameDataReader::GetString(const uint32 StringIndex) const
+{
+	TArray<FString>& Decoded = DecodedStrings.Get();
+	if (Decoded.Num() == 0)
+	{
+		// allocated once and shared with raw value readers, so references to decoded strings are stable for reader's lifetime
+		Decoded.SetNum(StringCount);
+	}
+
+	FString& Value = Decoded[StringIndex];
+	const FCompiledGameDataString& String = Strings[StringIndex];
+	if (Value.IsEmpty() && String.Length > 0)
+	{
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(StringData + String.Offset), String.Length);
+		Value = FString(Converted.Length(), Converted.Get());
+	}
+	return Value;
+}
+
+const FString& FCompiledGameDataReader::GetIdentifier() const
+{
+	if (Token == nullptr || Token->Identifier == FCompiledGameDataFormat::NoIdentifier)
+	{
+		return EmptyString;
+	}
+	return GetString(Token->Identifier);
+}
+
+uint32 FCompiledGameDataReader::GetIdentifierHash() const
+{
+	if (Token == nullptr || Token->Identifier == FCompiledGameDataFormat::NoIdentifier)
+	{
+		return FGameDataMemberNameHash::OffsetBasis;
+	}
+	return Strings[Token->Identifier].NameHash;
+}
+
+const FString& FCompiledGameDataReader::GetValueAsString() const
+{
+	check(Notation == EJsonNotation::String && Token->ValueType == static_cast<uint8>(ECompiledGameDataValueType::String));
+
+	return GetString(static_cast<uint32>(Token->Value));
+}
+
+double FCompiledGameDataReader::GetValueAsNumber() const
+{
+	check(Notation == EJsonNotation::Number);
+
+	switch (static_cast<ECompiledGameDataValueType>(Token->ValueType))
+	{
+	case ECompiledGameDataValueType::Int64: return static_cast<double>(static_cast<int64>(Token->Value));
+	case ECompiledGameDataValueType::UInt64: return static_cast<double>(Token->Value);
+	case ECompiledGameDataValueType::Double:
+		{
+			double Value;
+			FMemory::Memcpy(&Value, &Token->Value, sizeof(double));
+			return Value;
+		}
+	default: return 0;
+	}
+}
+
+int64 FCompiledGameDataReader::GetValueAsInt64()
+{
+	if (Notation == EJsonNotation::Number && (Token->ValueType == static_cast<uint8>(ECompiledGameDataValueType::Int64) ||
+		Token->ValueType == static_cast<uint8>(ECompiledGameDataValueType::UInt64)))
+	{
+		return static_cast<int64>(Token->Value);
+	}
+	return IGameDataReader::GetValueAsInt64();
+}
+
+uint64 FCompiledGameDataReader::GetValueAsUInt64()
+{
+	if (Notation == EJsonNotation::Number && (Token->ValueType == static_cast<uint8>(ECompiledGameDataValueType::Int64) ||
+		Token->ValueType == static_cast<uint8>(ECompiledGameDataValueType::UInt64)))
+	{
+		return Token->Value;
+	}
+	return IGameDataReader::GetValueAsUInt64();
+}
+
+bool FCompiledGameDataReader::GetValueAsBoolean() const
+{
+	check(Notation == EJsonNotation::Boolean);
+
+	return Token->Value != 0;
+}
+
+void FCompiledGameDataReader::SetErrorState(const FString& Message)
+{
+	ErrorMessage = Message;
+	Notation = EJsonNotation::Error;
+}
+
+void FCompiledGameDataReader::SetErrorMessage(const FString& Message)
+{
+	ErrorMessage = Message;
+}
+
+void FCompiledGameDataReader::SkipAny(const bool NextToken)
+{
+	if (Notation == EJsonNotation::Error)
+	{
+		return;
+	}
+	if (Notation != EJsonNotation::ObjectStart && Notation != EJsonNotation::ArrayStart)
+	{
+		ReadNext();
+		return;
+	}
+
+	// container start token points to its closing token, content is not visited at all
+	TokenIndex = static_cast<int64>(Token->Value);
+	if (ReadNext() && NextToken)
+	{
+		ReadNext();
+	}
+}
+
+bool FCompiledGameDataReader::ReadRawValue(TArrayView<const uint8>& RawValue, const bool NextToken)
+{
+	const int64 ValueTokenIndex = TokenIndex - 1;
+	int64 LastTokenIndex;
+	switch (Notation)
+	{
+	case EJsonNotation::ObjectStart:
+	case EJsonNotation::ArrayStart:
+		LastTokenIndex = static_cast<int64>(Token->Value);
+		break;
+	case EJsonNotation::String:
+	case EJsonNotation::Number:
+	case EJsonNotation::Boolean:
+	case EJsonNotation::Null:
+		LastTokenIndex = ValueTokenIndex;
+		break;
+	default:
+		return false;
+	}
+
+	// raw value is a range of token records, it is read back by reader sharing this reader's string pool
+	RawValue = TArrayView<const uint8>(reinterpret_cast<const uint8*>(Tokens + ValueTokenIndex),
+		static_cast<int32>((LastTokenIndex - ValueTokenIndex + 1) * sizeof(FCompiledGameDataToken)));
+
+	Token = &Tokens[LastTokenIndex];
+	Notation = static_cast<EJsonNotation>(Token->Notation);
+	TokenIndex = LastTokenIndex + 1;
+	if (NextToken)
+	{
+		ReadNext();
+	}
+	return true;
+}
+
+TSharedPtr<IGameDataReader> FCompiledGameDataReader::CreateRawValueReader(const TArrayView<const uint8> RawValue) const
+{
+	const int64 Offset = RawValue.GetData() - reinterpret_cast<const uint8*>(Tokens);
+	if (Tokens == nullptr || Offset < 0 || Offset % sizeof(FCompiledGameDataToken) != 0 || RawValue.Num() % sizeof(FCompiledGameDataToken) != 0)
+	{
+		return nullptr;
+	}
+
+	const int64 RawFirstTokenIndex = Offset / sizeof(FCompiledGameDataToken);
+	const int64 RawEndTokenIndex = RawFirstTokenIndex + RawValue.Num() / sizeof(FCompiledGameDataToken);
+	if (RawFirstTokenIndex < FirstTokenIndex || RawEndTokenIndex > EndTokenIndex)
+	{
+		return nullptr;
+	}
+	return MakeShareable(new FCompiledGameDataReader(*this, RawFirstTokenIndex, RawEndTokenIndex));
+}
+
+bool FCompiledGameDataReader::GetRawTokenBounds(const uint8*& OutTokenStart, const uint8*& OutTokenEnd) const
+{
+	if (Token == nullptr || Notation == EJsonNotation::Error)
+	{
+		return false;
+	}
+
+	OutTokenStart = reinterpret_cast<const uint8*>(Token);
+	OutTokenEnd = reinterpret_cast<const uint8*>(Token + 1);
+	return true;
+}
@@ -0,0 +1,275 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/Formatters/FCompiledGameDataWriter.h"
+
+#include "GameData/Formatters/FCompiledGameDataFormat.h"
+#include "GameData/Formatters/FCompiledGameDataReader.h"
+#include "GameData/Formatters/FGameDataReaderFactory.h"
+#include "Containers/Map.h"
+#include "Containers/StringConv.h"
+#include "Misc/FileHelper.h"
+
+DEFINE_LOG_CATEGORY(LogFCompiledGameDataWriter);
+
+/*
+ * String pool is case-sensitive, unlike default FString map keys.
+ */
+struct FCompiledGameDataWriter_StringKeyFuncs : BaseKeyFuncs<TPair<FString, uint32>, FString, false>
+{
+	static const FString& GetSetKey(const TPair<FString, uint32>& Element) { return Element.Key; }
+	static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+	static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+};
+
+class FCompiledGameDataWriter_StringPool
+{
+private:
+	TMap<FString, uint32, FDefaultSetAllocator, FCompiledGameDataWriter_StringKeyFuncs> StringIndices;
+
+public:
+	TArray<FCompiledGameDataString> Strings;
+	TArray<uint8> StringData;
+
+	uint32 Add(const FStringView& Value)
+	{
+		FString Key(Value);
+		if (const uint32* ExistingIndex = StringIndices.Find(Key))
+		{
+			return *ExistingIndex;
+		}
+
+		const FTCHARToUTF8 Converted(Value.GetData(), Value.Len());
+		FCompiledGameDataString String;
+		String.Offset = static_cast<uint32>(StringData.Num());
+		String.Length = static_cast<uint32>(Converted.Length());
+		String.NameHash = FGameDataMemberNameHash::Of(Value);
+		String.Reserved = 0;
+		StringData.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+
+		const uint32 Index = static_cast<uint32>(Strings.Add(String));
+		StringIndices.Add(MoveTemp(Key), Index);
+		return Index;
+	}
+};
+
+static bool FCompiledGameDataWriter_WriteToken(IGameDataReader& GameDataReader, FCompiledGameDataWriter_StringPool& StringPool,
+	FCompiledGameDataToken& Token)
+{
+	const EJsonNotation Notation = GameDataReader.GetNotation();
+	const FStringView Identifier = GameDataReader.GetIdentifierView();
+
+	Token.Notation = static_cast<uint8>(Notation);
+	Token.ValueType = static_cast<uint8>(ECompiledGameDataValueType::None);
+	Token.Reserved = 0;
+	Token.Identifier = Identifier.IsEmpty() ? FCompiledGameDataFormat::NoIdentifier : StringPool.Add(Identifier);
+	Token.Value = 0;
+
+	switch (Notation)
+	{
+	case EJsonNotation::ObjectStart:
+	case EJsonNotation::ArrayStart:
+		Token.ValueType = static_cast<uint8>(ECompiledGameDataValueType::ClosingToken); // patched when container is closed
+		return true;
+	case EJsonNotation::ObjectEnd:
+	case EJsonNotation::ArrayEnd:
+	case EJsonNotation::Null:
+		return true;
+	case EJsonNotation::Boolean:
+		Token.ValueType = static_cast<uint8>(ECompiledGameDataValueType::Boolean);
+		Token.Value = GameDataReader.GetValueAsBoolean() ? 1 : 0;
+		return true;
+	case EJsonNotation::String:
+		Token.ValueType = static_cast<uint8>(ECompiledGameDataValueType::String);
+		Token.Value = StringPool.Add(GameDataReader.GetValueAsStringView());
+		return true;
+	case EJsonNotation::Number:
+		{
+			// integers are stored exactly, so 64-bit values are not rounded through double
+			const double Number = GameDataReader.GetValueAsNumber();
+			if (FMath::FloorToDouble(Number) == Number && Number >= -9223372036854775808.0 && Number < 18446744073709551616.0)
+			{
+				if (Number >= 9223372036854775808.0)
+				{
+					Token.ValueType = static_cast<uint8>(ECompiledGameDataValueType::UInt64);
+					Token.Value = GameDataReader.GetValueAsUInt64();
+				}
+				else
+				{
+					Token.ValueType = static_cast<uint8>(ECompiledGameDataValueType::Int64);
+					Token.Value = static_cast<uint64>(GameDataReader.GetValueAsInt64());
+				}
+			}
+			else
+			{
+				Token.ValueType = static_cast<uint8>(ECompiledGameDataValueType::Double);
+				FMemory::Memcpy(&Token.Value, &Number, sizeof(double));
+			}
+			return true;
+		}
+	case EJsonNotation::Error:
+	default:
+		return false;
+	}
+}
+
+bool FCompiledGameDataWriter::Write(IGameDataReader& GameDataReader, const FSHAHash& SourceHash, TArray<uint8>& OutImage)
+{
+	FCompiledGameDataWriter_StringPool StringPool;
+	TArray<FCompiledGameDataToken> Tokens;
+	TArray<int32> OpenContainers;
+
+	while (GameDataReader.ReadNext())
+	{
+		FCompiledGameDataToken& Token = Tokens.AddDefaulted_GetRef();
+		if (!FCompiledGameDataWriter_WriteToken(GameDataReader, StringPool, Token))
+		{
+			break;
+		}
+
+		switch (GameDataReader.GetNotation())
+		{
+		case EJsonNotation::ObjectStart:
+		case EJsonNotation::ArrayStart:
+			OpenContainers.Push(Tokens.Num() - 1);
+			break;
+		case EJsonNotation::ObjectEnd:
+		case EJsonNotation::ArrayEnd:
+			if (OpenContainers.Num() == 0)
+			{
+				GameDataReader.SetErrorState(TEXT("Unexpected end of container."));
+				break;
+			}
+			Tokens[OpenContainers.Pop()].Value = static_cast<uint64>(Tokens.Num() - 1);
+			break;
+		default:
+			break;
+		}
+		if (OpenContainers.Num() == 0)
+		{
+			break; // root value is read
+		}
+	}
+
+	if (GameDataReader.GetNotation() == EJsonNotation::Error || OpenContainers.Num() != 0 || Tokens.Num() == 0)
+	{
+		UE_LOG(LogFCompiledGameDataWriter, Error, TEXT("Failed to compile game data. %s"),
+			GameDataReader.GetErrorMessage().IsEmpty() ? TEXT("Unexpected end of data.") : *GameDataReader.GetErrorMessage());
+		return false;
+	}
+
+	FCompiledGameDataHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = FCompiledGameDataFormat::Magic;
+	Header.FormatVersion = FCompiledGameDataFormat::FormatVersion;
+	FMemory::Memcpy(Header.SourceHash, SourceHash.Hash, FCompiledGameDataFormat::SourceHashSize);
+	Header.StringCount = static_cast<uint32>(StringPool.Strings.Num());
+	Header.TokenCount = static_cast<uint32>(Tokens.Num());
+	Header.StringDirectoryOffset = Align(sizeof(FCompiledGameDataHeader), FCompiledGameDataFormat::SectionAlignment);
+	Header.StringDataOffset = Header.StringDirectoryOffset + StringPool.Strings.Num() * sizeof(FCompiledGameDataString);
+	Header.TokenTableOffset = Align(Header.StringDataOffset + StringPool.StringData.Num(), FCompiledGameDataFormat::SectionAlignment);
+	Header.ImageSize = Header.TokenTableOffset + Tokens.Num() * sizeof(FCompiledGameDataToken);
+
+	if (Header.ImageSize > MAX_int32)
+	{
+		UE_LOG(LogFCompiledGameDataWriter, Error, TEXT("Failed to compile game data. Compiled image is too large (%llu bytes)."), Header.ImageSize);
+		return false;
+	}
+
+	OutImage.Reset();
+	OutImage.SetNumZeroed(static_cast<int32>(Header.ImageSize));
+	FMemory::Memcpy(OutImage.GetData(), &Header, sizeof(FCompiledGameDataHeader));
+	FMemory::Memcpy(OutImage.GetData() + Header.StringDirectoryOffset, StringPool.Strings.GetData(), StringPool.Strings.Num() * sizeof(FCompiledGameDataString));
+	FMemory::Memcpy(OutImage.GetData() + Header.StringDataOffset, StringPool.StringData.GetData(), StringPool.StringData.Num());
+	FMemory::Memcpy(OutImage.GetData() + Header.TokenTableOffset, Tokens.GetData(), Tokens.Num() * sizeof(FCompiledGameDataToken));
+	return true;
+}
+
+bool FCompiledGameDataWriter::Compile(const TArrayView<const uint8> SourceBuffer, EGameDataFormat SourceFormat, TArray<uint8>& OutImage)
+{
+	switch (SourceFormat)
+	{
+	case EGameDataFormat::Json:
+		return Write(*FGameDataReaderFactory::CreateJsonReader(SourceBuffer), GetSourceHash(SourceBuffer), OutImage);
+	case EGameDataFormat::MessagePack:
+		return Write(*FGameDataReaderFactory::CreateMessagePackReader(SourceBuffer), GetSourceHash(SourceBuffer), OutImage);
+	default:
+		UE_LOG(LogFCompiledGameDataWriter, Error, TEXT("Failed to compile game data. Only JSON and MessagePack game data could be compiled."));
+		return false;
+	}
+}
+
+bool FCompiledGameDataWriter::CompileFile(const FString& SourceFilePath, const TArrayView<const uint8> SourceBuffer, EGameDataFormat SourceFormat, TArray<uint8>& OutImage)
+{
+	if (!Compile(SourceBuffer, SourceFormat, OutImage))
+	{
+		return false;
+	}
+
+	const FString CompiledFilePath = GetCompiledFilePath(SourceFilePath);
+	if (!FFileHelper::SaveArrayToFile(OutImage, *CompiledFilePath))
+	{
+		UE_LOG(LogFCompiledGameDataWriter, Warning, TEXT("Failed to save compiled game data to '%s'."), *CompiledFilePath);
+		return true;
+	}
+
+	UE_LOG(LogFCompiledGameDataWriter, Log, TEXT("Compiled game data '%s' into '%s' (%d bytes)."), *SourceFilePath, *CompiledFilePath, OutImage.Num());
+	return true;
+}
+
+bool FCompiledGameDataWriter::IsCompiledFrom(const TArrayView<const uint8> Image, const TArrayView<const uint8> SourceBuffer)
+{
+	FCompiledGameDataHeader Header;
+	if (!FCompiledGameDataReader::ReadHeader(Image, Header))
+	{
+		return false;
+	}
+	const FSHAHash SourceHash = GetSourceHash(SourceBuffer);
+	return FMemory::Memcmp(Header.SourceHash, SourceHash.Hash, FCompiledGameDataFormat::SourceHashSize) == 0;
+}
+
+bool FCompiledGameDataWriter::IsCompiledFromRevision(const TArrayView<const uint8> Image, const TArrayView<const uint8> SourceBuffer, EGameDataFormat SourceFormat)
+{
+	FString SourceRevisionHash;
+	if (!ReadRevisionHash(SourceBuffer, SourceFormat, SourceRevisionHash))
+	{
+		return IsCompiledFrom(Image, SourceBuffer);
+	}
+	FString ImageRevisionHash;
+	return ReadRevisionHash(Image, EGameDataFormat::Compiled, ImageRevisionHash) && ImageRevisionHash == SourceRevisionHash;
+}
+
+bool FCompiledGameDataWriter::ReadRevisionHash(const TArrayView<const uint8> GameDataBuffer, EGameDataFormat Format, FString& OutRevisionHash)
+{
+	TSharedPtr<IGameDataReader> GameDataReader;
+	switch (Format)
+	{
+	case EGameDataFormat::Json: GameDataReader = FGameDataReaderFactory::CreateJsonReader(GameDataBuffer); break;
+	case EGameDataFormat::MessagePack: GameDataReader = FGameDataReaderFactory::CreateMessagePackReader(GameDataBuffer); break;
+	case EGameDataFormat::Compiled: GameDataReader = FGameDataReaderFactory::CreateCompiledReader(GameDataBuffer); break;
+	default: return false;
+	}
+
+	GameDataReader->ReadNext(); // initialize reader and move to first token
+	if (GameDataReader->GetNotation() != EJsonNotation::ObjectStart)
+	{
+		return false;
+	}
+	GameDataReader->ReadNext();
+	while (GameDataReader->GetNotation() != EJsonNotation::ObjectEnd && !GameDataReader->IsError())
+	{
+		if (GameDataReader->GetNotation() == EJsonNotation::String && GameDataReader->GetIdentifierView() == TEXTVIEW("RevisionHash"))
+		{
+			OutRevisionHash = GameDataReader->GetValueAsString();
+			return !OutRevisionHash.IsEmpty();
+		}
+		GameDataReader->SkipAny();
+	}
+	return false;
+}
+
+FSHAHash FCompiledGameDataWriter::GetSourceHash(const TArrayView<const uint8> SourceBuffer)
+{
+	FSHAHash SourceHash;
+	FSHA1::HashBuffer(SourceBuffer.GetData(), SourceBuffer.Num(), SourceHash.Hash);
+	return SourceHash;
+}
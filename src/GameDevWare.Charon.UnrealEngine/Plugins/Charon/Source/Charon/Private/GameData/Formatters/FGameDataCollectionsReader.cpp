@@ -0,0 +1,164 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/Formatters/FGameDataCollectionsReader.h"
+
+#include "GameData/Formatters/FCompiledGameDataWriter.h"
+#include "GameData/Formatters/FGameDataReaderFactory.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformProcess.h"
+
+FGameDataCollectionsReader::FGameDataCollectionsReader(const TSharedRef<IGameDataReader>& Reader, const int64 MinParallelSize)
+	: Reader(Reader)
+	  , CollectionReader()
+	  , Collections()
+	  , CollectionIndex(-1)
+	  , MinParallelSize(MinParallelSize)
+	  , IsSequential(true)
+	  , IsDecodedInParallel(false)
+	  , ErrorMessage()
+{
+}
+
+bool FGameDataCollectionsReader::ReadBegin()
+{
+	const uint8* TokenStart = nullptr;
+	const uint8* TokenEnd = nullptr;
+	if (!Reader->GetRawTokenBounds(TokenStart, TokenEnd))
+	{
+		// stream reader, read collections as they go
+		IsSequential = true;
+		CollectionReader = Reader;
+		if (!Reader->ReadObjectBegin())
+		{
+			SetErrorMessage(Reader->GetErrorMessage());
+			return false;
+		}
+		return true;
+	}
+	IsSequential = false;
+
+	// pre-scan collections' byte ranges with source reader, their content is skipped without tokenizing
+	Reader->ReadObjectBegin();
+	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	{
+		if (Reader->IsError())
+		{
+			SetErrorMessage(Reader->GetErrorMessage());
+			return false;
+		}
+
+		FCollection& Collection = Collections.AddDefaulted_GetRef();
+		Collection.Name = Reader->ReadMember();
+		if (!Reader->ReadRawValue(Collection.RawValue))
+		{
+			SetErrorMessage(Reader->GetErrorMessage());
+			return false;
+		}
+	}
+	Reader->ReadObjectEnd();
+	if (Reader->IsError())
+	{
+		SetErrorMessage(Reader->GetErrorMessage());
+		return false;
+	}
+
+	int64 TotalSize = 0;
+	for (const FCollection& Collection : Collections)
+	{
+		TotalSize += Collection.RawValue.Num();
+	}
+	// compiled game data is already in form collections are compiled into
+	if (Collections.Num() > 1 && TotalSize >= MinParallelSize && FPlatformProcess::SupportsMultithreading() &&
+		Reader->GetReaderType() != EGameDataReaderType::Compiled)
+	{
+		DecodeCollections();
+	}
+	return true;
+}
+
+void FGameDataCollectionsReader::DecodeCollections()
+{
+	IsDecodedInParallel = true;
+	ParallelFor(Collections.Num(), [this](const int32 Index)
+	{
+		FCollection& Collection = Collections[Index];
+		const TSharedPtr<IGameDataReader> ValueReader = Reader->CreateRawValueReader(Collection.RawValue);
+
+		// image is transient, so it has no source hash
+		if (!ValueReader.IsValid() || !FCompiledGameDataWriter::Write(*ValueReader, FSHAHash(), Collection.CompiledValue))
+		{
+			Collection.CompiledValue.Empty();
+			Collection.ErrorMessage = ValueReader.IsValid() ? ValueReader->GetErrorMessage() : FString();
+			if (Collection.ErrorMessage.IsEmpty())
+			{
+				Collection.ErrorMessage = FString::Printf(TEXT("Failed to decode '%s' collection."), *Collection.Name);
+			}
+		}
+	});
+}
+
+bool FGameDataCollectionsReader::ReadNextCollection(FStringView& CollectionName)
+{
+	if (IsError())
+	{
+		return false;
+	}
+
+	if (IsSequential)
+	{
+		if (Reader->IsError())
+		{
+			SetErrorMessage(Reader->GetErrorMessage());
+			return false;
+		}
+		if (Reader->GetNotation() == EJsonNotation::ObjectEnd)
+		{
+			Reader->ReadObjectEnd();
+			return false;
+		}
+		CollectionName = Reader->ReadMemberView();
+		return !Reader->IsError();
+	}
+
+	// previous collection is read, release its memory after reader which points into it
+	CollectionReader.Reset();
+	if (Collections.IsValidIndex(CollectionIndex))
+	{
+		Collections[CollectionIndex].CompiledValue.Empty();
+	}
+
+	CollectionIndex++;
+	if (!Collections.IsValidIndex(CollectionIndex))
+	{
+		return false;
+	}
+
+	const FCollection& Collection = Collections[CollectionIndex];
+	if (!Collection.ErrorMessage.IsEmpty())
+	{
+		SetErrorMessage(Collection.ErrorMessage);
+		return false;
+	}
+
+	if (Collection.CompiledValue.Num() > 0)
+	{
+		CollectionReader = FGameDataReaderFactory::CreateCompiledReader(TArrayView<const uint8>(Collection.CompiledValue));
+	}
+	else
+	{
+		CollectionReader = Reader->CreateRawValueReader(Collection.RawValue);
+	}
+	if (!CollectionReader.IsValid())
+	{
+		SetErrorMessage(FString::Printf(TEXT("Failed to read '%s' collection."), *Collection.Name));
+		return false;
+	}
+	CollectionReader->ReadNext(); // collection's value
+	CollectionName = Collection.Name;
+	return !CollectionReader->IsError();
+}
+
+void FGameDataCollectionsReader::SetErrorMessage(const FString& Message)
+{
+	ErrorMessage = Message.IsEmpty() ? TEXT("Failed to read collections.") : Message;
+}
@@ -2,6 +2,22 @@
 
 #include "GameData/Formatters/FJsonGameDataReader.h"
 
+// integers above 2^53 can't be represented exactly by double, so they are parsed from original number text
+static constexpr double FJsonGameDataReader_MaxExactInteger = 9007199254740992.0;
+
+static bool FJsonGameDataReader_IsIntegerText(const FString& NumberText)
+{
+	for (int32 Index = 0; Index < NumberText.Len(); ++Index)
+	{
+		const TCHAR Char = NumberText[Index];
+		if (!FChar::IsDigit(Char) && !(Index == 0 && Char == TEXT('-')))
+		{
+			return false;
+		}
+	}
+	return !NumberText.IsEmpty();
+}
+
 FJsonGameDataReader::FJsonGameDataReader(FArchive* const Stream)
 	: Notation(EJsonNotation::Null)
 	  , ErrorMessage()
@@ -29,7 +45,17 @@ const FString& FJsonGameDataReader::GetIdentifier() const
 	return JsonReader->GetIdentifier();
 }
 
-const FString FJsonGameDataReader::GetValueAsString() const
+const FString& FJsonGameDataReader::GetValueAsString() const
+{
+	return JsonReader->GetValueAsString();
+}
+
+FStringView FJsonGameDataReader::GetIdentifierView() const
+{
+	return JsonReader->GetIdentifier();
+}
+
+FStringView FJsonGameDataReader::GetValueAsStringView() const
 {
 	return JsonReader->GetValueAsString();
 }
@@ -39,6 +65,36 @@ double FJsonGameDataReader::GetValueAsNumber() const
 	return JsonReader->GetValueAsNumber();
 }
 
+int64 FJsonGameDataReader::GetValueAsInt64()
+{
+	if (Notation == EJsonNotation::Number)
+	{
+		const double Number = JsonReader->GetValueAsNumber();
+		const FString& NumberText = JsonReader->GetValueAsNumberString();
+		if (FMath::Abs(Number) < FJsonGameDataReader_MaxExactInteger || !FJsonGameDataReader_IsIntegerText(NumberText))
+		{
+			return static_cast<int64>(Number);
+		}
+		return FCString::Atoi64(*NumberText);
+	}
+	return IGameDataReader::GetValueAsInt64();
+}
+
+uint64 FJsonGameDataReader::GetValueAsUInt64()
+{
+	if (Notation == EJsonNotation::Number)
+	{
+		const double Number = JsonReader->GetValueAsNumber();
+		const FString& NumberText = JsonReader->GetValueAsNumberString();
+		if (FMath::Abs(Number) < FJsonGameDataReader_MaxExactInteger || !FJsonGameDataReader_IsIntegerText(NumberText))
+		{
+			return Number < 0 ? static_cast<uint64>(static_cast<int64>(Number)) : static_cast<uint64>(Number);
+		}
+		return FCString::Strtoui64(*NumberText, nullptr, 10);
+	}
+	return IGameDataReader::GetValueAsUInt64();
+}
+
 bool FJsonGameDataReader::GetValueAsBoolean() const
 {
 	return JsonReader->GetValueAsBoolean();
@@ -100,6 +100,10 @@ FJsonObjectGameDataReader::FJsonObjectGameDataReader(const TSharedPtr<FJsonObjec
 	  , ErrorMessage()
 	  , StringValue()
 	  , NumberValue(0.0f)
+	  , Int64Value(0)
+	  , UInt64Value(0)
+	  , HasInt64Value(false)
+	  , HasUInt64Value(false)
 	  , BoolValue(false)
 	  , FinishedReadingRootObject(false)
 {
@@ -164,10 +168,17 @@ bool FJsonObjectGameDataReader::ReadNext()
 			TopFrame.NextMemberOrItem();
 			return true;
 		case EJsonToken::Number:
-			Notation = EJsonNotation::Number;
-			TopFrame.GetCurrentValue().Get()->TryGetNumber(this->NumberValue);
-			TopFrame.NextMemberOrItem();
-			return true;
+			{
+				Notation = EJsonNotation::Number;
+				const TSharedPtr<FJsonValue> NumberJsonValue = TopFrame.GetCurrentValue();
+				NumberJsonValue->TryGetNumber(this->NumberValue);
+				// fractional numbers are left to IGameDataReader's truncation, TryGetNumber(int64) would round them
+				const bool IsIntegral = FMath::TruncToDouble(this->NumberValue) == this->NumberValue;
+				HasInt64Value = IsIntegral && NumberJsonValue->TryGetNumber(this->Int64Value);
+				HasUInt64Value = IsIntegral && !HasInt64Value && NumberJsonValue->TryGetNumber(this->UInt64Value);
+				TopFrame.NextMemberOrItem();
+				return true;
+			}
 		case EJsonToken::False:
 		case EJsonToken::True:
 			Notation = EJsonNotation::Boolean;
@@ -179,8 +190,13 @@ bool FJsonObjectGameDataReader::ReadNext()
 			TopFrame.NextMemberOrItem();
 			return true;
 		case EJsonToken::Identifier:
-			this->Identifier = FString(TopFrame.GetCurrentMemberName());
-			continue;
+			{
+				// reuse identifier's buffer instead of allocating new string for each member
+				const auto& MemberName = TopFrame.GetCurrentMemberName();
+				this->Identifier.Reset();
+				this->Identifier.AppendChars(*MemberName, MemberName.Len());
+				continue;
+			}
 		case EJsonToken::None:
 			break;
 		case EJsonToken::Comma:
@@ -198,7 +214,19 @@ const FString& FJsonObjectGameDataReader::GetIdentifier() const
 	return Identifier;
 }
 
-const FString FJsonObjectGameDataReader::GetValueAsString() const
+const FString& FJsonObjectGameDataReader::GetValueAsString() const
+{
+	check(CurrentToken == EJsonToken::String);
+
+	return StringValue;
+}
+
+FStringView FJsonObjectGameDataReader::GetIdentifierView() const
+{
+	return Identifier;
+}
+
+FStringView FJsonObjectGameDataReader::GetValueAsStringView() const
 {
 	check(CurrentToken == EJsonToken::String);
 
@@ -212,6 +240,38 @@ double FJsonObjectGameDataReader::GetValueAsNumber() const
 	return NumberValue;
 }
 
+int64 FJsonObjectGameDataReader::GetValueAsInt64()
+{
+	if (CurrentToken == EJsonToken::Number)
+	{
+		if (HasInt64Value)
+		{
+			return Int64Value;
+		}
+		if (HasUInt64Value)
+		{
+			return static_cast<int64>(UInt64Value);
+		}
+	}
+	return IGameDataReader::GetValueAsInt64();
+}
+
+uint64 FJsonObjectGameDataReader::GetValueAsUInt64()
+{
+	if (CurrentToken == EJsonToken::Number)
+	{
+		if (HasUInt64Value)
+		{
+			return UInt64Value;
+		}
+		if (HasInt64Value)
+		{
+			return static_cast<uint64>(Int64Value);
+		}
+	}
+	return IGameDataReader::GetValueAsUInt64();
+}
+
 bool FJsonObjectGameDataReader::GetValueAsBoolean() const
 {
 	check((CurrentToken == EJsonToken::True) || (CurrentToken == EJsonToken::False));
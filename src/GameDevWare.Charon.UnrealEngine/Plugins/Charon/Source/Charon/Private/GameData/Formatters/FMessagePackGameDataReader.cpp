@@ -74,24 +74,320 @@ void FMessagePackGameDataReader::PushClosingTokenCounter(EJsonNotation ClosingNo
 	ParseState.Push(NewState);
 }
 
-void FMessagePackGameDataReader::ReadBytes(TArray<uint8>& Buffer, const int32 NumBytes) const
+bool FMessagePackGameDataReader::IsAtEnd() const
 {
-	Buffer.SetNumUninitialized(NumBytes);
-	for (int32 Index = 0; Index < NumBytes; ++Index)
+	if (Stream != nullptr)
 	{
-		(*Stream) << Buffer[Index];
+		return Stream->AtEnd();
 	}
+	return Position >= BufferLength;
+}
+
+bool FMessagePackGameDataReader::ReadRaw(void* Destination, const int64 NumBytes)
+{
+	if (Stream != nullptr)
+	{
+		Stream->Serialize(Destination, NumBytes);
+		if (Stream->IsError())
+		{
+			SetErrorMessage(TEXT("Unexpected end of data."));
+			return false;
+		}
+		return true;
+	}
+
+	if (NumBytes > BufferLength - Position)
+	{
+		FMemory::Memzero(Destination, NumBytes);
+		Position = BufferLength;
+		SetErrorMessage(TEXT("Unexpected end of data."));
+		return false;
+	}
+	FMemory::Memcpy(Destination, Buffer + Position, NumBytes);
+	Position += NumBytes;
+	return true;
+}
+
+bool FMessagePackGameDataReader::ReadBytes(const uint8*& Bytes, const int64 NumBytes)
+{
+	if (NumBytes < 0 || NumBytes > MAX_int32)
+	{
+		SetErrorMessage(TEXT("Data length is out of range."));
+		return false;
+	}
+
+	if (Stream != nullptr)
+	{
+		// length is checked against rest of stream, so corrupted length is not allocated in scratch buffer
+		const int64 TotalSize = Stream->TotalSize();
+		if (TotalSize >= 0 && NumBytes > TotalSize - Stream->Tell())
+		{
+			SetErrorMessage(TEXT("Unexpected end of data."));
+			return false;
+		}
+
+		// one bulk read into reusable scratch buffer instead of per-byte pulls, bytes are valid until next ReadBytes() call
+		if (ScratchBytes.Num() < NumBytes)
+		{
+			ScratchBytes.SetNumUninitialized(static_cast<int32>(NumBytes));
+		}
+		Bytes = ScratchBytes.GetData();
+		return NumBytes == 0 || ReadRaw(ScratchBytes.GetData(), NumBytes);
+	}
+
+	if (NumBytes > BufferLength - Position)
+	{
+		Position = BufferLength;
+		SetErrorMessage(TEXT("Unexpected end of data."));
+		return false;
+	}
+	Bytes = Buffer + Position;
+	Position += NumBytes;
+	return true;
+}
+
+bool FMessagePackGameDataReader::ReadUtf8String(FString& Value, const int64 NumBytes)
+{
+	const uint8* Utf8StringBytes = nullptr;
+	if (!ReadBytes(Utf8StringBytes, NumBytes))
+	{
+		return false;
+	}
+
+	Value.Reset(NumBytes);
+	if (NumBytes > 0)
+	{
+		const FUTF8ToTCHAR Utf8String(reinterpret_cast<const ANSICHAR*>(Utf8StringBytes), static_cast<int32>(NumBytes));
+		Value.AppendChars(Utf8String.Get(), Utf8String.Length());
+	}
+	return true;
+}
+
+bool FMessagePackGameDataReader::SkipRaw(const int64 NumBytes)
+{
+	if (Stream != nullptr)
+	{
+		// discard through scratch buffer in bounded chunks
+		int64 RemainingBytes = NumBytes;
+		while (RemainingBytes > 0)
+		{
+			const int64 ChunkSize = FMath::Min<int64>(RemainingBytes, 64 * 1024);
+			const uint8* DiscardedBytes = nullptr;
+			if (!ReadBytes(DiscardedBytes, ChunkSize))
+			{
+				return false;
+			}
+			RemainingBytes -= ChunkSize;
+		}
+		return true;
+	}
+
+	if (NumBytes > BufferLength - Position)
+	{
+		Position = BufferLength;
+		SetErrorMessage(TEXT("Unexpected end of data."));
+		return false;
+	}
+	Position += NumBytes;
+	return true;
+}
+
+bool FMessagePackGameDataReader::SkipRawValues(uint64 Count)
+{
+	// map members and array items are counted as plain values, nested containers add their sizes to the count
+	while (Count > 0)
+	{
+		Count--;
+
+		int64 PayloadSize = 0;
+		const uint8 FormatValue = ReadUInt8();
+		if (FormatValue <= static_cast<uint8>(EMessagePackType::PositiveFixIntEnd) ||
+			FormatValue >= static_cast<uint8>(EMessagePackType::NegativeFixIntStart))
+		{
+			// value is in format byte
+		}
+		else if (FormatValue >= static_cast<uint8>(EMessagePackType::FixMapStart) && FormatValue <= static_cast<uint8>(EMessagePackType::FixMapEnd))
+		{
+			Count += 2 * (FormatValue - static_cast<uint8>(EMessagePackType::FixMapStart));
+		}
+		else if (FormatValue >= static_cast<uint8>(EMessagePackType::FixArrayStart) && FormatValue <= static_cast<uint8>(EMessagePackType::FixArrayEnd))
+		{
+			Count += FormatValue - static_cast<uint8>(EMessagePackType::FixArrayStart);
+		}
+		else if (FormatValue >= static_cast<uint8>(EMessagePackType::FixStrStart) && FormatValue <= static_cast<uint8>(EMessagePackType::FixStrEnd))
+		{
+			PayloadSize = FormatValue - static_cast<uint8>(EMessagePackType::FixStrStart);
+		}
+		else
+		{
+			switch (static_cast<EMessagePackType>(FormatValue))
+			{
+			case EMessagePackType::Null:
+			case EMessagePackType::False:
+			case EMessagePackType::True:
+				break;
+			case EMessagePackType::Int8:
+			case EMessagePackType::UInt8:
+				PayloadSize = 1;
+				break;
+			case EMessagePackType::Int16:
+			case EMessagePackType::UInt16:
+				PayloadSize = 2;
+				break;
+			case EMessagePackType::Int32:
+			case EMessagePackType::UInt32:
+			case EMessagePackType::Float32:
+				PayloadSize = 4;
+				break;
+			case EMessagePackType::Int64:
+			case EMessagePackType::UInt64:
+			case EMessagePackType::Float64:
+				PayloadSize = 8;
+				break;
+			case EMessagePackType::Str8:
+			case EMessagePackType::Bin8:
+			case EMessagePackType::Ext8:
+				PayloadSize = ReadUInt8();
+				break;
+			case EMessagePackType::Str16:
+			case EMessagePackType::Bin16:
+			case EMessagePackType::Ext16:
+				PayloadSize = ReadBeUInt16();
+				break;
+			case EMessagePackType::Str32:
+			case EMessagePackType::Bin32:
+			case EMessagePackType::Ext32:
+				PayloadSize = ReadBeUInt32();
+				break;
+			// extension payload layout is the same as in ReadNext()
+			case EMessagePackType::FixExt1: PayloadSize = 1; break;
+			case EMessagePackType::FixExt2: PayloadSize = 2; break;
+			case EMessagePackType::FixExt4: PayloadSize = 4; break;
+			case EMessagePackType::FixExt8: PayloadSize = 8; break;
+			case EMessagePackType::FixExt16: PayloadSize = 16; break;
+			case EMessagePackType::Array16:
+				Count += ReadBeUInt16();
+				break;
+			case EMessagePackType::Array32:
+				Count += ReadBeUInt32();
+				break;
+			case EMessagePackType::Map16:
+				Count += 2ull * ReadBeUInt16();
+				break;
+			case EMessagePackType::Map32:
+				Count += 2ull * ReadBeUInt32();
+				break;
+			default:
+				SetErrorMessage(TEXT("Unexpected Message Pack notation."));
+				return false;
+			}
+		}
+
+		if (!ErrorMessage.IsEmpty())
+		{
+			// truncated length prefix
+			return false;
+		}
+		if (PayloadSize > 0 && !SkipRaw(PayloadSize))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FMessagePackGameDataReader::DecodePendingStringValue() const
+{
+	switch (PendingStringValue)
+	{
+	case EPendingStringValue::Utf8:
+		if (PendingStringValueLength > 0)
+		{
+			const FUTF8ToTCHAR Utf8String(reinterpret_cast<const ANSICHAR*>(PendingStringValueBytes), static_cast<int32>(PendingStringValueLength));
+			StringValue.AppendChars(Utf8String.Get(), Utf8String.Length());
+		}
+		break;
+	case EPendingStringValue::Binary:
+		StringValue = FBase64::Encode(PendingStringValueBytes, PendingStringValueLength);
+		break;
+	case EPendingStringValue::SignedInteger:
+		StringValue = FString::Printf(TEXT("%lld"), Int64Value);
+		break;
+	case EPendingStringValue::UnsignedInteger:
+		StringValue = FString::Printf(TEXT("%llu"), UInt64Value);
+		break;
+	case EPendingStringValue::None:
+	default:
+		return;
+	}
+	PendingStringValue = EPendingStringValue::None;
+}
+
+void FMessagePackGameDataReader::SetIntegerValue(const int64 Value)
+{
+	Int64Value = Value;
+	UInt64Value = static_cast<uint64>(Value);
+	HasIntegerValue = true;
+	NumberValue = static_cast<double>(Value);
+	Notation = EJsonNotation::Number;
+	CurrentToken = EJsonToken::Number;
+}
+
+void FMessagePackGameDataReader::SetUnsignedIntegerValue(const uint64 Value)
+{
+	Int64Value = static_cast<int64>(Value);
+	UInt64Value = Value;
+	HasIntegerValue = true;
+	NumberValue = static_cast<double>(Value);
+	Notation = EJsonNotation::Number;
+	CurrentToken = EJsonToken::Number;
 }
 
 FMessagePackGameDataReader::FMessagePackGameDataReader(FArchive* const Stream)
 	: Stream(Stream)
+	  , Buffer(nullptr)
+	  , BufferLength(0)
+	  , Position(0)
+	  , TokenStart(0)
+	  , ScratchBytes()
 	  , ParseState()
 	  , Notation(EJsonNotation::Null)
 	  , CurrentToken(EJsonToken::None)
 	  , Identifier()
 	  , ErrorMessage()
 	  , StringValue()
+	  , PendingStringValueBytes(nullptr)
+	  , PendingStringValueLength(0)
+	  , PendingStringValue(EPendingStringValue::None)
 	  , NumberValue(0.0f)
+	  , Int64Value(0)
+	  , UInt64Value(0)
+	  , HasIntegerValue(false)
+	  , BoolValue(false)
+	  , FinishedReadingRootObject(false)
+{
+}
+
+FMessagePackGameDataReader::FMessagePackGameDataReader(const TArrayView<const uint8> Buffer)
+	: Stream(nullptr)
+	  , Buffer(Buffer.GetData())
+	  , BufferLength(Buffer.Num())
+	  , Position(0)
+	  , TokenStart(0)
+	  , ScratchBytes()
+	  , ParseState()
+	  , Notation(EJsonNotation::Null)
+	  , CurrentToken(EJsonToken::None)
+	  , Identifier()
+	  , ErrorMessage()
+	  , StringValue()
+	  , PendingStringValueBytes(nullptr)
+	  , PendingStringValueLength(0)
+	  , PendingStringValue(EPendingStringValue::None)
+	  , NumberValue(0.0f)
+	  , Int64Value(0)
+	  , UInt64Value(0)
+	  , HasIntegerValue(false)
 	  , BoolValue(false)
 	  , FinishedReadingRootObject(false)
 {
@@ -106,7 +402,7 @@ bool FMessagePackGameDataReader::ReadNext()
 		return false;
 	}
 
-	if (Stream == nullptr)
+	if (Stream == nullptr && Buffer == nullptr)
 	{
 		Notation = EJsonNotation::Error;
 		CurrentToken = EJsonToken::None;
@@ -118,8 +414,14 @@ bool FMessagePackGameDataReader::ReadNext()
 	Notation = EJsonNotation::Null;
 	CurrentToken = EJsonToken::None;
 	ErrorMessage.Empty();
-	StringValue.Empty();
+	StringValue.Reset();
+	PendingStringValueBytes = nullptr;
+	PendingStringValueLength = 0;
+	PendingStringValue = EPendingStringValue::None;
 	NumberValue = 0;
+	Int64Value = 0;
+	UInt64Value = 0;
+	HasIntegerValue = false;
 	BoolValue = false;
 	//
 		
@@ -146,7 +448,7 @@ bool FMessagePackGameDataReader::ReadNext()
 		return true;
 	}
 
-	const bool AtEndOfStream = Stream->AtEnd();
+	const bool AtEndOfStream = IsAtEnd();
 	if (AtEndOfStream && !FinishedReadingRootObject)
 	{
 		Notation = EJsonNotation::Error;
@@ -170,9 +472,10 @@ bool FMessagePackGameDataReader::ReadNext()
 
 	if (PeekParseMapState() != EMessagePackParseMemberState::ValueExpected)
 	{
-		Identifier.Empty();
+		Identifier.Reset();
 	}
 
+	TokenStart = Position;
 	uint8 FormatValue = ReadUInt8();
 	if (FormatValue >= static_cast<uint8>(EMessagePackType::FixArrayStart) && FormatValue <= static_cast<uint8>(EMessagePackType::FixArrayEnd))
 	{
@@ -184,22 +487,29 @@ bool FMessagePackGameDataReader::ReadNext()
 	else if (FormatValue >= static_cast<uint8>(EMessagePackType::FixStrStart) && FormatValue <= static_cast<uint8>(EMessagePackType::FixStrEnd))
 	{
 		const auto Utf8StringSize = static_cast<int>(FormatValue) - static_cast<int>(EMessagePackType::FixStrStart);
-		TArray<uint8> Utf8StringBytes;
-		ReadBytes(Utf8StringBytes, Utf8StringSize);
-		Utf8StringBytes.Add(0);
-		
-		auto Utf8String = FString(UTF8_TO_TCHAR(Utf8StringBytes.GetData()));
-
 		if (PeekParseMapState() == EMessagePackParseMemberState::MemberNameExpected)
 		{
-			DecrementClosingTokenCounter();
+			if (!ReadUtf8String(Identifier, Utf8StringSize))
+			{
+				Notation = EJsonNotation::Error;
+				CurrentToken = EJsonToken::None;
+				return true;
+			}
 
-			Identifier = Utf8String;
+			DecrementClosingTokenCounter();
 
 			return ReadNext();
 		}
 
-		StringValue = Utf8String;
+		if (!ReadBytes(PendingStringValueBytes, Utf8StringSize))
+		{
+			Notation = EJsonNotation::Error;
+			CurrentToken = EJsonToken::None;
+			return true;
+		}
+		PendingStringValueLength = Utf8StringSize;
+		PendingStringValue = EPendingStringValue::Utf8;
+
 		Notation = EJsonNotation::String;
 		CurrentToken = EJsonToken::String;
 	}
@@ -213,15 +523,11 @@ bool FMessagePackGameDataReader::ReadNext()
 	}
 	else if (FormatValue >= static_cast<uint8>(EMessagePackType::NegativeFixIntStart))
 	{
-		NumberValue = *reinterpret_cast<int8*>(&FormatValue);
-		Notation = EJsonNotation::Number;
-		CurrentToken = EJsonToken::Number;
+		SetIntegerValue(*reinterpret_cast<int8*>(&FormatValue));
 	}
 	else if (FormatValue <= static_cast<uint8>(EMessagePackType::PositiveFixIntEnd))
 	{
-		NumberValue = FormatValue;
-		Notation = EJsonNotation::Number;
-		CurrentToken = EJsonToken::Number;
+		SetUnsignedIntegerValue(FormatValue);
 	}
 	else
 	{
@@ -273,7 +579,7 @@ bool FMessagePackGameDataReader::ReadNext()
 		case EMessagePackType::Str32:
 		case EMessagePackType::Str8:
 			{
-				auto Utf8StringSize = 0L;
+				uint32 Utf8StringSize = 0;
 				if (FormatValue == static_cast<uint8>(EMessagePackType::Str8))
 				{
 					Utf8StringSize = ReadUInt8();
@@ -295,21 +601,29 @@ bool FMessagePackGameDataReader::ReadNext()
 					return true;
 				}
 
-				TArray<uint8> Utf8StringBytes;
-				ReadBytes(Utf8StringBytes, Utf8StringSize);
-				Utf8StringBytes.Add(0);
-				auto Utf8String = FString(UTF8_TO_TCHAR(Utf8StringBytes.GetData()));
-
 				if (PeekParseMapState() == EMessagePackParseMemberState::MemberNameExpected)
 				{
-					DecrementClosingTokenCounter();
+					if (!ReadUtf8String(Identifier, Utf8StringSize))
+					{
+						Notation = EJsonNotation::Error;
+						CurrentToken = EJsonToken::None;
+						return true;
+					}
 
-					Identifier = Utf8String;
+					DecrementClosingTokenCounter();
 
 					return ReadNext();
 				}
 
-				StringValue = Utf8String;
+				if (!ReadBytes(PendingStringValueBytes, Utf8StringSize))
+				{
+					Notation = EJsonNotation::Error;
+					CurrentToken = EJsonToken::None;
+					return true;
+				}
+				PendingStringValueLength = Utf8StringSize;
+				PendingStringValue = EPendingStringValue::Utf8;
+
 				Notation = EJsonNotation::String;
 				CurrentToken = EJsonToken::String;
 				break;
@@ -318,7 +632,7 @@ bool FMessagePackGameDataReader::ReadNext()
 		case EMessagePackType::Bin16:
 		case EMessagePackType::Bin8:
 			{
-				auto BinarySize = 0L;
+				uint32 BinarySize = 0;
 				if (FormatValue == static_cast<uint8>(EMessagePackType::Bin8))
 				{
 					BinarySize = ReadUInt8();
@@ -340,11 +654,14 @@ bool FMessagePackGameDataReader::ReadNext()
 					return true;
 				}
 
-				TArray<uint8> BinaryBytes;
-				ReadBytes(BinaryBytes, BinarySize);
-				auto BinaryBase64 = FBase64::Encode(BinaryBytes);
-
-				StringValue = BinaryBase64;
+				if (!ReadBytes(PendingStringValueBytes, BinarySize))
+				{
+					Notation = EJsonNotation::Error;
+					CurrentToken = EJsonToken::None;
+					return true;
+				}
+				PendingStringValueLength = BinarySize;
+				PendingStringValue = EPendingStringValue::Binary;
 				Notation = EJsonNotation::String;
 				CurrentToken = EJsonToken::String;
 				break;
@@ -400,11 +717,14 @@ bool FMessagePackGameDataReader::ReadNext()
 					return true;
 				}
 
-				TArray<uint8> ExtBytes;
-				ReadBytes(ExtBytes, ExtSize);
-				auto ExtBase64 = FBase64::Encode(ExtBytes);
-
-				StringValue = ExtBase64;
+				if (!ReadBytes(PendingStringValueBytes, ExtSize))
+				{
+					Notation = EJsonNotation::Error;
+					CurrentToken = EJsonToken::None;
+					return true;
+				}
+				PendingStringValueLength = ExtSize;
+				PendingStringValue = EPendingStringValue::Binary;
 				Notation = EJsonNotation::String;
 				CurrentToken = EJsonToken::String;
 				break;
@@ -430,77 +750,55 @@ bool FMessagePackGameDataReader::ReadNext()
 			CurrentToken = EJsonToken::Number;
 			break;
 		case EMessagePackType::Int8:
-			NumberValue = ReadInt8();
-			Notation = EJsonNotation::Number;
-			CurrentToken = EJsonToken::Number;
+			SetIntegerValue(ReadInt8());
 			break;
 		case EMessagePackType::Int16:
 			{
-				NumberValue = ReadBeInt16();
-				Notation = EJsonNotation::Number;
-				CurrentToken = EJsonToken::Number;
+				SetIntegerValue(ReadBeInt16());
 				break;
 			}
 		case EMessagePackType::Int32:
 			{
-				NumberValue = ReadBeInt32();
-				Notation = EJsonNotation::Number;
-				CurrentToken = EJsonToken::Number;
+				SetIntegerValue(ReadBeInt32());
 				break;
 			}
 		case EMessagePackType::Int64:
 			{
-				int64 Int64Value = ReadBeInt64();
+				SetIntegerValue(ReadBeInt64());
 				if (Int64Value >= INT32_MAX || Int64Value <= INT32_MIN)
 				{
-					StringValue = FString::Printf(TEXT("%lld"), Int64Value);
+					// exposed as string token for readers without GetValueAsInt64(), text is formatted on demand
+					PendingStringValue = EPendingStringValue::SignedInteger;
 					Notation = EJsonNotation::String;
 					CurrentToken = EJsonToken::String;
 				}
-				else
-				{
-					NumberValue = Int64Value;
-					Notation = EJsonNotation::Number;
-					CurrentToken = EJsonToken::Number;
-				}
 				break;
 			}
 		case EMessagePackType::UInt8:
 			{
-				NumberValue = ReadUInt8();
-				Notation = EJsonNotation::Number;
-				CurrentToken = EJsonToken::Number;
+				SetUnsignedIntegerValue(ReadUInt8());
 				break;
 			}
 		case EMessagePackType::UInt16:
 			{
-				NumberValue = ReadBeUInt16();
-				Notation = EJsonNotation::Number;
-				CurrentToken = EJsonToken::Number;
+				SetUnsignedIntegerValue(ReadBeUInt16());
 				break;
 			}
 		case EMessagePackType::UInt32:
 			{
-				NumberValue = ReadBeUInt32();
-				Notation = EJsonNotation::Number;
-				CurrentToken = EJsonToken::Number;
+				SetUnsignedIntegerValue(ReadBeUInt32());
 				break;
 			}
 		case EMessagePackType::UInt64:
 			{
-				uint64 UInt64Value = ReadBeUInt64();
+				SetUnsignedIntegerValue(ReadBeUInt64());
 				if (UInt64Value >= INT32_MAX)
 				{
-					StringValue = FString::Format(TEXT("{0}"), { UInt64Value });
+					// exposed as string token for readers without GetValueAsUInt64(), text is formatted on demand
+					PendingStringValue = EPendingStringValue::UnsignedInteger;
 					Notation = EJsonNotation::String;
 					CurrentToken = EJsonToken::String;
 				}
-				else
-				{
-					NumberValue = UInt64Value;
-					Notation = EJsonNotation::Number;
-					CurrentToken = EJsonToken::Number;
-				}
 				break;
 			}
 		case EMessagePackType::PositiveFixIntStart:
@@ -522,20 +820,120 @@ bool FMessagePackGameDataReader::ReadNext()
 		}
 	}
 
+	if (!ErrorMessage.IsEmpty())
+	{
+		// truncated fixed-size value
+		Notation = EJsonNotation::Error;
+		CurrentToken = EJsonToken::None;
+		return true;
+	}
+
 	DecrementClosingTokenCounter();
 
+	if (ParseState.Num() == 0 && Notation != EJsonNotation::ObjectStart && Notation != EJsonNotation::ArrayStart)
+	{
+		FinishedReadingRootObject = true; // scalar root value, e.g. from ReadRawValue()
+	}
+
 	return true;
 }
 
-const FString& FMessagePackGameDataReader::GetIdentifier() const
+void FMessagePackGameDataReader::SkipAny(const bool NextToken)
 {
-	return Identifier;
+	if (Notation == EJsonNotation::Error)
+	{
+		return;
+	}
+
+	if ((Notation != EJsonNotation::ObjectStart && Notation != EJsonNotation::ArrayStart) || ParseState.Num() == 0)
+	{
+		ReadNext();
+		return;
+	}
+
+	// container header is already read, so its remaining items are skipped by length prefixes without producing tokens
+	if (!SkipRawValues(static_cast<uint64>(ParseState.Top().Value)))
+	{
+		Notation = EJsonNotation::Error;
+		CurrentToken = EJsonToken::None;
+		return;
+	}
+	ParseState.Top().Value = 0;
+
+	// closing token is read as usual to keep parse state of outer containers
+	if (ReadNext() && NextToken)
+	{
+		ReadNext();
+	}
+}
+
+bool FMessagePackGameDataReader::ReadRawValue(TArrayView<const uint8>& RawValue, const bool NextToken)
+{
+	if (Stream != nullptr)
+	{
+		return false; // consumed bytes are not kept
+	}
+
+	switch (Notation)
+	{
+	case EJsonNotation::ObjectStart:
+	case EJsonNotation::ArrayStart:
+		SkipAny(/* NextToken */ false);
+		if (Notation == EJsonNotation::Error)
+		{
+			return false;
+		}
+		break;
+	case EJsonNotation::String:
+	case EJsonNotation::Number:
+	case EJsonNotation::Boolean:
+	case EJsonNotation::Null:
+		break;
+	default:
+		return false;
+	}
+
+	// synthesized closing token doesn't consume bytes, so Position is right after value
+	RawValue = TArrayView<const uint8>(Buffer + TokenStart, static_cast<int32>(Position - TokenStart));
+	if (NextToken)
+	{
+		ReadNext();
+	}
+	return true;
 }
 
-const FString FMessagePackGameDataReader::GetValueAsString() const
+TSharedPtr<IGameDataReader> FMessagePackGameDataReader::CreateRawValueReader(const TArrayView<const uint8> RawValue) const
+{
+	return MakeShareable(new FMessagePackGameDataReader(RawValue));
+}
+
+bool FMessagePackGameDataReader::GetRawTokenBounds(const uint8*& OutTokenStart, const uint8*& OutTokenEnd) const
+{
+	if (Stream != nullptr || Notation == EJsonNotation::Error)
+	{
+		return false; // consumed bytes are not kept
+	}
+
+	// synthesized closing token doesn't consume bytes, so it is empty and placed right after container's last value
+	const bool IsClosingToken = Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd;
+	OutTokenStart = Buffer + (IsClosingToken ? Position : TokenStart);
+	OutTokenEnd = Buffer + Position;
+	return true;
+}
+
+const FString& FMessagePackGameDataReader::GetValueAsString() const
+{
+	check(CurrentToken == EJsonToken::String);
+
+	DecodePendingStringValue();
+	return StringValue;
+}
+
+FStringView FMessagePackGameDataReader::GetValueAsStringView() const
 {
 	check(CurrentToken == EJsonToken::String);
 
+	DecodePendingStringValue();
 	return StringValue;
 }
 
@@ -546,21 +944,29 @@ double FMessagePackGameDataReader::GetValueAsNumber() const
 	return NumberValue;
 }
 
-bool FMessagePackGameDataReader::GetValueAsBoolean() const
+int64 FMessagePackGameDataReader::GetValueAsInt64()
 {
-	check((CurrentToken == EJsonToken::True) || (CurrentToken == EJsonToken::False));
-
-	return BoolValue;
+	if (HasIntegerValue)
+	{
+		return Int64Value;
+	}
+	return IGameDataReader::GetValueAsInt64();
 }
 
-const FString& FMessagePackGameDataReader::GetErrorMessage() const
+uint64 FMessagePackGameDataReader::GetValueAsUInt64()
 {
-	return ErrorMessage;
+	if (HasIntegerValue)
+	{
+		return UInt64Value;
+	}
+	return IGameDataReader::GetValueAsUInt64();
 }
 
-EJsonNotation FMessagePackGameDataReader::GetNotation()
+bool FMessagePackGameDataReader::GetValueAsBoolean() const
 {
-	return Notation;
+	check((CurrentToken == EJsonToken::True) || (CurrentToken == EJsonToken::False));
+
+	return BoolValue;
 }
 
 void FMessagePackGameDataReader::SetErrorState(const FString& Message)
@@ -599,59 +1005,59 @@ uint8 FMessagePackGameDataReader::PeekParseMapState()
 	}
 }
 
-int8 FMessagePackGameDataReader::ReadInt8() const
+int8 FMessagePackGameDataReader::ReadInt8()
 {
 	int8 leValue = 0;
-	Stream->Serialize(&leValue, 1);
+	ReadRaw(&leValue, 1);
 	return leValue;
 }
 
-uint8 FMessagePackGameDataReader::ReadUInt8() const
+uint8 FMessagePackGameDataReader::ReadUInt8()
 {
 	uint8 leValue = 0;
-	Stream->Serialize(&leValue, 1);
+	ReadRaw(&leValue, 1);
 	return leValue;
 }
 
-int16 FMessagePackGameDataReader::ReadBeInt16() const
+int16 FMessagePackGameDataReader::ReadBeInt16()
 {
 	uint16 beValue = this->ReadBeUInt16();
 	return *reinterpret_cast<int16*>(&beValue);
 }
 
-uint16 FMessagePackGameDataReader::ReadBeUInt16() const
+uint16 FMessagePackGameDataReader::ReadBeUInt16()
 {
 	uint16 leValue = 0;
-	Stream->Serialize(&leValue, 2);
+	ReadRaw(&leValue, 2);
 	return (leValue << 8) | (leValue >> 8);
 }
 
-int32 FMessagePackGameDataReader::ReadBeInt32() const
+int32 FMessagePackGameDataReader::ReadBeInt32()
 {
 	uint32 beValue = this->ReadBeUInt32();
 	return *reinterpret_cast<int32*>(&beValue);
 }
 
-uint32 FMessagePackGameDataReader::ReadBeUInt32() const
+uint32 FMessagePackGameDataReader::ReadBeUInt32()
 {
 	uint32 leValue = 0;
-	Stream->Serialize(&leValue, 4);
+	ReadRaw(&leValue, 4);
 	return ((leValue >> 24) & 0x000000FF) |
 		   ((leValue >>  8) & 0x0000FF00) |
 		   ((leValue <<  8) & 0x00FF0000) |
 		   ((leValue << 24) & 0xFF000000);
 }
 
-int64 FMessagePackGameDataReader::ReadBeInt64() const
+int64 FMessagePackGameDataReader::ReadBeInt64()
 {
 	uint64 beValue = this->ReadBeUInt64();
 	return *reinterpret_cast<int64*>(&beValue);
 }
 
-uint64 FMessagePackGameDataReader::ReadBeUInt64() const
+uint64 FMessagePackGameDataReader::ReadBeUInt64()
 {
 	uint64 leValue = 0;
-	Stream->Serialize(&leValue, 8);
+	ReadRaw(&leValue, 8);
 	return ((leValue >> 56) & 0x00000000000000FF) |
 		   ((leValue >> 40) & 0x000000000000FF00) |
 		   ((leValue >> 24) & 0x0000000000FF0000) |
@@ -662,13 +1068,13 @@ uint64 FMessagePackGameDataReader::ReadBeUInt64() const
 		   ((leValue << 56) & 0xFF00000000000000);
 }
 
-float FMessagePackGameDataReader::ReadBeFloat32() const
+float FMessagePackGameDataReader::ReadBeFloat32()
 {
 	uint32 beValue = ReadBeUInt32();
 	return *reinterpret_cast<float*>(&beValue);
 }
 
-double FMessagePackGameDataReader::ReadFloat64() const
+double FMessagePackGameDataReader::ReadFloat64()
 {
 	uint64 beValue = ReadBeUInt64();
     return *reinterpret_cast<double*>(&beValue);
@@ -0,0 +1,833 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/Formatters/FStructuralJsonGameDataReader.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define CHARON_STRUCTURAL_JSON_SSE2 1
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS
+#include <arm_neon.h>
+#define CHARON_STRUCTURAL_JSON_NEON 1
+#endif
+
+#ifndef CHARON_STRUCTURAL_JSON_SSE2
+#define CHARON_STRUCTURAL_JSON_SSE2 0
+#endif
+#ifndef CHARON_STRUCTURAL_JSON_NEON
+#define CHARON_STRUCTURAL_JSON_NEON 0
+#endif
+
+static constexpr int64 FStructuralJsonGameDataReader_BlockSize = 64;
+
+static FORCEINLINE bool FStructuralJsonGameDataReader_IsWhitespace(const uint8 Character)
+{
+	return Character == ' ' || Character == '\n' || Character == '\r' || Character == '\t';
+}
+
+#if CHARON_STRUCTURAL_JSON_NEON
+static FORCEINLINE uint64 FStructuralJsonGameDataReader_MoveMask(const uint8x16_t Input)
+{
+	static const uint8 BitMask[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+	const uint8x16_t Masked = vandq_u8(Input, vld1q_u8(BitMask));
+	return static_cast<uint64>(vaddv_u8(vget_low_u8(Masked))) | (static_cast<uint64>(vaddv_u8(vget_high_u8(Masked))) << 8);
+}
+#endif
+
+/*
+ * Classify 64 bytes of input into bit masks of quotes, backslashes and structural characters ({}[]:,).
+ * Bit N of each mask corresponds to byte N of the block.
+ */
+static FORCEINLINE void FStructuralJsonGameDataReader_ClassifyBlock(const uint8* Block, uint64& OutQuote, uint64& OutBackslash, uint64& OutStructural)
+{
+	OutQuote = 0;
+	OutBackslash = 0;
+	OutStructural = 0;
+#if CHARON_STRUCTURAL_JSON_SSE2
+	const __m128i Quote = _mm_set1_epi8('"');
+	const __m128i Backslash = _mm_set1_epi8('\\');
+	const __m128i CaseBit = _mm_set1_epi8(0x20);
+	const __m128i CurlyOpen = _mm_set1_epi8('{');
+	const __m128i CurlyClose = _mm_set1_epi8('}');
+	const __m128i Colon = _mm_set1_epi8(':');
+	const __m128i Comma = _mm_set1_epi8(',');
+	for (int32 Offset = 0; Offset < FStructuralJsonGameDataReader_BlockSize; Offset += 16)
+	{
+		const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Block + Offset));
+		// '[' and ']' differ from '{' and '}' only by 0x20 bit
+		const __m128i Folded = _mm_or_si128(Chunk, CaseBit);
+		const __m128i Structural = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(Folded, CurlyOpen), _mm_cmpeq_epi8(Folded, CurlyClose)),
+			_mm_or_si128(_mm_cmpeq_epi8(Chunk, Colon), _mm_cmpeq_epi8(Chunk, Comma)));
+
+		OutQuote |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(Chunk, Quote)))) << Offset;
+		OutBackslash |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(Chunk, Backslash)))) << Offset;
+		OutStructural |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(Structural))) << Offset;
+	}
+#elif CHARON_STRUCTURAL_JSON_NEON
+	const uint8x16_t Quote = vdupq_n_u8('"');
+	const uint8x16_t Backslash = vdupq_n_u8('\\');
+	const uint8x16_t CaseBit = vdupq_n_u8(0x20);
+	const uint8x16_t CurlyOpen = vdupq_n_u8('{');
+	const uint8x16_t CurlyClose = vdupq_n_u8('}');
+	const uint8x16_t Colon = vdupq_n_u8(':');
+	const uint8x16_t Comma = vdupq_n_u8(',');
+	for (int32 Offset = 0; Offset < FStructuralJsonGameDataReader_BlockSize; Offset += 16)
+	{
+		const uint8x16_t Chunk = vld1q_u8(Block + Offset);
+		// '[' and ']' differ from '{' and '}' only by 0x20 bit
+		const uint8x16_t Folded = vorrq_u8(Chunk, CaseBit);
+		const uint8x16_t Structural = vorrq_u8(
+			vorrq_u8(vceqq_u8(Folded, CurlyOpen), vceqq_u8(Folded, CurlyClose)),
+			vorrq_u8(vceqq_u8(Chunk, Colon), vceqq_u8(Chunk, Comma)));
+
+		OutQuote |= FStructuralJsonGameDataReader_MoveMask(vceqq_u8(Chunk, Quote)) << Offset;
+		OutBackslash |= FStructuralJsonGameDataReader_MoveMask(vceqq_u8(Chunk, Backslash)) << Offset;
+		OutStructural |= FStructuralJsonGameDataReader_MoveMask(Structural) << Offset;
+	}
+#else
+	for (int32 Offset = 0; Offset < FStructuralJsonGameDataReader_BlockSize; ++Offset)
+	{
+		const uint64 Bit = 1ull << Offset;
+		switch (Block[Offset])
+		{
+		case '"': OutQuote |= Bit; break;
+		case '\\': OutBackslash |= Bit; break;
+		case '{':
+		case '}':
+		case '[':
+		case ']':
+		case ':':
+		case ',': OutStructural |= Bit; break;
+		default: break;
+		}
+	}
+#endif
+}
+
+static void FStructuralJsonGameDataReader_AppendUtf8(FString& Value, const uint8* Bytes, const int64 Length)
+{
+	if (Length <= 0)
+	{
+		return;
+	}
+	const FUTF8ToTCHAR Utf8String(reinterpret_cast<const ANSICHAR*>(Bytes), static_cast<int32>(Length));
+	Value.AppendChars(Utf8String.Get(), Utf8String.Length());
+}
+
+static void FStructuralJsonGameDataReader_AppendCodePoint(FString& Value, const uint32 CodePoint)
+{
+	if (sizeof(TCHAR) == 2 && CodePoint > 0xFFFF)
+	{
+		Value.AppendChar(static_cast<TCHAR>(0xD800 + ((CodePoint - 0x10000) >> 10)));
+		Value.AppendChar(static_cast<TCHAR>(0xDC00 + ((CodePoint - 0x10000) & 0x3FF)));
+		return;
+	}
+	Value.AppendChar(static_cast<TCHAR>(CodePoint));
+}
+
+static bool FStructuralJsonGameDataReader_ParseHex4(const uint8* Bytes, const int64 Length, uint32& OutValue)
+{
+	if (Length < 4)
+	{
+		return false;
+	}
+	OutValue = 0;
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		const uint8 Character = Bytes[Index];
+		uint32 Digit;
+		if (Character >= '0' && Character <= '9') { Digit = Character - '0'; }
+		else if (Character >= 'a' && Character <= 'f') { Digit = Character - 'a' + 10; }
+		else if (Character >= 'A' && Character <= 'F') { Digit = Character - 'A' + 10; }
+		else { return false; }
+		OutValue = (OutValue << 4) | Digit;
+	}
+	return true;
+}
+
+FStructuralJsonGameDataReader::FStructuralJsonGameDataReader(FArchive* const Stream)
+	: OwnedBuffer()
+	  , Buffer(nullptr)
+	  , BufferLength(0)
+	  , StructuralIndex()
+	  , IndexPosition(0)
+	  , Position(0)
+	  , TokenStart(0)
+	  , ContainerStack()
+	  , IsSeparatorExpected(false)
+	  , IsContainerEmpty(false)
+	  , Notation(EJsonNotation::Null)
+	  , CurrentToken(EJsonToken::None)
+	  , Identifier()
+	  , ErrorMessage()
+	  , StringValue()
+	  , PendingStringValueStart(0)
+	  , PendingStringValueEnd(0)
+	  , HasPendingStringValue(false)
+	  , NumberValue(0.0)
+	  , Int64Value(0)
+	  , UInt64Value(0)
+	  , HasIntegerValue(false)
+	  , BoolValue(false)
+	  , FinishedReadingRootObject(false)
+{
+	if (Stream == nullptr)
+	{
+		SetErrorMessage(TEXT("Null Stream"));
+		return;
+	}
+
+	const int64 RemainingSize = Stream->TotalSize() - Stream->Tell();
+	if (RemainingSize > MAX_int32)
+	{
+		SetErrorMessage(TEXT("Input is too large."));
+		return;
+	}
+	if (RemainingSize > 0)
+	{
+		OwnedBuffer.SetNumUninitialized(static_cast<int32>(RemainingSize));
+		Stream->Serialize(OwnedBuffer.GetData(), RemainingSize);
+		if (Stream->IsError())
+		{
+			SetErrorMessage(TEXT("Unexpected end of data."));
+			return;
+		}
+	}
+	Buffer = OwnedBuffer.GetData();
+	BufferLength = OwnedBuffer.Num();
+	BuildStructuralIndex();
+}
+
+FStructuralJsonGameDataReader::FStructuralJsonGameDataReader(const TArrayView<const uint8> Buffer)
+	: OwnedBuffer()
+	  , Buffer(Buffer.GetData())
+	  , BufferLength(Buffer.Num())
+	  , StructuralIndex()
+	  , IndexPosition(0)
+	  , Position(0)
+	  , TokenStart(0)
+	  , ContainerStack()
+	  , IsSeparatorExpected(false)
+	  , IsContainerEmpty(false)
+	  , Notation(EJsonNotation::Null)
+	  , CurrentToken(EJsonToken::None)
+	  , Identifier()
+	  , ErrorMessage()
+	  , StringValue()
+	  , PendingStringValueStart(0)
+	  , PendingStringValueEnd(0)
+	  , HasPendingStringValue(false)
+	  , NumberValue(0.0)
+	  , Int64Value(0)
+	  , UInt64Value(0)
+	  , HasIntegerValue(false)
+	  , BoolValue(false)
+	  , FinishedReadingRootObject(false)
+{
+	BuildStructuralIndex();
+}
+
+void FStructuralJsonGameDataReader::BuildStructuralIndex()
+{
+	// skip UTF-8 BOM
+	if (BufferLength >= 3 && Buffer[0] == 0xEF && Buffer[1] == 0xBB && Buffer[2] == 0xBF)
+	{
+		Buffer += 3;
+		BufferLength -= 3;
+	}
+
+	if (BufferLength > MAX_uint32)
+	{
+		SetErrorMessage(TEXT("Input is too large."));
+		return;
+	}
+
+	StructuralIndex.Reset();
+	// pretty-printed game data has roughly one structural character per 8-16 bytes
+	StructuralIndex.Reserve(static_cast<int32>(BufferLength / 8) + 16);
+
+	bool IsEscapeCarried = false;
+	uint64 InStringCarry = 0;
+	uint8 TailBlock[FStructuralJsonGameDataReader_BlockSize];
+	for (int64 BlockStart = 0; BlockStart < BufferLength; BlockStart += FStructuralJsonGameDataReader_BlockSize)
+	{
+		const uint8* Block = Buffer + BlockStart;
+		if (BufferLength - BlockStart < FStructuralJsonGameDataReader_BlockSize)
+		{
+			FMemory::Memset(TailBlock, ' ', FStructuralJsonGameDataReader_BlockSize);
+			FMemory::Memcpy(TailBlock, Block, BufferLength - BlockStart);
+			Block = TailBlock;
+		}
+
+		uint64 Quote, Backslash, Structural;
+		FStructuralJsonGameDataReader_ClassifyBlock(Block, Quote, Backslash, Structural);
+
+		// character after backslash is escaped, backslash escaped by another backslash doesn't start new escape
+		if (Backslash != 0 || IsEscapeCarried)
+		{
+			uint64 Escaped = IsEscapeCarried ? 1ull : 0ull;
+			IsEscapeCarried = false;
+			uint64 EscapeStarts = Backslash & ~Escaped;
+			while (EscapeStarts != 0)
+			{
+				const uint64 Bit = FMath::CountTrailingZeros64(EscapeStarts);
+				if (Bit == FStructuralJsonGameDataReader_BlockSize - 1)
+				{
+					IsEscapeCarried = true;
+					break;
+				}
+				Escaped |= 2ull << Bit;
+				EscapeStarts &= ~(3ull << Bit);
+			}
+			Quote &= ~Escaped;
+		}
+
+		// prefix XOR of quote bits marks string content (opening quote inclusive, closing quote exclusive)
+		uint64 InString = Quote;
+		InString ^= InString << 1;
+		InString ^= InString << 2;
+		InString ^= InString << 4;
+		InString ^= InString << 8;
+		InString ^= InString << 16;
+		InString ^= InString << 32;
+		InString ^= InStringCarry;
+		InStringCarry = (InString >> 63) != 0 ? ~0ull : 0ull;
+
+		uint64 Bits = (Structural & ~InString) | Quote;
+		while (Bits != 0)
+		{
+			StructuralIndex.Add(static_cast<uint32>(BlockStart + FMath::CountTrailingZeros64(Bits)));
+			Bits &= Bits - 1;
+		}
+	}
+
+	if (InStringCarry != 0)
+	{
+		SetErrorMessage(TEXT("Unterminated string value."));
+	}
+}
+
+bool FStructuralJsonGameDataReader::SkipWhitespace()
+{
+	while (Position < BufferLength && FStructuralJsonGameDataReader_IsWhitespace(Buffer[Position]))
+	{
+		Position++;
+	}
+	return Position < BufferLength;
+}
+
+bool FStructuralJsonGameDataReader::ConsumeStructural()
+{
+	// structural characters outside of strings are always next entry in index
+	if (IndexPosition >= StructuralIndex.Num() || StructuralIndex[IndexPosition] != Position)
+	{
+		SetErrorMessage(FString::Printf(TEXT("Unexpected character '%c' at position %lld."), static_cast<TCHAR>(Buffer[Position]), Position));
+		return false;
+	}
+	IndexPosition++;
+	Position++;
+	return true;
+}
+
+bool FStructuralJsonGameDataReader::ReadString(int64& Start, int64& End)
+{
+	if (!ConsumeStructural())
+	{
+		return false;
+	}
+	if (IndexPosition >= StructuralIndex.Num() || Buffer[StructuralIndex[IndexPosition]] != '"')
+	{
+		SetErrorMessage(TEXT("Unterminated string value."));
+		return false;
+	}
+	Start = Position;
+	End = StructuralIndex[IndexPosition];
+	IndexPosition++;
+	Position = End + 1;
+	return true;
+}
+
+void FStructuralJsonGameDataReader::UnescapeString(FString& Value, const int64 Start, const int64 End) const
+{
+	// malformed escape sequences are decoded leniently as escaped character itself or U+FFFD
+	const uint8* Bytes = Buffer + Start;
+	const int64 Length = End - Start;
+	Value.Reset(static_cast<int32>(Length));
+
+	int64 RunStart = 0;
+	for (int64 Index = 0; Index < Length; ++Index)
+	{
+		if (Bytes[Index] != '\\')
+		{
+			continue;
+		}
+
+		FStructuralJsonGameDataReader_AppendUtf8(Value, Bytes + RunStart, Index - RunStart);
+		++Index;
+		if (Index >= Length)
+		{
+			RunStart = Length;
+			break;
+		}
+
+		switch (Bytes[Index])
+		{
+		case 'b': Value.AppendChar(TEXT('\b')); break;
+		case 'f': Value.AppendChar(TEXT('\f')); break;
+		case 'n': Value.AppendChar(TEXT('\n')); break;
+		case 'r': Value.AppendChar(TEXT('\r')); break;
+		case 't': Value.AppendChar(TEXT('\t')); break;
+		case 'u':
+			{
+				uint32 CodePoint = 0;
+				if (!FStructuralJsonGameDataReader_ParseHex4(Bytes + Index + 1, Length - Index - 1, CodePoint))
+				{
+					Value.AppendChar(static_cast<TCHAR>(0xFFFD));
+					break;
+				}
+				Index += 4;
+
+				uint32 LowSurrogate = 0;
+				if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF &&
+					Index + 6 < Length && Bytes[Index + 1] == '\\' && Bytes[Index + 2] == 'u' &&
+					FStructuralJsonGameDataReader_ParseHex4(Bytes + Index + 3, Length - Index - 3, LowSurrogate) &&
+					LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+				{
+					CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+					Index += 6;
+				}
+				FStructuralJsonGameDataReader_AppendCodePoint(Value, CodePoint);
+				break;
+			}
+		default:
+			Value.AppendChar(static_cast<TCHAR>(Bytes[Index]));
+			break;
+		}
+		RunStart = Index + 1;
+	}
+	FStructuralJsonGameDataReader_AppendUtf8(Value, Bytes + RunStart, Length - RunStart);
+}
+
+bool FStructuralJsonGameDataReader::ReadNext()
+{
+	if (!ErrorMessage.IsEmpty())
+	{
+		Notation = EJsonNotation::Error;
+		CurrentToken = EJsonToken::None;
+		return false;
+	}
+
+	// reset state
+	Notation = EJsonNotation::Null;
+	CurrentToken = EJsonToken::None;
+	Identifier.Reset();
+	StringValue.Reset();
+	HasPendingStringValue = false;
+	NumberValue = 0;
+	Int64Value = 0;
+	UInt64Value = 0;
+	HasIntegerValue = false;
+	BoolValue = false;
+	//
+
+	if (FinishedReadingRootObject)
+	{
+		if (SkipWhitespace())
+		{
+			Notation = EJsonNotation::Error;
+			SetErrorMessage(TEXT("Unexpected additional input found."));
+			return true;
+		}
+		return false;
+	}
+
+	if (ContainerStack.Num() > 0)
+	{
+		const EContainerType ContainerType = ContainerStack.Top();
+		if (IsSeparatorExpected || IsContainerEmpty)
+		{
+			if (!SkipWhitespace())
+			{
+				Notation = EJsonNotation::Error;
+				SetErrorMessage(TEXT("Unexpected end of data."));
+				return true;
+			}
+
+			const uint8 Character = Buffer[Position];
+			if ((ContainerType == EContainerType::Object && Character == '}') ||
+				(ContainerType == EContainerType::Array && Character == ']'))
+			{
+				if (!ConsumeStructural())
+				{
+					Notation = EJsonNotation::Error;
+					return true;
+				}
+				CloseContainer(ContainerType);
+				return true;
+			}
+
+			if (IsSeparatorExpected && (Character != ',' || !ConsumeStructural()))
+			{
+				Notation = EJsonNotation::Error;
+				SetErrorMessage(FString::Printf(TEXT("Expected ',' or end of %s at position %lld."),
+					ContainerType == EContainerType::Object ? TEXT("object") : TEXT("array"), Position));
+				return true;
+			}
+		}
+		IsSeparatorExpected = false;
+		IsContainerEmpty = false;
+
+		if (ContainerType == EContainerType::Object)
+		{
+			int64 NameStart = 0, NameEnd = 0;
+			if (!SkipWhitespace() || Buffer[Position] != '"')
+			{
+				Notation = EJsonNotation::Error;
+				SetErrorMessage(FString::Printf(TEXT("Expected member name at position %lld."), Position));
+				return true;
+			}
+			if (!ReadString(NameStart, NameEnd))
+			{
+				Notation = EJsonNotation::Error;
+				return true;
+			}
+			UnescapeString(Identifier, NameStart, NameEnd);
+
+			if (!SkipWhitespace() || Buffer[Position] != ':' || !ConsumeStructural())
+			{
+				Notation = EJsonNotation::Error;
+				SetErrorMessage(FString::Printf(TEXT("Expected ':' after member name at position %lld."), Position));
+				return true;
+			}
+		}
+	}
+
+	if (!ReadValueToken())
+	{
+		Notation = EJsonNotation::Error;
+		CurrentToken = EJsonToken::None;
+	}
+	return true;
+}
+
+bool FStructuralJsonGameDataReader::ReadValueToken()
+{
+	if (!SkipWhitespace())
+	{
+		SetErrorMessage(TEXT("Unexpected end of data."));
+		return false;
+	}
+	TokenStart = Position;
+
+	switch (Buffer[Position])
+	{
+	case '{':
+	case '[':
+		{
+			const bool IsObject = Buffer[Position] == '{';
+			if (!ConsumeStructural())
+			{
+				return false;
+			}
+			ContainerStack.Push(IsObject ? EContainerType::Object : EContainerType::Array);
+			IsContainerEmpty = true;
+			IsSeparatorExpected = false;
+			Notation = IsObject ? EJsonNotation::ObjectStart : EJsonNotation::ArrayStart;
+			CurrentToken = IsObject ? EJsonToken::CurlyOpen : EJsonToken::SquareOpen;
+			return true;
+		}
+	case '"':
+		if (!ReadString(PendingStringValueStart, PendingStringValueEnd))
+		{
+			return false;
+		}
+		HasPendingStringValue = true;
+		Notation = EJsonNotation::String;
+		CurrentToken = EJsonToken::String;
+		break;
+	case '}':
+	case ']':
+	case ',':
+	case ':':
+		SetErrorMessage(FString::Printf(TEXT("Unexpected character '%c' at position %lld."), static_cast<TCHAR>(Buffer[Position]), Position));
+		return false;
+	default:
+		if (!ReadScalar())
+		{
+			return false;
+		}
+		break;
+	}
+
+	IsSeparatorExpected = true;
+	if (ContainerStack.Num() == 0)
+	{
+		FinishedReadingRootObject = true;
+	}
+	return true;
+}
+
+bool FStructuralJsonGameDataReader::ReadScalar()
+{
+	// scalar spans up to next structural character
+	const int64 ScalarStart = Position;
+	const int64 ScalarEnd = IndexPosition < StructuralIndex.Num() ? StructuralIndex[IndexPosition] : BufferLength;
+	int64 TextEnd = ScalarEnd;
+	while (TextEnd > ScalarStart && FStructuralJsonGameDataReader_IsWhitespace(Buffer[TextEnd - 1]))
+	{
+		TextEnd--;
+	}
+	Position = ScalarEnd;
+
+	const ANSICHAR* Text = reinterpret_cast<const ANSICHAR*>(Buffer + ScalarStart);
+	const int64 Length = TextEnd - ScalarStart;
+	if (Length == 4 && FMemory::Memcmp(Text, "true", 4) == 0)
+	{
+		BoolValue = true;
+		Notation = EJsonNotation::Boolean;
+		CurrentToken = EJsonToken::True;
+		return true;
+	}
+	if (Length == 5 && FMemory::Memcmp(Text, "false", 5) == 0)
+	{
+		BoolValue = false;
+		Notation = EJsonNotation::Boolean;
+		CurrentToken = EJsonToken::False;
+		return true;
+	}
+	if (Length == 4 && FMemory::Memcmp(Text, "null", 4) == 0)
+	{
+		Notation = EJsonNotation::Null;
+		CurrentToken = EJsonToken::Null;
+		return true;
+	}
+
+	// -?digits(.digits)?([eE][+-]?digits)?
+	int64 Index = 0;
+	const bool IsNegative = Length > 0 && Text[0] == '-';
+	if (IsNegative)
+	{
+		Index++;
+	}
+	const int64 DigitsStart = Index;
+	uint64 Mantissa = 0;
+	bool IsOverflow = false;
+	for (; Index < Length && Text[Index] >= '0' && Text[Index] <= '9'; ++Index)
+	{
+		const uint64 Digit = Text[Index] - '0';
+		IsOverflow |= Mantissa > (MAX_uint64 - Digit) / 10;
+		Mantissa = Mantissa * 10 + Digit;
+	}
+	bool IsValid = Index > DigitsStart;
+	bool IsInteger = true;
+	if (IsValid && Index < Length && Text[Index] == '.')
+	{
+		IsInteger = false;
+		const int64 FractionStart = ++Index;
+		while (Index < Length && Text[Index] >= '0' && Text[Index] <= '9') { Index++; }
+		IsValid = Index > FractionStart;
+	}
+	if (IsValid && Index < Length && (Text[Index] == 'e' || Text[Index] == 'E'))
+	{
+		IsInteger = false;
+		Index++;
+		if (Index < Length && (Text[Index] == '+' || Text[Index] == '-')) { Index++; }
+		const int64 ExponentStart = Index;
+		while (Index < Length && Text[Index] >= '0' && Text[Index] <= '9') { Index++; }
+		IsValid = Index > ExponentStart;
+	}
+	if (!IsValid || Index != Length)
+	{
+		const FUTF8ToTCHAR TokenText(Text, static_cast<int32>(FMath::Min<int64>(Length, 64)));
+		SetErrorMessage(FString::Printf(TEXT("Unexpected token '%s' at position %lld."), *FString(TokenText.Length(), TokenText.Get()), ScalarStart));
+		return false;
+	}
+
+	Notation = EJsonNotation::Number;
+	CurrentToken = EJsonToken::Number;
+
+	constexpr uint64 MinInt64Magnitude = 9223372036854775808ull;
+	if (IsInteger && !IsOverflow && (!IsNegative || Mantissa <= MinInt64Magnitude))
+	{
+		Int64Value = IsNegative ? static_cast<int64>(0 - Mantissa) : static_cast<int64>(Mantissa);
+		UInt64Value = IsNegative ? static_cast<uint64>(Int64Value) : Mantissa;
+		HasIntegerValue = true;
+		NumberValue = IsNegative ? -static_cast<double>(Mantissa) : static_cast<double>(Mantissa);
+		return true;
+	}
+
+	TArray<ANSICHAR, TInlineAllocator<64>> NumberText;
+	NumberText.Append(Text, static_cast<int32>(Length));
+	NumberText.Add('\0');
+	NumberValue = FCStringAnsi::Atod(NumberText.GetData());
+	return true;
+}
+
+void FStructuralJsonGameDataReader::CloseContainer(const EContainerType ContainerType)
+{
+	ContainerStack.Pop();
+	IsSeparatorExpected = true;
+	IsContainerEmpty = false;
+	Notation = ContainerType == EContainerType::Object ? EJsonNotation::ObjectEnd : EJsonNotation::ArrayEnd;
+	CurrentToken = ContainerType == EContainerType::Object ? EJsonToken::CurlyClose : EJsonToken::SquareClose;
+	if (ContainerStack.Num() == 0)
+	{
+		FinishedReadingRootObject = true;
+	}
+}
+
+void FStructuralJsonGameDataReader::SkipAny(const bool NextToken)
+{
+	if (Notation == EJsonNotation::Error)
+	{
+		return;
+	}
+	if (Notation != EJsonNotation::ObjectStart && Notation != EJsonNotation::ArrayStart)
+	{
+		ReadNext();
+		return;
+	}
+
+	// content of container is skipped by walking structural index, values are not tokenized at all
+	int32 Depth = 1;
+	for (; IndexPosition < StructuralIndex.Num(); ++IndexPosition)
+	{
+		const uint8 Character = Buffer[StructuralIndex[IndexPosition]];
+		if (Character == '{' || Character == '[')
+		{
+			Depth++;
+		}
+		else if (Character == '}' || Character == ']')
+		{
+			if (--Depth == 0)
+			{
+				break;
+			}
+		}
+	}
+	if (Depth != 0)
+	{
+		Notation = EJsonNotation::Error;
+		CurrentToken = EJsonToken::None;
+		SetErrorMessage(TEXT("Unexpected end of data."));
+		return;
+	}
+
+	// closing character is read as regular token, so container stack stays consistent
+	Position = StructuralIndex[IndexPosition];
+	IsSeparatorExpected = false;
+	IsContainerEmpty = true;
+	if (ReadNext() && NextToken)
+	{
+		ReadNext();
+	}
+}
+
+bool FStructuralJsonGameDataReader::ReadRawValue(TArrayView<const uint8>& RawValue, const bool NextToken)
+{
+	switch (Notation)
+	{
+	case EJsonNotation::ObjectStart:
+	case EJsonNotation::ArrayStart:
+		SkipAny(/* NextToken */ false);
+		if (Notation == EJsonNotation::Error)
+		{
+			return false;
+		}
+		break;
+	case EJsonNotation::String:
+	case EJsonNotation::Number:
+	case EJsonNotation::Boolean:
+	case EJsonNotation::Null:
+		break;
+	default:
+		return false;
+	}
+
+	// value's last character is already consumed by SkipAny() or ReadScalar()/ReadString()
+	RawValue = TArrayView<const uint8>(Buffer + TokenStart, static_cast<int32>(Position - TokenStart));
+	if (NextToken)
+	{
+		ReadNext();
+	}
+	return true;
+}
+
+TSharedPtr<IGameDataReader> FStructuralJsonGameDataReader::CreateRawValueReader(const TArrayView<const uint8> RawValue) const
+{
+	return MakeShareable(new FStructuralJsonGameDataReader(RawValue));
+}
+
+bool FStructuralJsonGameDataReader::GetRawTokenBounds(const uint8*& OutTokenStart, const uint8*& OutTokenEnd) const
+{
+	if (Buffer == nullptr || Notation == EJsonNotation::Error)
+	{
+		return false;
+	}
+
+	// closing character is the only character consumed by closing token
+	const bool IsClosingToken = Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd;
+	OutTokenStart = Buffer + (IsClosingToken ? Position - 1 : TokenStart);
+	OutTokenEnd = Buffer + Position;
+	return true;
+}
+
+const FString& FStructuralJsonGameDataReader::GetValueAsString() const
+{
+	check(CurrentToken == EJsonToken::String);
+
+	if (HasPendingStringValue)
+	{
+		UnescapeString(StringValue, PendingStringValueStart, PendingStringValueEnd);
+		HasPendingStringValue = false;
+	}
+	return StringValue;
+}
+
+FStringView FStructuralJsonGameDataReader::GetValueAsStringView() const
+{
+	return GetValueAsString();
+}
+
+double FStructuralJsonGameDataReader::GetValueAsNumber() const
+{
+	check(CurrentToken == EJsonToken::Number);
+
+	return NumberValue;
+}
+
+int64 FStructuralJsonGameDataReader::GetValueAsInt64()
+{
+	if (HasIntegerValue)
+	{
+		return Int64Value;
+	}
+	return IGameDataReader::GetValueAsInt64();
+}
+
+uint64 FStructuralJsonGameDataReader::GetValueAsUInt64()
+{
+	if (HasIntegerValue)
+	{
+		return UInt64Value;
+	}
+	return IGameDataReader::GetValueAsUInt64();
+}
+
+bool FStructuralJsonGameDataReader::GetValueAsBoolean() const
+{
+	check((CurrentToken == EJsonToken::True) || (CurrentToken == EJsonToken::False));
+
+	return BoolValue;
+}
+
+void FStructuralJsonGameDataReader::SetErrorState(const FString& Message)
+{
+	ErrorMessage = Message;
+	Notation = EJsonNotation::Error;
+}
+
+void FStructuralJsonGameDataReader::SetErrorMessage(const FString& Message)
+{
+	ErrorMessage = Message;
+}
@@ -0,0 +1,5 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/Formatters/TGameDataReader.h"
+
+bool FGameDataReaderDispatch::IsStaticDispatchEnabled = true;
@@ -4,6 +4,243 @@
 
 #include "EditorFramework/AssetImportData.h"
 #include "GameData/UGameDataImportData.h"
+#include "GameData/FGameDataMappedFile.h"
+#include "GameData/FGameDataCompiledCache.h"
+#include "GameData/FGameDataAsyncFileArchive.h"
+#include "GameData/Formatters/FGameDataReaderFactory.h"
+#include "GameData/Formatters/FCompiledGameDataWriter.h"
+#include "Async/Async.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "Serialization/MemoryReader.h"
+
+#include <atomic>
+
+DEFINE_LOG_CATEGORY(LogUGameDataBase);
+
+static std::atomic<uint32> GGameDataLoadGeneration(0);
+
+bool UGameDataBase::TryLoad(const TArrayView<const uint8> GameDataBuffer, EGameDataFormat Format)
+{
+	FMemoryReaderView GameDataStream(GameDataBuffer);
+	return TryLoad(&GameDataStream, Format);
+}
+
+bool UGameDataBase::TryLoad(const TArrayView<const uint8> GameDataBuffer, FGameDataLoadOptions Options)
+{
+	// derived class overrides this method with full support of options
+	return TryLoad(GameDataBuffer, Options.Format);
+}
+
+bool UGameDataBase::TryLoadFile(const FString& GameDataFilePath, EGameDataFormat Format)
+{
+	FGameDataLoadOptions Options;
+	Options.Format = Format;
+	return TryLoadFile(GameDataFilePath, Options);
+}
+
+bool UGameDataBase::TryLoadFile(const FString& GameDataFilePath, const FGameDataLoadOptions& Options)
+{
+	FGameDataMappedFile GameDataFile;
+	if (!GameDataFile.Open(GameDataFilePath))
+	{
+		return false;
+	}
+	if (Options.Format != EGameDataFormat::Compiled && Options.Patches.Num() == 0 && FGameDataCompiledCache::IsEnabled())
+	{
+		return TryLoadCached(GameDataFile.GetData(), Options);
+	}
+	return TryLoad(GameDataFile.GetData(), Options);
+}
+
+bool UGameDataBase::TryLoadCached(const TArrayView<const uint8> GameDataBuffer, FGameDataLoadOptions Options)
+{
+	const EGameDataFormat Format = Options.Format;
+	FString CacheKey;
+	if (!FGameDataCompiledCache::GetCacheKey(GameDataBuffer, Format, GetGeneratorVersion(), CacheKey))
+	{
+		UE_LOG(LogFGameDataCompiledCache, Verbose, TEXT("Game data has no RevisionHash and is loaded without cache."));
+		return TryLoad(GameDataBuffer, Options);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	{
+		FGameDataMappedFile CacheFile;
+		TArrayView<const uint8> CompiledImage;
+		double SourceLoadSeconds = 0;
+		Options.Format = EGameDataFormat::Compiled;
+		if (FGameDataCompiledCache::TryOpen(CacheKey, CacheFile, CompiledImage, SourceLoadSeconds) &&
+			TryLoad(CompiledImage, Options))
+		{
+			const double LoadSeconds = FPlatformTime::Seconds() - StartTime;
+			UE_LOG(LogFGameDataCompiledCache, Log, TEXT("Cache hit for '%s' game data (key %s). Loaded in %.3f ms, saved %.3f ms."),
+				*GetClass()->GetName(), *CacheKey, LoadSeconds * 1000, (SourceLoadSeconds - LoadSeconds) * 1000);
+			return true;
+		}
+	}
+
+	// source is compiled once, game data is loaded from the same image which is written to cache
+	TArray<uint8> CompiledImage;
+	if (!FCompiledGameDataWriter::Compile(GameDataBuffer, Format, CompiledImage))
+	{
+		Options.Format = Format;
+		return TryLoad(GameDataBuffer, Options);
+	}
+	if (!TryLoad(CompiledImage, Options))
+	{
+		return false;
+	}
+	const double SourceLoadSeconds = FPlatformTime::Seconds() - StartTime;
+	const bool IsWritten = FGameDataCompiledCache::Write(CacheKey, CompiledImage, SourceLoadSeconds);
+	UE_LOG(LogFGameDataCompiledCache, Log, TEXT("Cache miss for '%s' game data (key %s). Loaded from source in %.3f ms, cache entry %s."),
+		*GetClass()->GetName(), *CacheKey, SourceLoadSeconds * 1000, IsWritten ? TEXT("is written") : TEXT("is not written"));
+	return true;
+}
+
+bool UGameDataBase::TryLoadCompiledFile(const FString& GameDataFilePath, EGameDataFormat Format)
+{
+	if (Format == EGameDataFormat::Compiled)
+	{
+		return TryLoadFile(GameDataFilePath, Format);
+	}
+
+	FGameDataMappedFile GameDataFile;
+	const bool HasSource = GameDataFile.Open(GameDataFilePath);
+	const FString CompiledFilePath = FCompiledGameDataWriter::GetCompiledFilePath(GameDataFilePath);
+	FGameDataMappedFile CompiledFile;
+	if (CompiledFile.Open(CompiledFilePath))
+	{
+		// RevisionHash is near start of both files, so source is not hashed or parsed
+		FCompiledGameDataHeader Header;
+		const bool IsUpToDate = HasSource ?
+			FCompiledGameDataWriter::IsCompiledFromRevision(CompiledFile.GetData(), GameDataFile.GetData(), Format) :
+			FCompiledGameDataReader::ReadHeader(CompiledFile.GetData(), Header);
+		if (IsUpToDate)
+		{
+			return TryLoad(CompiledFile.GetData(), EGameDataFormat::Compiled);
+		}
+		UE_LOG(LogFCompiledGameDataWriter, Verbose, TEXT("Compiled game data '%s' is stale and is ignored until game data is re-imported."), *CompiledFilePath);
+	}
+	if (!HasSource)
+	{
+		return false;
+	}
+
+	// images next to source files are written only by editor import, at runtime image is written into 'Saved' directory by cache
+	if (FGameDataCompiledCache::IsEnabled())
+	{
+		FGameDataLoadOptions Options;
+		Options.Format = Format;
+		return TryLoadCached(GameDataFile.GetData(), Options);
+	}
+	return TryLoad(GameDataFile.GetData(), Format);
+}
+
+/*
+ * Game data prepared on worker thread by TryLoadAsync. Source is compiled into image of fixed-size token records,
+ * so game thread only creates and links documents without parsing text or decoding numbers.
+ */
+struct FGameDataBase_PreparedGameData
+{
+	TArray<uint8> Buffer;
+	EGameDataFormat Format = EGameDataFormat::Json;
+	bool IsPrepared = false;
+};
+
+static void UGameDataBase_PrepareGameDataFile(const FString& GameDataFilePath, const FGameDataLoadOptions& Options, TFunction<void(float)> OnProgress, FGameDataBase_PreparedGameData& OutPreparedGameData)
+{
+	FGameDataAsyncFileArchive GameDataStream;
+	const bool IsOpened = GameDataStream.Open(GameDataFilePath, [OnProgress](const int64 BytesRead, const int64 TotalBytes)
+	{
+		if (!OnProgress || TotalBytes <= 0)
+		{
+			return;
+		}
+		const float Progress = static_cast<float>(static_cast<double>(BytesRead) / TotalBytes);
+		AsyncTask(ENamedThreads::GameThread, [OnProgress, Progress]() { OnProgress(Progress); });
+	});
+	if (!IsOpened)
+	{
+		return;
+	}
+
+	// compiled image is used as is, patches are in same format as source, so source is read as is for them
+	if (Options.Format == EGameDataFormat::Compiled || Options.Patches.Num() > 0 ||
+		(Options.Format != EGameDataFormat::Json && Options.Format != EGameDataFormat::MessagePack))
+	{
+		OutPreparedGameData.Buffer.SetNumUninitialized(GameDataStream.TotalSize());
+		GameDataStream.Serialize(OutPreparedGameData.Buffer.GetData(), OutPreparedGameData.Buffer.Num());
+		OutPreparedGameData.Format = Options.Format;
+		OutPreparedGameData.IsPrepared = !GameDataStream.IsError();
+		return;
+	}
+
+	// file is compiled while next chunk is read, image is transient, so it has no source hash
+	const TSharedRef<IGameDataReader> GameDataReader = Options.Format == EGameDataFormat::MessagePack ?
+		FGameDataReaderFactory::CreateMessagePackReader(&GameDataStream) :
+		FGameDataReaderFactory::CreateJsonReader(&GameDataStream);
+	OutPreparedGameData.Format = EGameDataFormat::Compiled;
+	OutPreparedGameData.IsPrepared = FCompiledGameDataWriter::Write(*GameDataReader, FSHAHash(), OutPreparedGameData.Buffer);
+}
+
+TFuture<bool> UGameDataBase::TryLoadAsync(const FString& GameDataFilePath, EGameDataFormat Format, TFunction<void(float)> OnProgress)
+{
+	FGameDataLoadOptions Options;
+	Options.Format = Format;
+	return TryLoadAsync(GameDataFilePath, Options, MoveTemp(OnProgress));
+}
+
+TFuture<bool> UGameDataBase::TryLoadAsync(const FString& GameDataFilePath, const FGameDataLoadOptions& Options, TFunction<void(float)> OnProgress)
+{
+	check(IsInGameThread());
+
+	if (IsLoadingAsync)
+	{
+		UE_LOG(LogUGameDataBase, Warning, TEXT("Game data '%s' is already being loaded asynchronously, load of '%s' is rejected."), *GetName(), *GameDataFilePath);
+		return MakeFulfilledPromise<bool>(false).GetFuture();
+	}
+
+	if (!FPlatformProcess::SupportsMultithreading())
+	{
+		const bool IsLoaded = TryLoadFile(GameDataFilePath, Options);
+		if (OnProgress)
+		{
+			OnProgress(1.0f);
+		}
+		return MakeFulfilledPromise<bool>(IsLoaded).GetFuture();
+	}
+
+	IsLoadingAsync = true;
+	TSharedRef<TPromise<bool>> LoadPromise = MakeShared<TPromise<bool>>();
+	TFuture<bool> LoadFuture = LoadPromise->GetFuture();
+	TWeakObjectPtr<UGameDataBase> WeakGameData(this);
+	Async(EAsyncExecution::ThreadPool, [WeakGameData, GameDataFilePath, Options, OnProgress, LoadPromise]()
+	{
+		// file I/O and compilation happen here, UObjects are touched only on game thread
+		TSharedRef<FGameDataBase_PreparedGameData> PreparedGameData = MakeShared<FGameDataBase_PreparedGameData>();
+		UGameDataBase_PrepareGameDataFile(GameDataFilePath, Options, OnProgress, *PreparedGameData);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakGameData, Options, PreparedGameData, LoadPromise]()
+		{
+			UGameDataBase* GameData = WeakGameData.Get();
+			if (GameData == nullptr)
+			{
+				LoadPromise->SetValue(false);
+				return;
+			}
+			GameData->IsLoadingAsync = false;
+			if (!PreparedGameData->IsPrepared)
+			{
+				LoadPromise->SetValue(false);
+				return;
+			}
+
+			FGameDataLoadOptions PreparedOptions = Options;
+			PreparedOptions.Format = PreparedGameData->Format;
+			LoadPromise->SetValue(GameData->TryLoad(TArrayView<const uint8>(PreparedGameData->Buffer), PreparedOptions));
+		});
+	});
+	return LoadFuture;
+}
 
 void UGameDataBase::PostInitProperties()
 {
@@ -15,12 +252,16 @@ void UGameDataBase::PostInitProperties()
 	}
 #endif
 	Super::PostInitProperties();
+
+	IncrementLoadGeneration();
 }
 
 void UGameDataBase::PostLoad()
 {
 	Super::PostLoad();
 
+	IncrementLoadGeneration();
+
 #if WITH_EDITORONLY_DATA
 	if (Cast<UGameDataImportData>(AssetImportData) == nullptr)
 	{
@@ -42,3 +283,26 @@ void UGameDataBase::GetAssetRegistryTags(FAssetRegistryTagsContext Context) cons
 #endif
 }
 #endif
+
+void UGameDataBase::IncrementLoadGeneration()
+{
+	// generations are unique across instances, so reference switched to other game data never reuses cached document
+	LoadGeneration = ++GGameDataLoadGeneration;
+	ReferrersIndex.Reset(); // referrers of previous generation are about to be destroyed
+	DocumentIndexes.Reset();
+}
+
+void UGameDataBase::BuildDocumentIndexes(const TArray<UGameDataDocument*>& AllDocuments, const TArrayView<const FGameDataDocumentIndexDeclaration> LoadIndexDeclarations,
+	const FString& PrimaryLanguageId)
+{
+	DocumentIndexes.Reset();
+
+	for (const FGameDataDocumentIndexDeclaration& IndexDeclaration : IndexDeclarations)
+	{
+		DocumentIndexes.Build(IndexDeclaration, FindDocumentSchemaClass(IndexDeclaration.SchemaName), AllDocuments, PrimaryLanguageId);
+	}
+	for (const FGameDataDocumentIndexDeclaration& IndexDeclaration : LoadIndexDeclarations)
+	{
+		DocumentIndexes.Build(IndexDeclaration, FindDocumentSchemaClass(IndexDeclaration.SchemaName), AllDocuments, PrimaryLanguageId);
+	}
+}
@@ -0,0 +1,62 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#include "GameData/UGameDataLibrary.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "LatentActions.h"
+
+/*
+ * Latent action which waits for UGameDataBase::TryLoadAsync() result.
+ */
+class FLoadGameDataAsyncAction final : public FPendingLatentAction
+{
+	TFuture<bool> LoadFuture;
+	bool& bSuccess;
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+
+public:
+	FLoadGameDataAsyncAction(TFuture<bool>&& LoadFuture, bool& bSuccess, const FLatentActionInfo& LatentInfo)
+		: LoadFuture(MoveTemp(LoadFuture)), bSuccess(bSuccess), ExecutionFunction(LatentInfo.ExecutionFunction),
+		  OutputLink(LatentInfo.Linkage), CallbackTarget(LatentInfo.CallbackTarget)
+	{
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		if (!LoadFuture.IsReady())
+		{
+			return;
+		}
+		bSuccess = LoadFuture.Get();
+		Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
+	}
+
+#if WITH_EDITOR
+	virtual FString GetDescription() const override
+	{
+		return LoadFuture.IsReady() ? TEXT("Game data is loaded.") : TEXT("Loading game data...");
+	}
+#endif
+};
+
+void UGameDataLibrary::LoadGameDataAsync(UObject* WorldContextObject, UGameDataBase* GameData, FString GameDataFilePath, EGameDataFormat Format, bool& bSuccess, FLatentActionInfo LatentInfo)
+{
+	bSuccess = false;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (World == nullptr || GameData == nullptr)
+	{
+		return;
+	}
+
+	FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+	if (LatentActionManager.FindExistingAction<FLoadGameDataAsyncAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) != nullptr)
+	{
+		return; // already loading
+	}
+
+	TFuture<bool> LoadFuture = GameData->TryLoadAsync(GameDataFilePath, Format);
+	LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, new FLoadGameDataAsyncAction(MoveTemp(LoadFuture), bSuccess, LatentInfo));
+}
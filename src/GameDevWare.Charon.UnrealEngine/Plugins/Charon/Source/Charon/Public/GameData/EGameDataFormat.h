@@ -18,7 +18,11 @@ enum class EGameDataFormat : uint8
 	/*
 	 * MessagePack binary format. See https://msgpack.org/
 	 */
-	MessagePack
+	MessagePack,
+	/*
+	 * Compiled binary image made from Json or MessagePack game data by FCompiledGameDataWriter. See FCompiledGameDataFormat.h.
+	 */
+	Compiled
 };
 
 
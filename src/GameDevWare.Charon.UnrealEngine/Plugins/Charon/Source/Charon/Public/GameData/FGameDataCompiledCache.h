@@ -0,0 +1,49 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EGameDataFormat.h"
+#include "FGameDataMappedFile.h"
+#include "Containers/ArrayView.h"
+#include "Containers/UnrealString.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogFGameDataCompiledCache, Log, All);
+
+/*
+ * Optional on-disk cache of compiled game data images (see FCompiledGameDataWriter) used by UGameDataBase::TryLoadFile.
+ * Cache entries are content-addressed by game data's RevisionHash, generator version of game data class, source format
+ * and compiled format version, so same game data is decoded from source only once across runs.
+ * Entries are written to temporary file and renamed into place, so concurrent editor/PIE processes never see partial entries.
+ * Disabled by default.
+ */
+class CHARON_API FGameDataCompiledCache
+{
+private:
+	static bool IsCacheEnabled;
+
+public:
+	static void SetEnabled(const bool Enabled) { IsCacheEnabled = Enabled; }
+	static bool IsEnabled() { return IsCacheEnabled; }
+
+	/*
+	 * Cache directory, 'Saved/Charon/Cache' of current project.
+	 */
+	static FString GetCacheDirectory();
+	static FString GetCacheFilePath(const FString& CacheKey);
+
+	/*
+	 * Make cache key for game data. Only root members are visited to find RevisionHash, documents are skipped.
+	 * Returns false if game data has no RevisionHash and could not be cached.
+	 */
+	static bool GetCacheKey(const TArrayView<const uint8> GameDataBuffer, EGameDataFormat Format, const FStringView& GeneratorVersion, FString& OutCacheKey);
+	/*
+	 * Open cached image for CacheKey. Image is valid while CacheFile is open. Returns false on cache miss or broken entry.
+	 * OutSourceLoadSeconds is time it took to load game data from source when entry was created.
+	 */
+	static bool TryOpen(const FString& CacheKey, FGameDataMappedFile& CacheFile, TArrayView<const uint8>& OutImage, double& OutSourceLoadSeconds);
+	/*
+	 * Store compiled image of game data (see FCompiledGameDataWriter::Compile) for CacheKey.
+	 */
+	static bool Write(const FString& CacheKey, const TArrayView<const uint8> Image, const double SourceLoadSeconds);
+};
@@ -0,0 +1,29 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Guid.h"
+
+/*
+ * Custom serialization version of game data assets. Bump when layout written by UGameDataBase derived classes is changed.
+ */
+struct CHARON_API FGameDataCustomVersion
+{
+	enum Type
+	{
+		BeforeCustomVersionWasAdded = 0,
+		/*
+		 * Documents are serialized by TGameDataDocumentStore instead of root collection UPROPERTYs.
+		 */
+		DocumentStores,
+
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	static const FGuid GUID;
+
+private:
+	FGameDataCustomVersion() = delete;
+};
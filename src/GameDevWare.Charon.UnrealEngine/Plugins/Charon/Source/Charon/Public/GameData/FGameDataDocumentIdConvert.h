@@ -22,12 +22,23 @@ public:
 		std::underlying_type_t<EnumType> UnderlyingValue;
 
 		static_assert(TIsEnum<EnumType>::Value, "Should only call this with enum types");
-		const UEnum* EnumClass = StaticEnum<EnumType>();
-		check(EnumClass != nullptr);
-		const int64 FoundValue = EnumClass->GetValueByNameString(ValueString);
-		if (FoundValue != INDEX_NONE)
+		// name table is built once per enum type, both short and full ("EEnum::Name") names are accepted
+		static const TMap<FString, int64> ValueByName = []
 		{
-			Value = static_cast<EnumType>(FoundValue);
+			const UEnum* EnumClass = StaticEnum<EnumType>();
+			check(EnumClass != nullptr);
+			TMap<FString, int64> Names;
+			for (int32 Index = 0; Index < EnumClass->NumEnums(); Index++)
+			{
+				const int64 EnumValue = EnumClass->GetValueByIndex(Index);
+				Names.Add(EnumClass->GetNameStringByIndex(Index), EnumValue);
+				Names.Add(EnumClass->GetNameByIndex(Index).ToString(), EnumValue);
+			}
+			return Names;
+		}();
+		if (const int64* FoundValue = ValueByName.Find(ValueString))
+		{
+			Value = static_cast<EnumType>(*FoundValue);
 			return true;
 		}
 		
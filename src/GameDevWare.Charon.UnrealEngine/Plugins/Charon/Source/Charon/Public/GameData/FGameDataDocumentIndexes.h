@@ -0,0 +1,116 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "UObject/NameTypes.h"
+#include "UGameDataDocument.h"
+
+#include "FGameDataDocumentIndexes.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogFGameDataDocumentIndexes, Log, All);
+
+/*
+ * Type of secondary index on document property.
+ */
+UENUM(BlueprintType)
+enum class EGameDataDocumentIndexType : uint8
+{
+	/*
+	 * Equality lookup on integer, enum, bool, string, name and localized text properties. Localized text is indexed by its text in
+	 * primary language of game data.
+	 */
+	Hash,
+	/*
+	 * Range lookup on integer, floating point and enum properties.
+	 */
+	Sorted
+};
+
+/*
+ * Declaration of secondary index on property of documents of one schema. See UGameDataBase::FindDocumentsByIndex().
+ */
+USTRUCT(BlueprintType)
+struct CHARON_API FGameDataDocumentIndexDeclaration
+{
+	GENERATED_BODY()
+
+	/*
+	 * Name or id of indexed schema.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Game Data")
+	FString SchemaName;
+	/*
+	 * Name of indexed property of schema's document class, e.g. 'Name' or 'Type'. Localized text property could be named without
+	 * 'Raw' suffix, e.g. 'Name' for UHero::NameRaw.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Game Data")
+	FName PropertyName;
+	/*
+	 * Type of index.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Game Data")
+	EGameDataDocumentIndexType Type = EGameDataDocumentIndexType::Hash;
+};
+
+/*
+ * Secondary indexes on document properties. Built once at end of load from declarations, then queried without allocation.
+ * Each index stores its documents in one array grouped by key (hash index) or sorted by key (sorted index),
+ * so lookup result is a view into this array. String keys are compared case-insensitively, as FString does.
+ */
+class CHARON_API FGameDataDocumentIndexes
+{
+private:
+	struct FIndex
+	{
+		FString SchemaName;
+		FName PropertyName;
+		EGameDataDocumentIndexType Type = EGameDataDocumentIndexType::Hash;
+		TArray<UGameDataDocument*> Documents;
+		TMap<FString, TPair<int32, int32>> DocumentsRangeByString;
+		TMap<int64, TPair<int32, int32>> DocumentsRangeByInteger;
+		/*
+		 * Keys of sorted index, only one of these arrays is filled. Integer keys are kept as is, so 64-bit values don't lose precision.
+		 */
+		TArray<double> SortedKeys;
+		TArray<int64> SortedIntegerKeys;
+		bool HasIntegerKeys = false;
+	};
+
+	TArray<FIndex> Indexes;
+
+	const FIndex* FindIndex(const FString& SchemaName, const FName PropertyName, const EGameDataDocumentIndexType Type) const;
+
+public:
+	/*
+	 * Build index of Declaration over Documents. Documents not of DocumentClass are skipped. Returns false and logs error
+	 * if property is not found or its type could not be indexed with declared index type.
+	 */
+	bool Build(const FGameDataDocumentIndexDeclaration& Declaration, const UClass* DocumentClass, const TArrayView<UGameDataDocument* const> Documents,
+		const FString& PrimaryLanguageId);
+	void Reset();
+
+	/*
+	 * Find documents with specified value of string/name/localized text property. Empty view if nothing is found or there is no such hash index.
+	 */
+	TArrayView<UGameDataDocument* const> Find(const FString& SchemaName, const FName PropertyName, const FString& Value) const;
+	/*
+	 * Find documents with specified value of integer/enum/bool property. Empty view if nothing is found or there is no such hash index.
+	 */
+	TArrayView<UGameDataDocument* const> Find(const FString& SchemaName, const FName PropertyName, const int64 Value) const;
+	/*
+	 * Find documents with property value in [Min, Max] range ordered by value. Empty view if nothing is found or there is no such sorted index.
+	 */
+	TArrayView<UGameDataDocument* const> FindInRange(const FString& SchemaName, const FName PropertyName, const double Min, const double Max) const;
+	/*
+	 * Same as FindInRange() with exact bounds for integer/enum properties, e.g. 64-bit values which are not representable as double.
+	 */
+	TArrayView<UGameDataDocument* const> FindInIntegerRange(const FString& SchemaName, const FName PropertyName, const int64 Min, const int64 Max) const;
+
+	bool IsEmpty() const { return Indexes.Num() == 0; }
+	SIZE_T GetAllocatedSize() const;
+};
@@ -22,8 +22,8 @@ struct CHARON_API FGameDataDocumentReference
 {
 	GENERATED_BODY()
 private:
-	mutable FStringView LastRevisionHash;
-	mutable TWeakObjectPtr<UGameDataDocument> LastDocument;
+	mutable uint32 LastLoadGeneration = 0;
+	mutable UGameDataDocument* LastDocument = nullptr;
 	
 public:
 	/*
@@ -53,10 +53,11 @@ public:
 
 	/*
 	 * True if currently cached document reference is actual in referenced UGameDataBase asset.
+	 * Cached document is resolved by load of game data (see UGameDataBase::GetLoadGeneration()) or on first GetReferencedDocument() call.
 	 */
 	bool IsActual() const
 	{
-		return !this->LastRevisionHash.IsEmpty() && this->LastRevisionHash.Equals(GameData->GetRevisionHash());
+		return this->LastLoadGeneration != 0 && GameData != nullptr && this->LastLoadGeneration == GameData->GetLoadGeneration();
 	}
 	
 	/*
@@ -66,17 +67,19 @@ public:
 	 */
 	UGameDataDocument* GetReferencedDocument() const
 	{
-		if (!IsValid())
+		if (this->IsActual())
 		{
-			return nullptr;
+			return this->LastDocument; // documents are not destroyed until next load generation
 		}
 
-		if (!this->IsActual())
+		if (!IsValid())
 		{
-			this->LastDocument = GameData->FindGameDataDocumentById(SchemaIdOrName, Id);
-			this->LastRevisionHash = GameData->GetRevisionHash();
+			return nullptr;
 		}
-		return this->LastDocument.Get();
+
+		this->LastDocument = GameData->FindGameDataDocumentById(SchemaIdOrName, Id);
+		this->LastLoadGeneration = GameData->GetLoadGeneration();
+		return this->LastDocument;
 	}
 
 	/*
@@ -85,7 +88,7 @@ public:
 	void ResetCachedValue() const
 	{
 		this->LastDocument = nullptr;
-		this->LastRevisionHash = FStringView();
+		this->LastLoadGeneration = 0;
 	}
 
 	/*
@@ -112,6 +115,39 @@ public:
 		}
 	}
 	
+	/*
+	 * Same as GetReferencedDocuments() but DocumentsById is rebuilt only when referenced game data is loaded again.
+	 * DocumentsLoadGeneration keeps load generation (see UGameDataBase::GetLoadGeneration()) DocumentsById was built for.
+	 */
+	template <typename IdType, typename DocumentType>
+	static const TMap<IdType, DocumentType*>& GetReferencedDocumentsCached(const TArray<FGameDataDocumentReference>& References, TMap<IdType, DocumentType*>& DocumentsById, uint32& DocumentsLoadGeneration)
+	{
+		const uint32 LoadGeneration = References.Num() > 0 && References[0].GameData != nullptr ? References[0].GameData->GetLoadGeneration() : 0;
+		if (LoadGeneration == 0 || LoadGeneration != DocumentsLoadGeneration)
+		{
+			GetReferencedDocuments(References, DocumentsById);
+			DocumentsLoadGeneration = LoadGeneration;
+		}
+		return DocumentsById;
+	}
+
+	/*
+	 * Call Func with each found document referenced by References collection. Doesn't allocate, not found documents are skipped.
+	 */
+	template <typename DocumentType, typename FuncType>
+	static void ForEachReferencedDocument(const TArray<FGameDataDocumentReference>& References, FuncType&& Func)
+	{
+		for (const auto& DocumentReference : References)
+		{
+			DocumentType* Document;
+			GetReferencedDocument(DocumentReference, Document);
+			if (Document != nullptr)
+			{
+				Func(Document);
+			}
+		}
+	}
+	
 	/*
 	 * Get referenced document and put it into specified Document& output parameter.
 	 */
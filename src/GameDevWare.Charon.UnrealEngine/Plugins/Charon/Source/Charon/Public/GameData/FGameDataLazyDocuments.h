@@ -0,0 +1,156 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EGameDataFormat.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "Templates/SharedPointer.h"
+#include "FGameDataDocumentIdConvert.h"
+#include "Formatters/IGameDataReader.h"
+
+/*
+ * Raw serialized documents of game data loaded with FGameDataLoadOptions::LazyDocuments.
+ * Keeps own copy of game data buffer and byte range of each root document by schema name and document id, so derived
+ * game data class creates document only on first access (see FindGameDataDocumentById).
+ * Ids of embedded documents are recorded with their root documents, so embedded document is found by creating only
+ * its owners. Objects with only 'Id' and 'DisplayName' members are references and are not recorded.
+ * Buffer is copied because caller's buffer is valid only during TryLoad, copy is still much smaller than created documents.
+ */
+class CHARON_API FGameDataLazyDocuments
+{
+private:
+	TArray<uint8> Buffer;
+	TSharedPtr<IGameDataReader> Reader;
+	TMap<FString, TMap<FString, TArrayView<const uint8>>> RawDocumentsBySchema;
+	TMultiMap<FString, TPair<FString, FString>> EmbeddedDocumentOwners;
+	int32 RawDocumentCount;
+
+public:
+	FGameDataLazyDocuments();
+	FGameDataLazyDocuments(const FGameDataLazyDocuments&) = delete;
+	FGameDataLazyDocuments& operator=(const FGameDataLazyDocuments&) = delete;
+
+	/*
+	 * Copy game data buffer and create reader over copy. Game data should be read with returned reader, so raw documents
+	 * point into owned buffer. Returns nullptr for formats which reader could not capture raw values.
+	 */
+	TSharedPtr<IGameDataReader> Open(const TArrayView<const uint8> GameDataBuffer, EGameDataFormat Format);
+	/*
+	 * Whether specified reader is one returned by Open().
+	 */
+	bool IsReader(const IGameDataReader& GameDataReader) const { return Reader.Get() == &GameDataReader; }
+
+	/*
+	 * Add root document reader is positioned on and move reader past it. Document's bytes, its 'Id' and ids of documents
+	 * embedded into it are collected in one walk over document's tokens, other values are not decoded.
+	 * DocumentReader is reader returned by Open() or TGameDataReader over it.
+	 */
+	template <typename ReaderType, typename IdType>
+	bool ReadDocument(ReaderType& DocumentReader, const FString& SchemaName, IdType& OutDocumentId)
+	{
+		const uint8* DocumentStart = nullptr;
+		const uint8* DocumentEnd = nullptr;
+		if (DocumentReader.GetNotation() != EJsonNotation::ObjectStart || !DocumentReader.GetRawTokenBounds(DocumentStart, DocumentEnd))
+		{
+			return false;
+		}
+
+		bool HasDocumentId = false;
+		TArray<FEmbeddedScope, TInlineAllocator<16>> Scopes;
+		TArray<FString> EmbeddedDocumentIds;
+		do
+		{
+			const EJsonNotation Notation = DocumentReader.GetNotation();
+			const bool IsMember = Scopes.Num() > 0 && Scopes.Last().IsObject;
+			const FStringView MemberName = IsMember ? DocumentReader.GetIdentifierView() : FStringView();
+			const bool IsIdMember = IsMember && MemberName.Equals(TEXT("Id"), ESearchCase::IgnoreCase);
+			if (IsMember && !IsIdMember && !MemberName.Equals(TEXT("DisplayName"), ESearchCase::IgnoreCase) &&
+				Notation != EJsonNotation::ObjectEnd && Notation != EJsonNotation::Null)
+			{
+				Scopes.Last().HasMembers = true;
+			}
+
+			switch (Notation)
+			{
+			case EJsonNotation::ObjectStart:
+			case EJsonNotation::ArrayStart:
+				Scopes.Add(FEmbeddedScope { Notation == EJsonNotation::ObjectStart, false, FString() });
+				break;
+			case EJsonNotation::ObjectEnd:
+			case EJsonNotation::ArrayEnd:
+				{
+					const FEmbeddedScope Scope = Scopes.Pop();
+					if (Scopes.Num() > 0 && Scope.IsObject && Scope.HasMembers && !Scope.Id.IsEmpty())
+					{
+						EmbeddedDocumentIds.Add(Scope.Id);
+					}
+					break;
+				}
+			case EJsonNotation::String:
+			case EJsonNotation::Number:
+				if (IsIdMember && Scopes.Num() == 1)
+				{
+					// root document's id is read as declared id type, so it is converted to string the same way on lookup
+					HasDocumentId = DocumentReader.ReadValue(OutDocumentId);
+				}
+				else if (IsIdMember && Notation == EJsonNotation::String)
+				{
+					Scopes.Last().Id = FString(DocumentReader.GetValueAsStringView());
+				}
+				else if (IsIdMember)
+				{
+					FGameDataDocumentIdConvert::ConvertToString(DocumentReader.GetValueAsInt64(), Scopes.Last().Id);
+				}
+				break;
+			case EJsonNotation::Error:
+				return false;
+			default:
+				break;
+			}
+		} while (Scopes.Num() > 0 && DocumentReader.ReadNext());
+
+		const uint8* ClosingTokenStart = nullptr;
+		FString DocumentId;
+		if (Scopes.Num() > 0 || !HasDocumentId || !DocumentReader.GetRawTokenBounds(ClosingTokenStart, DocumentEnd) ||
+			!FGameDataDocumentIdConvert::ConvertToString(OutDocumentId, DocumentId))
+		{
+			return false;
+		}
+		DocumentReader.ReadNext();
+
+		Add(SchemaName, DocumentId, TArrayView<const uint8>(DocumentStart, static_cast<int32>(DocumentEnd - DocumentStart)), EmbeddedDocumentIds);
+		return true;
+	}
+
+	bool Contains(const FString& SchemaName, const FString& DocumentId) const;
+	/*
+	 * Get schema name and id of root documents containing embedded document with specified id. Embedded documents of
+	 * different schemas could share id, so there could be more than one owner. Owners are kept after they are taken.
+	 */
+	void GetEmbeddedDocumentOwners(const FString& DocumentId, TArray<TPair<FString, FString>>& OutOwners) const;
+	/*
+	 * Remove raw document and create reader positioned on its start. Returns nullptr if document is not found.
+	 */
+	TSharedPtr<IGameDataReader> Take(const FString& SchemaName, const FString& DocumentId);
+
+	void GetSchemaNames(TArray<FString>& OutSchemaNames) const;
+	void GetDocumentIds(const FString& SchemaName, TArray<FString>& OutDocumentIds) const;
+	int32 Num() const { return RawDocumentCount; }
+	bool IsEmpty() const { return RawDocumentCount == 0; }
+
+	void Reset();
+
+private:
+	struct FEmbeddedScope
+	{
+		bool IsObject;
+		bool HasMembers; // other than 'Id' and 'DisplayName'
+		FString Id;
+	};
+
+	void Add(const FString& SchemaName, const FString& DocumentId, const TArrayView<const uint8> RawDocument, const TArray<FString>& EmbeddedDocumentIds);
+};
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "EGameDataFormat.h"
+#include "FGameDataLoadStats.h"
+#include "FGameDataDocumentIndexes.h"
 #include "CoreMinimal.h"
 #include "Containers/Array.h"
 #include "Templates/SharedPointer.h"
@@ -12,7 +14,7 @@
  */
 struct FGameDataLoadOptions
 {
-	FGameDataLoadOptions() : Format(EGameDataFormat::Json)
+	FGameDataLoadOptions() : Format(EGameDataFormat::Json), LazyDocuments(false), PoolLocalizedTexts(false), BuildReferrersIndex(false), Stats(nullptr)
 	{  }
 
 public:
@@ -24,5 +26,38 @@ public:
 	 * Optional list of patches to apply on game data in same format as primary stream. Values SHOULD NOT be nullptr. 
 	 */
 	TArray<FArchive*> Patches;
+	/*
+	 * Create documents on first access instead of during load. Each document is still walked token by token once during load to find
+	 * its bytes, its id and ids of embedded documents, other values are not decoded and documents are not created. Game data keeps copy of buffer
+	 * to create documents from, see FGameDataLazyDocuments. Used by TryLoad(TArrayView) without Patches, settings documents are always created.
+	 * Documents which were not accessed yet are missing from collection maps and GetAllDocuments(), call LoadAllDocuments() to create them.
+	 * Referrers index and document indexes are not built with this option.
+	 */
+	bool LazyDocuments;
+	/*
+	 * Keep localized texts in game data's FGameDataLocalizedStringPool as UTF-8 instead of FText per language, FText is created only for
+	 * displayed language. TextByLanguageId of pooled FLocalizedText is empty and pooled texts are not serialized with asset, so this
+	 * option is for runtime loading only.
+	 */
+	bool PoolLocalizedTexts;
+	/*
+	 * Optional list of BCP-47 language tags to load localized texts for. Texts of other languages are skipped while reading and never
+	 * decoded, SupportedLanguages is limited to listed languages. Include primary language to keep fallback texts. Empty list loads all languages.
+	 */
+	TArray<FString> Languages;
+	/*
+	 * Build index of referencing documents while references are linked at end of load, see UGameDataBase::GetReferrers().
+	 * Not built for lazily loaded documents.
+	 */
+	bool BuildReferrersIndex;
+	/*
+	 * Secondary indexes to build at end of load in addition to UGameDataBase::IndexDeclarations, see UGameDataBase::FindDocumentsByIndex().
+	 * Not built for lazily loaded documents.
+	 */
+	TArray<FGameDataDocumentIndexDeclaration> DocumentIndexes;
+	/*
+	 * Optional stats to fill with load time, bytes, documents, references and allocations per collection and load phases. Could be nullptr.
+	 */
+	FGameDataLoadStats* Stats;
 };
 
@@ -0,0 +1,72 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EGameDataFormat.h"
+#include "Containers/Array.h"
+#include "Containers/StringView.h"
+#include "Containers/UnrealString.h"
+#include "Trace/Trace.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogFGameDataLoadStats, Log, All);
+
+/*
+ * Insights trace channel of game data loading. CPU profiler scopes of load phases and collections are emitted on it.
+ * Enable with '-trace=cpu,Charon'.
+ */
+UE_TRACE_CHANNEL_EXTERN(CharonChannel, CHARON_API);
+
+/*
+ * Load stats of one game data collection. Bytes is size of collection's serialized value, it is 0 when game data is read from stream.
+ * Allocations are UObjects created while collection was read, References are document references read from collection.
+ */
+struct CHARON_API FGameDataCollectionLoadStats
+{
+	FString Name;
+	double Seconds = 0;
+	int64 Bytes = 0;
+	int32 Documents = 0;
+	int32 References = 0;
+	int32 Allocations = 0;
+};
+
+/*
+ * Stats of game data load made by TryLoad. Filled when passed in FGameDataLoadOptions::Stats,
+ * last load's stats are also kept and could be printed with 'Charon.DumpLoadStats' console command.
+ */
+struct CHARON_API FGameDataLoadStats
+{
+	FString GameDataName;
+	EGameDataFormat Format = EGameDataFormat::Json;
+	bool IsSucceeded = false;
+
+	double TotalSeconds = 0;
+	double ParseSeconds = 0;
+	double PatchMergeSeconds = 0;
+	double FindAllDocumentsSeconds = 0;
+	double UpdateSettingsSeconds = 0;
+	double ResolveReferencesSeconds = 0;
+	int32 UnresolvedReferences = 0;
+	int64 ReferrersIndexBytes = 0;
+	double BuildIndexesSeconds = 0;
+	int64 DocumentIndexesBytes = 0;
+
+	TArray<FGameDataCollectionLoadStats> Collections;
+
+	/*
+	 * Start measuring collection. DocumentCount and ReferenceCount are loader's running totals, same totals should be passed to EndCollection().
+	 */
+	void BeginCollection(const FStringView& Name, const int64 Bytes, const int32 DocumentCount, const int32 ReferenceCount);
+	void EndCollection(const int32 DocumentCount, const int32 ReferenceCount);
+
+	int32 GetTotalDocuments() const;
+	int64 GetTotalBytes() const;
+	/*
+	 * Format stats as text table, one line per collection sorted by time.
+	 */
+	FString ToTable() const;
+
+	static void SetLastLoadStats(const FGameDataLoadStats& LoadStats);
+	static const FGameDataLoadStats& GetLastLoadStats();
+};
@@ -0,0 +1,72 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Array.h"
+#include "Containers/StringView.h"
+#include "Containers/UnrealString.h"
+#include "Internationalization/Text.h"
+
+/*
+ * Localized texts of game data stored per language in one UTF-8 column. Used with FGameDataLoadOptions::PoolLocalizedTexts,
+ * each FLocalizedText keeps only text index into pool and creates FText only for displayed language (see FLocalizedText::GetCurrent()).
+ * Language ids are stored once per column instead of once per text.
+ */
+class CHARON_API FGameDataLocalizedStringPool
+{
+private:
+	struct FTextRange
+	{
+		int32 Offset = INDEX_NONE;
+		int32 Length = 0;
+	};
+
+	struct FLanguageColumn
+	{
+		FString LanguageId;
+		TArray<UTF8CHAR> Chars;
+		TArray<FTextRange> Ranges;
+	};
+
+	TArray<FLanguageColumn> Columns;
+	int32 TextCount;
+	int32 LastColumnIndex;
+
+	int32 FindOrAddLanguage(const FStringView LanguageId);
+
+public:
+	FGameDataLocalizedStringPool();
+
+	/*
+	 * Reserve new text index. Text is not defined for any language until SetText() is called.
+	 */
+	int32 AddText();
+	/*
+	 * Set text of specified language for text index returned by AddText(). Empty texts and language ids are ignored.
+	 */
+	void SetText(const int32 TextIndex, const FStringView LanguageId, const FStringView Text);
+
+	/*
+	 * Find index of language column or INDEX_NONE if no text is defined for this language.
+	 */
+	int32 FindLanguage(const FStringView LanguageId) const;
+	bool HasText(const int32 LanguageIndex, const int32 TextIndex) const;
+	/*
+	 * Create FText from pooled UTF-8 text. Returns empty FText if text is not defined for this language.
+	 */
+	FText GetText(const int32 LanguageIndex, const int32 TextIndex) const;
+	/*
+	 * Create FText for each language with defined text and add it into TextByLanguageId map.
+	 */
+	void GetTexts(const int32 TextIndex, TMap<FString, FText>& TextByLanguageId) const;
+
+	/*
+	 * Drop language columns which are not listed in LanguageIds. Used by SetSupportedLanguages().
+	 */
+	void RemoveLanguagesExcept(const TArray<FString>& LanguageIds);
+
+	int32 NumTexts() const { return TextCount; }
+	int32 NumLanguages() const { return Columns.Num(); }
+	SIZE_T GetAllocatedSize() const;
+};
@@ -0,0 +1,37 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Templates/UniquePtr.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/*
+ * Read-only view of game data file for TryLoad(TArrayView) methods. File is memory mapped when platform supports it,
+ * so only one copy of file is in memory during load. Otherwise (e.g. file is inside .pak) file is read into memory.
+ * Data is valid until this object is destroyed.
+ */
+class CHARON_API FGameDataMappedFile
+{
+private:
+	TUniquePtr<IMappedFileHandle> MappedFileHandle;
+	TUniquePtr<IMappedFileRegion> MappedFileRegion;
+	TArray<uint8> FileBytes;
+	TArrayView<const uint8> Data;
+
+public:
+	FGameDataMappedFile();
+	~FGameDataMappedFile();
+
+	/*
+	 * Map or read specified file. Returns false if file is not found or can't be read.
+	 */
+	bool Open(const FString& FilePath);
+
+	TArrayView<const uint8> GetData() const { return Data; }
+	bool IsMapped() const { return MappedFileRegion.IsValid(); }
+};
@@ -0,0 +1,85 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/Optional.h"
+#include "Templates/SharedPointer.h"
+#include "Formatters/IGameDataReader.h"
+
+class UGameDataBase;
+
+/*
+ * Documents of game data patches (see FGameDataLoadOptions::Patches) by schema and document id.
+ * Patches are read into this index before game data, then derived game data class applies them to documents while game data
+ * is streamed with normal reader, so only patched documents are read as FJsonValue and game data itself never is.
+ * Each document keeps one value per patch in order of patches, null value means document is deleted by patch.
+ */
+class CHARON_API FGameDataPatchIndex
+{
+private:
+	struct FSchemaPatches
+	{
+		FString SchemaName;
+		TMap<FString, TArray<TSharedPtr<FJsonValue>>> PatchesByDocumentId;
+	};
+
+	TMap<const UClass*, FSchemaPatches> PatchesBySchema;
+	TOptional<int32> ChangeNumber;
+	TOptional<FString> RevisionHash;
+	int32 PatchedDocumentCount;
+
+	bool ReadCollections(IGameDataReader& PatchReader, UGameDataBase& GameData);
+	void AddDocumentPatch(const UClass* DocumentClass, const FStringView SchemaName, const FString& DocumentId, const TSharedPtr<FJsonValue>& DocumentPatch);
+
+public:
+	FGameDataPatchIndex();
+
+	/*
+	 * Read patch from initialized reader (see IGameDataReader::ReadNext()) and add its documents after ones of previously added patches.
+	 * Schemas are resolved with UGameDataBase::FindDocumentSchemaClass(), documents of unknown schemas are skipped.
+	 */
+	bool AddPatch(IGameDataReader& PatchReader, UGameDataBase& GameData);
+
+	bool HasPatches(const UClass* DocumentClass) const;
+	/*
+	 * Remove patches of specified document and return them in order of patches. Returns false if document is not patched.
+	 */
+	bool Take(const UClass* DocumentClass, const FString& DocumentId, TArray<TSharedPtr<FJsonValue>>& OutDocumentPatches);
+	/*
+	 * Remove patches of all remaining documents of specified schema, these documents are missing in game data.
+	 */
+	void TakeAll(const UClass* DocumentClass, TArray<TPair<FString, TArray<TSharedPtr<FJsonValue>>>>& OutPatchesByDocumentId);
+	/*
+	 * Get names of schemas with remaining documents, as they were named in patches.
+	 */
+	void GetSchemaNames(TArray<FString>& OutSchemaNames) const;
+
+	/*
+	 * ChangeNumber and RevisionHash of last patch which has them.
+	 */
+	const TOptional<int32>& GetChangeNumber() const { return ChangeNumber; }
+	const TOptional<FString>& GetRevisionHash() const { return RevisionHash; }
+
+	int32 Num() const { return PatchedDocumentCount; }
+	bool IsEmpty() const { return PatchedDocumentCount == 0; }
+	void Reset();
+
+	/*
+	 * Get 'Id' of document as string key of this index. Returns false if document has no id.
+	 */
+	static bool GetDocumentId(const FJsonObject& Document, FString& OutDocumentId);
+	/*
+	 * Read 'Id' of document reader is positioned on as string key of this index. Other members are skipped without decoding,
+	 * so reader is left inside of document. Returns false if document has no id.
+	 */
+	static bool ReadDocumentId(IGameDataReader& DocumentReader, FString& OutDocumentId);
+
+private:
+	static bool GetDocumentId(const TSharedPtr<FJsonValue>& IdValue, FString& OutDocumentId);
+};
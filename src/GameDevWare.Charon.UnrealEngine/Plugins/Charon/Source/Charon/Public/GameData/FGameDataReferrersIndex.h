@@ -0,0 +1,63 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "UObject/NameTypes.h"
+#include "UGameDataDocument.h"
+
+#include "FGameDataReferrersIndex.generated.h"
+
+/*
+ * Document which references other document through specified property. Returned by UGameDataBase::GetReferrers().
+ */
+USTRUCT(BlueprintType)
+struct CHARON_API FGameDataDocumentReferrer
+{
+	GENERATED_BODY()
+
+	/*
+	 * Referencing document.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category="Game Data")
+	TObjectPtr<UGameDataDocument> Document;
+	/*
+	 * Name of referencing property of Document.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category="Game Data")
+	FName PropertyName;
+};
+
+/*
+ * Index of referencing documents by referenced document. Built by reference linking at end of load when
+ * FGameDataLoadOptions::BuildReferrersIndex is set. Referrers are stored in one array sorted by referenced document,
+ * so index costs one FGameDataDocumentReferrer per reference and one map entry per referenced document.
+ */
+class CHARON_API FGameDataReferrersIndex
+{
+private:
+	TArray<TPair<const UGameDataDocument*, FGameDataDocumentReferrer>> PendingReferrers;
+	TArray<FGameDataDocumentReferrer> Referrers;
+	TMap<const UGameDataDocument*, TPair<int32, int32>> ReferrersRangeByDocument;
+
+public:
+	/*
+	 * Add reference from Referrer's PropertyName to ReferencedDocument. Index is not queryable until Finalize() is called.
+	 */
+	void Add(const UGameDataDocument* ReferencedDocument, UGameDataDocument* Referrer, const FName PropertyName);
+	/*
+	 * Group added references by referenced document.
+	 */
+	void Finalize();
+	void Reset();
+
+	/*
+	 * Get documents referencing specified document. Empty view if document is not referenced or index is not built.
+	 */
+	TArrayView<const FGameDataDocumentReferrer> GetReferrers(const UGameDataDocument* Document) const;
+	bool IsEmpty() const { return Referrers.Num() == 0; }
+	SIZE_T GetAllocatedSize() const;
+};
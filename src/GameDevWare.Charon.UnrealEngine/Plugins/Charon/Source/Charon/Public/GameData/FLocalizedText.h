@@ -9,12 +9,14 @@
 #include "Templates/SharedPointer.h"
 #include "Internationalization/Text.h"
 #include "ULanguageSwitcher.h"
+#include "FGameDataLocalizedStringPool.h"
 
 #include "FLocalizedText.generated.h"
 
 /*
  * Collection of translated text by BCP-47 language tag.
- * Internally it is just Map of FText by language tag.
+ * Internally it is just Map of FText by language tag, or index of text in FGameDataLocalizedStringPool when game data is loaded with
+ * FGameDataLoadOptions::PoolLocalizedTexts. Pooled text has empty TextByLanguageId map, use TryGetText() to read text of any language.
  * To change value returned by GetCurrent() use SetLanguage() method on your UGameDataBase-derived class.
  */
 USTRUCT(BlueprintType)
@@ -23,17 +25,24 @@ struct CHARON_API FLocalizedText
 	GENERATED_BODY()
 
 private:
-	mutable FString CurrentValueLanguageId;
+	mutable uint32 CurrentValueLanguageEpoch;
 	mutable FText Current;
+	TSharedPtr<const FGameDataLocalizedStringPool> StringPool;
+	int32 StringPoolIndex;
 	
 	UPROPERTY()
 	ULanguageSwitcher* LanguageSwitcher;
+
+	bool TryGetPooledText(const FString& LanguageId, FText& OutText) const;
 	
 public:
 	FLocalizedText();
 	FLocalizedText(const FLocalizedText& Other);
 	FLocalizedText(const TMap<FString, FText>& TextByLanguageId,
 					 ULanguageSwitcher* LanguageSwitcher);
+	FLocalizedText(const TSharedPtr<const FGameDataLocalizedStringPool>& StringPool,
+					 const int32 StringPoolIndex,
+					 ULanguageSwitcher* LanguageSwitcher);
 
 	/*
 	 * Map of FText by BCP-47 language tag. Values could be empty FTexts. Not all supported language tags could present in map.
@@ -45,5 +54,9 @@ public:
 	 * Get FText of currently selected language. Use SetLanguage() method on your UGameDataBase-derived class to change current FText for whole game data.
 	 */
 	FText GetCurrent() const;
+	/*
+	 * Get non-empty FText of specified BCP-47 language tag. Works for both TextByLanguageId and pooled texts.
+	 */
+	bool TryGetText(const FString& LanguageId, FText& OutText) const;
 };
 
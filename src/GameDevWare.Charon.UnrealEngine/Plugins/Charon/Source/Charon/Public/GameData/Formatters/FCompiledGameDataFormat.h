@@ -0,0 +1,127 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreTypes.h"
+
+/*
+ * Layout of compiled game data image (EGameDataFormat::Compiled). Image is produced from JSON/MessagePack game data
+ * by FCompiledGameDataWriter and read in place by FCompiledGameDataReader.
+ *
+ * [FCompiledGameDataHeader]
+ * [FCompiledGameDataString x StringCount] - directory of deduplicated UTF-8 strings (member names and string values)
+ * [UTF-8 string bytes]
+ * [FCompiledGameDataToken x TokenCount] - fixed size token records in document order
+ *
+ * All sections are 8-byte aligned and all values are little-endian.
+ *
+ * Image is schema-agnostic token stream of source game data, not per-schema tables of fixed-layout document records.
+ * Generated ReadDocument code reads it like any other format, but without text parsing, number conversion or string
+ * allocation for member names, and containers are skipped in O(1). Per-schema record tables would tie image to generator
+ * version of game data class and are out of scope of this format.
+ */
+struct FCompiledGameDataFormat
+{
+	/*
+	 * 'CGDI' in little-endian.
+	 */
+	static constexpr uint32 Magic = 0x49444743u;
+	/*
+	 * Should be incremented on each change of layout. Images with other version are rejected: UGameDataBase::TryLoadCompiledFile
+	 * ignores such image and loads game data from source until it is re-imported, compiled cache keeps entries per version.
+	 */
+	static constexpr uint32 FormatVersion = 1;
+	static constexpr uint32 SourceHashSize = 20;
+	static constexpr uint32 NoIdentifier = 0xFFFFFFFFu;
+	static constexpr uint32 SectionAlignment = 8;
+};
+
+/*
+ * Type of value stored in FCompiledGameDataToken::Value.
+ */
+enum class ECompiledGameDataValueType : uint8
+{
+	/*
+	 * No value (null, object/array end).
+	 */
+	None,
+	/*
+	 * Index of string in string directory.
+	 */
+	String,
+	/*
+	 * Bits of double value.
+	 */
+	Double,
+	/*
+	 * Signed 64-bit integer.
+	 */
+	Int64,
+	/*
+	 * Unsigned 64-bit integer greater than INT64_MAX.
+	 */
+	UInt64,
+	/*
+	 * 0 or 1.
+	 */
+	Boolean,
+	/*
+	 * Index of matching object/array end token. Used to skip containers without visiting their tokens.
+	 */
+	ClosingToken
+};
+
+struct FCompiledGameDataHeader
+{
+	uint32 Magic;
+	uint32 FormatVersion;
+	/*
+	 * SHA-1 of source game data file. Used to detect stale images.
+	 */
+	uint8 SourceHash[FCompiledGameDataFormat::SourceHashSize];
+	uint32 StringCount;
+	uint32 TokenCount;
+	uint32 Reserved;
+	uint64 StringDirectoryOffset;
+	uint64 StringDataOffset;
+	uint64 TokenTableOffset;
+	uint64 ImageSize;
+};
+static_assert(sizeof(FCompiledGameDataHeader) == 72, "Compiled game data header layout is changed. Increment FormatVersion.");
+
+struct FCompiledGameDataString
+{
+	/*
+	 * Offset of UTF-8 bytes relative to FCompiledGameDataHeader::StringDataOffset.
+	 */
+	uint32 Offset;
+	/*
+	 * Length in bytes.
+	 */
+	uint32 Length;
+	/*
+	 * Pre-computed FGameDataMemberNameHash of string, so member names are never hashed during load.
+	 */
+	uint32 NameHash;
+	uint32 Reserved;
+};
+static_assert(sizeof(FCompiledGameDataString) == 16, "Compiled game data string layout is changed. Increment FormatVersion.");
+
+struct FCompiledGameDataToken
+{
+	/*
+	 * EJsonNotation of token.
+	 */
+	uint8 Notation;
+	/*
+	 * ECompiledGameDataValueType of Value.
+	 */
+	uint8 ValueType;
+	uint16 Reserved;
+	/*
+	 * Index of member name in string directory or FCompiledGameDataFormat::NoIdentifier.
+	 */
+	uint32 Identifier;
+	uint64 Value;
+};
+static_assert(sizeof(FCompiledGameDataToken) == 16, "Compiled game data token layout is changed. Increment FormatVersion.");
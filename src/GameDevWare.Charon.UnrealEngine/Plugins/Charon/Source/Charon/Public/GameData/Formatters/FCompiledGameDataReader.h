@@ -0,0 +1,81 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "IGameDataReader.h"
+#include "FCompiledGameDataFormat.h"
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/UnrealString.h"
+#include "Templates/SharedPointer.h"
+#include "Serialization/JsonTypes.h"
+#include "Serialization/Archive.h"
+
+/*
+ * Reader of compiled game data image (see FCompiledGameDataFormat.h). Tokens are fixed size records, so reading is
+ * a walk over token table without any parsing. Member names carry pre-computed hashes and strings are decoded from
+ * shared string pool once, so repeating member names and values are not decoded again. Readers created with
+ * CreateRawValueReader() share decoded strings with their parent reader, so they should not be used concurrently with it.
+ * SkipAny() and ReadRawValue() jump to matching closing token in O(1).
+ */
+class CHARON_API FCompiledGameDataReader final : public IGameDataReader
+{
+private:
+	TArray<uint8> OwnedBuffer;
+	const uint8* Image;
+	int64 ImageSize;
+	const FCompiledGameDataString* Strings;
+	const uint8* StringData;
+	const FCompiledGameDataToken* Tokens;
+	uint32 StringCount;
+	int64 FirstTokenIndex;
+	int64 EndTokenIndex;
+	int64 TokenIndex;
+	const FCompiledGameDataToken* Token;
+	EJsonNotation Notation;
+	FString ErrorMessage;
+	FString EmptyString;
+	TSharedRef<TArray<FString>> DecodedStrings;
+
+	FCompiledGameDataReader(const FCompiledGameDataReader& ParentReader, int64 FirstTokenIndex, int64 EndTokenIndex);
+
+	void Initialize(const TArrayView<const uint8> Buffer);
+	bool IsValidToken(const FCompiledGameDataToken& NextToken) const;
+	const FString& GetString(uint32 StringIndex) const;
+	void SetErrorMessage(const FString& Message);
+
+public:
+	/*
+	 * Create reader over remaining bytes of archive. Whole content is read into internal buffer.
+	 */
+	explicit FCompiledGameDataReader(FArchive* const Stream);
+	/*
+	 * Create reader over in-memory image. Image should outlive reader. Image is copied only if it is not 8-byte aligned.
+	 */
+	explicit FCompiledGameDataReader(const TArrayView<const uint8> Buffer);
+
+	/*
+	 * Read and validate header of compiled image. Returns false if image is truncated, not a compiled image or has other FormatVersion.
+	 */
+	static bool ReadHeader(const TArrayView<const uint8> Buffer, FCompiledGameDataHeader& OutHeader);
+
+	virtual bool ReadNext() override;
+	virtual const FString& GetIdentifier() const override;
+	virtual const FString& GetValueAsString() const override;
+	virtual FStringView GetIdentifierView() const override { return GetIdentifier(); }
+	virtual FStringView GetValueAsStringView() const override { return GetValueAsString(); }
+	virtual uint32 GetIdentifierHash() const override;
+	virtual double GetValueAsNumber() const override;
+	virtual int64 GetValueAsInt64() override;
+	virtual uint64 GetValueAsUInt64() override;
+	virtual bool GetValueAsBoolean() const override;
+	virtual const FString& GetErrorMessage() const override { return ErrorMessage; }
+	virtual EJsonNotation GetNotation() override { return Notation; }
+	virtual void SetErrorState(const FString& Message) override;
+	virtual void SkipAny(const bool NextToken = true) override;
+	virtual EGameDataReaderType GetReaderType() const override { return EGameDataReaderType::Compiled; }
+	virtual bool ReadRawValue(TArrayView<const uint8>& RawValue, const bool NextToken = true) override;
+	virtual TSharedPtr<IGameDataReader> CreateRawValueReader(const TArrayView<const uint8> RawValue) const override;
+	virtual bool GetRawTokenBounds(const uint8*& OutTokenStart, const uint8*& OutTokenEnd) const override;
+};
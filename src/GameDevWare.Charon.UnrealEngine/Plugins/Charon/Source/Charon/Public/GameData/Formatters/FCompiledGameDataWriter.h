@@ -0,0 +1,60 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IGameDataReader.h"
+#include "GameData/EGameDataFormat.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/UnrealString.h"
+#include "Misc/SecureHash.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogFCompiledGameDataWriter, Log, All);
+
+/*
+ * Writer of compiled game data image (see FCompiledGameDataFormat.h). Image is compiled from JSON/MessagePack game data
+ * by editor at import time and stored next to source file, so later loads could use EGameDataFormat::Compiled. At runtime
+ * images are only written into FGameDataCompiledCache under 'Saved' directory.
+ * Image remembers SHA-1 of source file, images compiled from other source or with other format version are considered stale.
+ * Loading code checks RevisionHash instead (see IsCompiledFromRevision), so source is not hashed on each load.
+ */
+class CHARON_API FCompiledGameDataWriter
+{
+public:
+	/*
+	 * Extension appended to source game data file path to get compiled image path, e.g. 'RpgGameData.gdjs.gdcb'.
+	 */
+	static constexpr const TCHAR* COMPILED_FILE_EXTENSION = TEXT(".gdcb");
+
+	/*
+	 * Write all tokens of freshly created GameDataReader into compiled image.
+	 */
+	static bool Write(IGameDataReader& GameDataReader, const FSHAHash& SourceHash, TArray<uint8>& OutImage);
+	/*
+	 * Compile in-memory game data in specified format into compiled image.
+	 */
+	static bool Compile(const TArrayView<const uint8> SourceBuffer, EGameDataFormat SourceFormat, TArray<uint8>& OutImage);
+	/*
+	 * Compile in-memory game data and save image to GetCompiledFilePath(SourceFilePath). Failure to save image is not an error,
+	 * OutImage is still could be used. Used by editor import, runtime code should not write next to source files.
+	 */
+	static bool CompileFile(const FString& SourceFilePath, const TArrayView<const uint8> SourceBuffer, EGameDataFormat SourceFormat, TArray<uint8>& OutImage);
+	/*
+	 * Check if Image is valid compiled image of current format version made from SourceBuffer.
+	 */
+	static bool IsCompiledFrom(const TArrayView<const uint8> Image, const TArrayView<const uint8> SourceBuffer);
+	/*
+	 * Check if Image is valid compiled image of current format version with same RevisionHash as SourceBuffer. Only root members
+	 * before 'Collections' are read from source and image, so check doesn't depend on size of game data. Falls back to
+	 * IsCompiledFrom() when source has no RevisionHash.
+	 */
+	static bool IsCompiledFromRevision(const TArrayView<const uint8> Image, const TArrayView<const uint8> SourceBuffer, EGameDataFormat SourceFormat);
+	/*
+	 * Read 'RevisionHash' root member of game data in any format. Documents are skipped. Returns false if game data has no RevisionHash.
+	 */
+	static bool ReadRevisionHash(const TArrayView<const uint8> GameDataBuffer, EGameDataFormat Format, FString& OutRevisionHash);
+
+	static FSHAHash GetSourceHash(const TArrayView<const uint8> SourceBuffer);
+	static FString GetCompiledFilePath(const FString& SourceFilePath) { return SourceFilePath + COMPILED_FILE_EXTENSION; }
+};
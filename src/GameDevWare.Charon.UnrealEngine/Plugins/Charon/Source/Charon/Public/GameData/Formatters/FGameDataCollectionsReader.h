@@ -0,0 +1,72 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "IGameDataReader.h"
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/UnrealString.h"
+#include "Containers/StringView.h"
+#include "Templates/SharedPointer.h"
+
+/*
+ * Reader of game data's "Collections" object for UGameDataBase::ReadGameData methods.
+ * When source reader is backed by in-memory buffer, reader pre-scans collections' byte ranges and compiles each collection
+ * into compact image of fixed-size token records (see FCompiledGameDataWriter) concurrently on task graph, then collections
+ * are read one by one with FCompiledGameDataReader, which is statically dispatched like source readers (see FGameDataReaderDispatch).
+ * Small game data, compiled game data and stream readers are read sequentially from source reader.
+ */
+class CHARON_API FGameDataCollectionsReader
+{
+private:
+	struct FCollection
+	{
+		FString Name;
+		TArrayView<const uint8> RawValue;
+		TArray<uint8> CompiledValue;
+		FString ErrorMessage;
+	};
+
+	TSharedRef<IGameDataReader> Reader;
+	TSharedPtr<IGameDataReader> CollectionReader;
+	TArray<FCollection> Collections;
+	int32 CollectionIndex;
+	int64 MinParallelSize;
+	bool IsSequential;
+	bool IsDecodedInParallel;
+	FString ErrorMessage;
+
+	void DecodeCollections();
+	void SetErrorMessage(const FString& Message);
+
+public:
+	/*
+	 * Default total size of collections at which they are decoded in parallel.
+	 */
+	static constexpr int64 DEFAULT_MIN_PARALLEL_SIZE = 256 * 1024; // 256 KiB
+
+	explicit FGameDataCollectionsReader(const TSharedRef<IGameDataReader>& Reader, int64 MinParallelSize = DEFAULT_MIN_PARALLEL_SIZE);
+
+	/*
+	 * Start reading "Collections" object. Source reader should be positioned on object's start.
+	 */
+	bool ReadBegin();
+	/*
+	 * Move to next collection. Returns false when there are no more collections or error occurred, see IsError().
+	 * Collection's reader is positioned on collection's value. Name and reader are valid until next call.
+	 */
+	bool ReadNextCollection(FStringView& CollectionName);
+	TSharedRef<IGameDataReader> GetCollectionReader() const { return CollectionReader.ToSharedRef(); }
+	/*
+	 * Size of current collection's serialized value in bytes. Returns 0 when collections are read from stream.
+	 */
+	int64 GetCollectionSize() const { return Collections.IsValidIndex(CollectionIndex) ? Collections[CollectionIndex].RawValue.Num() : 0; }
+
+	/*
+	 * Whether collections were decoded in parallel by ReadBegin().
+	 */
+	bool IsParallel() const { return IsDecodedInParallel; }
+	bool IsError() const { return !ErrorMessage.IsEmpty(); }
+	const FString& GetErrorMessage() const { return ErrorMessage; }
+};
@@ -0,0 +1,44 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/StringView.h"
+
+/*
+ * Case-insensitive (ASCII only) FNV-1a hash of object's member name. Could be evaluated at compile time for string literals,
+ * so ReadDocument methods could switch over member name hash instead of comparing member name with each known property.
+ * Matched member name still should be compared with property name to rule out hash collision.
+ */
+struct FGameDataMemberNameHash
+{
+	static constexpr uint32 OffsetBasis = 2166136261u;
+	static constexpr uint32 Prime = 16777619u;
+
+	template <typename CharType>
+	static constexpr uint32 Of(const CharType* Name, const int32 Length)
+	{
+		uint32 Hash = OffsetBasis;
+		for (int32 Index = 0; Index < Length; ++Index)
+		{
+			uint32 Char = static_cast<uint32>(Name[Index]);
+			if (Char >= 'A' && Char <= 'Z')
+			{
+				Char += 'a' - 'A';
+			}
+			Hash = (Hash ^ Char) * Prime;
+		}
+		return Hash;
+	}
+
+	template <typename CharType, SIZE_T Length>
+	static constexpr uint32 Of(const CharType (&Name)[Length])
+	{
+		return Of(Name, static_cast<int32>(Length - 1));
+	}
+
+	static uint32 Of(const FStringView& Name)
+	{
+		return Of(Name.GetData(), Name.Len());
+	}
+};
@@ -2,11 +2,14 @@
 
 #pragma once
 
+#include "FCompiledGameDataReader.h"
 #include "FJsonGameDataReader.h"
 #include "FJsonObjectGameDataReader.h"
 #include "FMessagePackGameDataReader.h"
+#include "FStructuralJsonGameDataReader.h"
 #include "IGameDataReader.h"
 
+#include "Containers/ArrayView.h"
 #include "Templates/SharedPointer.h"
 #include "Serialization/Archive.h"
 #include "Dom/JsonObject.h"
@@ -21,10 +24,26 @@ public:
 	{
 		return MakeShareable(new FJsonGameDataReader(Stream));
 	}
+	static TSharedRef<IGameDataReader> CreateJsonReader(const TArrayView<const uint8> Buffer)
+	{
+		return MakeShareable(new FStructuralJsonGameDataReader(Buffer));
+	}
 	static TSharedRef<IGameDataReader> CreateMessagePackReader(FArchive* const Stream)
 	{
 		return MakeShareable(new FMessagePackGameDataReader(Stream));
 	}
+	static TSharedRef<IGameDataReader> CreateMessagePackReader(const TArrayView<const uint8> Buffer)
+	{
+		return MakeShareable(new FMessagePackGameDataReader(Buffer));
+	}
+	static TSharedRef<IGameDataReader> CreateCompiledReader(FArchive* const Stream)
+	{
+		return MakeShareable(new FCompiledGameDataReader(Stream));
+	}
+	static TSharedRef<IGameDataReader> CreateCompiledReader(const TArrayView<const uint8> Buffer)
+	{
+		return MakeShareable(new FCompiledGameDataReader(Buffer));
+	}
 	static TSharedRef<IGameDataReader> CreateJsonObjectReader(const TSharedPtr<FJsonObject>& JsonObject)
 	{
 		return MakeShareable(new FJsonObjectGameDataReader(JsonObject));
@@ -24,8 +24,12 @@ public:
 
 	virtual bool ReadNext() override;
 	virtual const FString& GetIdentifier() const override;
-	virtual const FString GetValueAsString() const override;
+	virtual const FString& GetValueAsString() const override;
+	virtual FStringView GetIdentifierView() const override;
+	virtual FStringView GetValueAsStringView() const override;
 	virtual double GetValueAsNumber() const override;
+	virtual int64 GetValueAsInt64() override;
+	virtual uint64 GetValueAsUInt64() override;
 	virtual bool GetValueAsBoolean() const override;
 	virtual const FString& GetErrorMessage() const override;
 	virtual EJsonNotation GetNotation() override;
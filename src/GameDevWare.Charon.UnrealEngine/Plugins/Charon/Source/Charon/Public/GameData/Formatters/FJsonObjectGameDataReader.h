@@ -17,6 +17,7 @@
  * Token based reader for dynamic FJsonObject object as source of token stream.
  * Provides generalized IGameDataReader behaviour for already de-serialized objects.
  * Used for patching FJsonObject and TryLoad from resulting merged FJsonObject.
+ * Integer numbers (including FJsonValueNumberString produced by IGameDataReader::ReadAny()) are read exactly by GetValueAsInt64()/GetValueAsUInt64().
  */
 class CHARON_API FJsonObjectGameDataReader final : public IGameDataReader
 {
@@ -59,6 +60,10 @@ private:
 	FString ErrorMessage;
 	FString StringValue;
 	double NumberValue;
+	int64 Int64Value;
+	uint64 UInt64Value;
+	bool HasInt64Value;
+	bool HasUInt64Value;
 	bool BoolValue;
 	bool FinishedReadingRootObject;
 
@@ -67,8 +72,12 @@ public:
 
 	virtual bool ReadNext() override;
 	virtual const FString& GetIdentifier() const override;
-	virtual const FString GetValueAsString() const override;
+	virtual const FString& GetValueAsString() const override;
+	virtual FStringView GetIdentifierView() const override;
+	virtual FStringView GetValueAsStringView() const override;
 	virtual double GetValueAsNumber() const override;
+	virtual int64 GetValueAsInt64() override;
+	virtual uint64 GetValueAsUInt64() override;
 	virtual bool GetValueAsBoolean() const override;
 	virtual const FString& GetErrorMessage() const override;
 	virtual EJsonNotation GetNotation() override;
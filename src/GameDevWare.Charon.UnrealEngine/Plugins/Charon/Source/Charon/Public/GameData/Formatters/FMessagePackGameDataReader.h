@@ -5,6 +5,7 @@
 #include "IGameDataReader.h"
 
 #include "Containers/Array.h"
+#include "Containers/ArrayView.h"
 #include "Containers/UnrealString.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
@@ -16,52 +17,98 @@
 
 /*
  * MessagePack format reader implementation with TJsonReader backed token types.
+ * Could read from FArchive or directly from an in-memory buffer. Buffer mode doesn't copy any bytes except
+ * for string/binary values and is preferred when whole game data file is already loaded in memory.
+ * String values are decoded from UTF-8 lazily on first access, so skipped values cost nothing.
+ * Integer values are kept as decoded int64/uint64, so GetValueAsInt64()/GetValueAsUInt64() are exact for the full 64-bit range.
+ * SkipAny() skips whole arrays/maps by their length prefixes without producing tokens.
  */
 class CHARON_API FMessagePackGameDataReader final : public IGameDataReader
 {
 private:
+	enum class EPendingStringValue : uint8
+	{
+		None,
+		Utf8,
+		Binary,
+		SignedInteger,
+		UnsignedInteger
+	};
+
 	FArchive* Stream;
+	const uint8* Buffer;
+	int64 BufferLength;
+	int64 Position;
+	int64 TokenStart;
+	TArray<uint8> ScratchBytes;
 	TArray<TTuple<EJsonNotation, int32>> ParseState;
 	EJsonNotation Notation;
 	EJsonToken CurrentToken;
 	FString Identifier;
 	FString ErrorMessage;
-	FString StringValue;
+	mutable FString StringValue;
+	const uint8* PendingStringValueBytes;
+	int64 PendingStringValueLength;
+	mutable EPendingStringValue PendingStringValue;
 	double NumberValue;
+	int64 Int64Value;
+	uint64 UInt64Value;
+	bool HasIntegerValue;
 	bool BoolValue;
 	bool FinishedReadingRootObject;
 
 	void PushClosingTokenCounter(EJsonNotation ClosingNotation, int32 Size);
 	void DecrementClosingTokenCounter();
-	void ReadBytes(TArray<uint8>& Buffer, int32 Size) const;
+	bool IsAtEnd() const;
+	bool ReadRaw(void* Destination, int64 NumBytes);
+	bool ReadBytes(const uint8*& Bytes, int64 NumBytes);
+	bool ReadUtf8String(FString& Value, int64 NumBytes);
+	bool SkipRaw(int64 NumBytes);
+	bool SkipRawValues(uint64 Count);
+	void DecodePendingStringValue() const;
+	void SetIntegerValue(int64 Value);
+	void SetUnsignedIntegerValue(uint64 Value);
 	void SetErrorMessage(const FString& Message);
 	uint8 PeekParseMapState();
 
-	int8 ReadInt8() const;
-	int16 ReadBeInt16() const;
-	int32 ReadBeInt32() const;
-	int64 ReadBeInt64() const;
+	int8 ReadInt8();
+	int16 ReadBeInt16();
+	int32 ReadBeInt32();
+	int64 ReadBeInt64();
 
-	uint8 ReadUInt8() const;
-	uint16 ReadBeUInt16() const;
-	uint32 ReadBeUInt32() const;
-	uint64 ReadBeUInt64() const;
+	uint8 ReadUInt8();
+	uint16 ReadBeUInt16();
+	uint32 ReadBeUInt32();
+	uint64 ReadBeUInt64();
 	
-	float ReadBeFloat32() const;
-	double ReadFloat64() const;
+	float ReadBeFloat32();
+	double ReadFloat64();
 
 public:
 	static constexpr size_t MAX_BINARY_LENGTH = 10 * 1024 * 1024; // 10 Mib
 	static constexpr size_t MAX_STRING_LENGTH = 1 * 1024 * 1024; // 1 Mib
 
 	explicit FMessagePackGameDataReader(FArchive* const Stream);
+	/*
+	 * Create reader over in-memory buffer. Buffer should outlive reader.
+	 */
+	explicit FMessagePackGameDataReader(const TArrayView<const uint8> Buffer);
 
 	virtual bool ReadNext() override;
-	virtual const FString& GetIdentifier() const override;
-	virtual const FString GetValueAsString() const override;
+	virtual const FString& GetIdentifier() const override { return Identifier; }
+	virtual const FString& GetValueAsString() const override;
+	virtual FStringView GetIdentifierView() const override { return Identifier; }
+	virtual FStringView GetValueAsStringView() const override;
 	virtual double GetValueAsNumber() const override;
+	virtual int64 GetValueAsInt64() override;
+	virtual uint64 GetValueAsUInt64() override;
 	virtual bool GetValueAsBoolean() const override;
-	virtual const FString& GetErrorMessage() const override;
-	virtual EJsonNotation GetNotation() override;
+	virtual const FString& GetErrorMessage() const override { return ErrorMessage; }
+	virtual EJsonNotation GetNotation() override { return Notation; }
 	virtual void SetErrorState(const FString& Message) override;
+	virtual void SkipAny(const bool NextToken = true) override;
+	virtual EGameDataReaderType GetReaderType() const override { return EGameDataReaderType::MessagePack; }
+	virtual bool ReadRawValue(TArrayView<const uint8>& RawValue, const bool NextToken = true) override;
+	virtual TSharedPtr<IGameDataReader> CreateRawValueReader(const TArrayView<const uint8> RawValue) const override;
+	virtual bool GetRawTokenBounds(const uint8*& OutTokenStart, const uint8*& OutTokenEnd) const override;
 };
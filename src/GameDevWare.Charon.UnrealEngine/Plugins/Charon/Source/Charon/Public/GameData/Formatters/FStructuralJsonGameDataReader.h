@@ -0,0 +1,90 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "IGameDataReader.h"
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/UnrealString.h"
+#include "Serialization/JsonTypes.h"
+#include "Serialization/Archive.h"
+
+/*
+ * JSON format reader over in-memory UTF-8 buffer. Reader makes one vectorized pass (SSE2/NEON, scalar on other CPUs) over
+ * whole buffer to build index of structural characters ({}[]:, and unescaped quotes outside of strings) and then
+ * yields tokens by walking this index. String values are unescaped lazily on first access, so skipped values cost nothing.
+ * Token sequence is the same as with FJsonGameDataReader.
+ */
+class CHARON_API FStructuralJsonGameDataReader final : public IGameDataReader
+{
+private:
+	enum class EContainerType : uint8
+	{
+		Object,
+		Array
+	};
+
+	TArray<uint8> OwnedBuffer;
+	const uint8* Buffer;
+	int64 BufferLength;
+	TArray<uint32> StructuralIndex;
+	int32 IndexPosition;
+	int64 Position;
+	int64 TokenStart;
+	TArray<EContainerType> ContainerStack;
+	bool IsSeparatorExpected;
+	bool IsContainerEmpty;
+	EJsonNotation Notation;
+	EJsonToken CurrentToken;
+	FString Identifier;
+	FString ErrorMessage;
+	mutable FString StringValue;
+	int64 PendingStringValueStart;
+	int64 PendingStringValueEnd;
+	mutable bool HasPendingStringValue;
+	double NumberValue;
+	int64 Int64Value;
+	uint64 UInt64Value;
+	bool HasIntegerValue;
+	bool BoolValue;
+	bool FinishedReadingRootObject;
+
+	void BuildStructuralIndex();
+	bool SkipWhitespace();
+	bool ConsumeStructural();
+	bool ReadString(int64& Start, int64& End);
+	void UnescapeString(FString& Value, int64 Start, int64 End) const;
+	bool ReadValueToken();
+	bool ReadScalar();
+	void CloseContainer(EContainerType ContainerType);
+	void SetErrorMessage(const FString& Message);
+
+public:
+	/*
+	 * Create reader over remaining bytes of archive. Whole content is read into internal buffer.
+	 */
+	explicit FStructuralJsonGameDataReader(FArchive* const Stream);
+	/*
+	 * Create reader over in-memory buffer. Buffer should outlive reader.
+	 */
+	explicit FStructuralJsonGameDataReader(const TArrayView<const uint8> Buffer);
+
+	virtual bool ReadNext() override;
+	virtual const FString& GetIdentifier() const override { return Identifier; }
+	virtual const FString& GetValueAsString() const override;
+	virtual FStringView GetIdentifierView() const override { return Identifier; }
+	virtual FStringView GetValueAsStringView() const override;
+	virtual double GetValueAsNumber() const override;
+	virtual int64 GetValueAsInt64() override;
+	virtual uint64 GetValueAsUInt64() override;
+	virtual bool GetValueAsBoolean() const override;
+	virtual const FString& GetErrorMessage() const override { return ErrorMessage; }
+	virtual EJsonNotation GetNotation() override { return Notation; }
+	virtual void SetErrorState(const FString& Message) override;
+	virtual void SkipAny(const bool NextToken = true) override;
+	virtual EGameDataReaderType GetReaderType() const override { return EGameDataReaderType::StructuralJson; }
+	virtual bool ReadRawValue(TArrayView<const uint8>& RawValue, const bool NextToken = true) override;
+	virtual TSharedPtr<IGameDataReader> CreateRawValueReader(const TArrayView<const uint8> RawValue) const override;
+	virtual bool GetRawTokenBounds(const uint8*& OutTokenStart, const uint8*& OutTokenEnd) const override;
+};
@@ -3,8 +3,11 @@
 #pragma once
 
 #include "Containers/Array.h"
+#include "Containers/ArrayView.h"
 #include "Containers/Map.h"
 #include "Containers/UnrealString.h"
+#include "Containers/StringView.h"
+#include "FGameDataMemberNameHash.h"
 #include "Templates/SharedPointer.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
@@ -15,12 +18,25 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonTypes.h"
 #include "Serialization/Archive.h"
+#include "TGameDataReaderHelpers.h"
+
+/*
+ * Type of reader implementation. Used to choose statically bound TGameDataReader for known readers.
+ */
+enum class EGameDataReaderType : uint8
+{
+	Other,
+	StructuralJson,
+	MessagePack,
+	Compiled
+};
 
 /*
  * Base class for all implementation of game data readers.
  * Provides core de-serialization functionality over basic token reader implementation.
+ * De-serialization helpers are inherited from TGameDataReaderHelpers and call token accessors virtually.
  */
-class CHARON_API IGameDataReader
+class CHARON_API IGameDataReader : public TGameDataReaderHelpers<IGameDataReader>
 {
 public:
 	virtual ~IGameDataReader()
@@ -30,7 +46,15 @@ public:
 	// ReSharper disable CppFunctionIsNotImplemented
 	virtual bool ReadNext() = 0;
 	virtual const FString& GetIdentifier() const = 0;
-	virtual const FString GetValueAsString() const = 0;
+	virtual const FString& GetValueAsString() const = 0;
+	/*
+	 * Borrowed view of current member name. Valid until next ReadNext() call.
+	 */
+	virtual FStringView GetIdentifierView() const = 0;
+	/*
+	 * Borrowed view of current string value. Valid until next ReadNext() call.
+	 */
+	virtual FStringView GetValueAsStringView() const = 0;
 	virtual double GetValueAsNumber() const = 0;
 	virtual bool GetValueAsBoolean() const = 0;
 	virtual const FString& GetErrorMessage() const = 0;
@@ -38,465 +62,72 @@ public:
 	virtual void SetErrorState(const FString& Message) = 0;
 	// ReSharper enable CppFunctionIsNotImplemented
 
-	bool ReadObject(TSharedPtr<FJsonObject>& JsonObject, const bool NextToken = true)
-	{
-		ReadObjectBegin();
-		if (IsError())
-		{
-			return false;
-		}
-
-		if (JsonObject == nullptr)
-		{
-			JsonObject = MakeShared<FJsonObject>();
-		}
-		while (GetNotation() != EJsonNotation::ObjectEnd)
-		{
-			auto MemberName = ReadMember();
-			TSharedPtr<FJsonValue> MemberValue;
-			if (!ReadAny(MemberValue) || IsError() || MemberValue == nullptr)
-			{
-				return false;
-			}
-			JsonObject->SetField(MemberName, MemberValue);
-		}
-
-		if (!ReadObjectEnd(NextToken))
-		{
-			return false;
-		}
-
-		return true;
-	}
-
-	bool ReadArray(TArray<TSharedPtr<FJsonValue>>& JsonArray, const bool NextToken = true)
+	/*
+	 * Case-insensitive hash of current member name. See FGameDataMemberNameHash.
+	 */
+	virtual uint32 GetIdentifierHash() const
 	{
-		ReadArrayBegin();
-		if (IsError())
-		{
-			return false;
-		}
-		
-		while (GetNotation() != EJsonNotation::ArrayEnd)
-		{
-			TSharedPtr<FJsonValue> Item;
-			if (!ReadAny(Item) || IsError() || Item == nullptr)
-			{
-				return false;
-			}
-			JsonArray.Add(Item);
-		}
-
-		if (!ReadArrayEnd(NextToken))
-		{
-			return false;
-		}
-		return true;
-	}
-
-	bool ReadAny(TSharedPtr<FJsonValue>& JsonValue, const bool NextToken = true)
-	{
-		switch (GetNotation())
-		{
-		case EJsonNotation::ArrayStart:
-			{
-				TArray<TSharedPtr<FJsonValue>> JsonArray;
-				if (!ReadArray(JsonArray, /* NextToken */ false))
-				{
-					return false;
-				}
-				JsonValue = MakeShared<FJsonValueArray>(JsonArray);
-				break;
-			}
-		case EJsonNotation::ObjectStart:
-			{
-				TSharedPtr<FJsonObject> JsonObject;
-				if (!ReadObject(JsonObject, /* NextToken */ false))
-				{
-					return false;
-				}
-				JsonValue = MakeShared<FJsonValueObject>(JsonObject);
-				break;
-			}
-		case EJsonNotation::Null:
-			JsonValue = MakeShared<FJsonValueNull>();
-			break;
-		case EJsonNotation::String:
-			JsonValue = MakeShared<FJsonValueString>(GetValueAsString());
-			break;
-		case EJsonNotation::Number:
-			JsonValue = MakeShared<FJsonValueNumber>(GetValueAsNumber());
-			break;
-		case EJsonNotation::Boolean:
-			JsonValue = MakeShared<FJsonValueBoolean>(GetValueAsBoolean());
-			break;
-		case EJsonNotation::Error:
-			return false;
-		default:
-			SetErrorState("Unexpected notation.");
-			return false;
-		}
-
-		if (NextToken)
-		{
-			ReadNext();
-		}
-
-		return true;
+		return FGameDataMemberNameHash::Of(GetIdentifierView());
 	}
 
-	bool ReadArrayBegin(const bool NextToken = true)
+	/*
+	 * Current number or numeric string value as signed 64-bit integer. Readers which decode integers natively
+	 * should override it to return exact value without round-trip through double.
+	 */
+	virtual int64 GetValueAsInt64()
 	{
-		if (IsError())
+		if (GetNotation() == EJsonNotation::String)
 		{
-			return false;
+			return FCString::Atoi64(*GetValueAsString());
 		}
-
-		if (GetNotation() != EJsonNotation::ArrayStart)
-		{
-			SetErrorState("Unexpected token while ArrayStart is expected.");
-			return false;
-		}
-
-		if (NextToken)
-		{
-			ReadNext();
-		}
-
-		return true;
+		return static_cast<int64>(GetValueAsNumber());
 	}
 
-	bool ReadArrayEnd(const bool NextToken = true)
+	/*
+	 * Current number or numeric string value as unsigned 64-bit integer. See GetValueAsInt64().
+	 */
+	virtual uint64 GetValueAsUInt64()
 	{
-		if (IsError())
+		if (GetNotation() == EJsonNotation::String)
 		{
-			return false;
+			return FCString::Strtoui64(*GetValueAsString(), nullptr, 10);
 		}
-
-		if (GetNotation() != EJsonNotation::ArrayEnd)
-		{
-			SetErrorState("Unexpected token while ArrayEnd is expected.");
-			return false;
-		}
-		if (NextToken)
-		{
-			ReadNext();
-		}
-
-		return true;
+		const double Number = GetValueAsNumber();
+		return Number < 0 ? static_cast<uint64>(static_cast<int64>(Number)) : static_cast<uint64>(Number);
 	}
 
-	bool ReadObjectBegin(const bool NextToken = true)
+	/*
+	 * Type of this reader, see TGameDataReader.
+	 */
+	virtual EGameDataReaderType GetReaderType() const
 	{
-		if (IsError())
-		{
-			return false;
-		}
-
-		if (GetNotation() != EJsonNotation::ObjectStart)
-		{
-			SetErrorState("Unexpected token while ObjectStart is expected.");
-			return false;
-		}
-		if (NextToken)
-		{
-			ReadNext();
-		}
-
-		return true;
+		return EGameDataReaderType::Other;
 	}
 
-	bool ReadObjectEnd(const bool NextToken = true)
+	/*
+	 * Get raw bytes of current value and move past it. Readers not backed by an in-memory buffer return false and don't move.
+	 * Returned bytes are valid while this reader is alive and could be read with CreateRawValueReader().
+	 */
+	virtual bool ReadRawValue(TArrayView<const uint8>& RawValue, const bool NextToken = true)
 	{
-		if (IsError())
-		{
-			return false;
-		}
-
-		if (GetNotation() != EJsonNotation::ObjectEnd)
-		{
-			SetErrorState("Unexpected token while ObjectEnd is expected.");
-			return false;
-		}
-		if (NextToken)
-		{
-			ReadNext();
-		}
-
-		return true;
-	}
-
-	bool IsNull()
-	{
-		return GetNotation() == EJsonNotation::Null;
-	}
-
-	bool IsError()
-	{
-		return GetNotation() == EJsonNotation::Error;
-	}
-
-	const FString& ReadMember()
-	{
-		const FString& MemberName = GetIdentifier();
-
-		// ReSharper disable once CppIncompleteSwitchStatement, CppDefaultCaseNotHandledInSwitchStatement
-		switch (GetNotation())
-		{
-		case EJsonNotation::ArrayEnd: SetErrorState("Unexpected end of array when object's member is expected.");
-			return MemberName;
-		case EJsonNotation::ObjectEnd: SetErrorState("Unexpected end of object when object's member is expected.");
-			return MemberName;
-		case EJsonNotation::Error: return MemberName;
-		}
-
-		if (MemberName.IsEmpty())
-		{
-			SetErrorState("Unexpected empty member name. Probably array instead of object is read.");
-			return MemberName;
-		}
-		return MemberName;
-	}
-
-	bool ReadValue(uint8& Value)
-	{
-		switch (GetNotation())
-		{
-		case EJsonNotation::String:
-			Value = static_cast<uint8>(FCString::Atoi(*GetValueAsString()));
-			return true;
-		case EJsonNotation::Number:
-			Value = static_cast<uint8>(GetValueAsNumber());
-			return true;
-		case EJsonNotation::Null:
-			Value = 0;
-			return true;
-		default:
-			return false;
-		}
-	}
-
-	bool ReadValue(int32& Value)
-	{
-		switch (GetNotation())
-		{
-		case EJsonNotation::String:
-			Value = FCString::Atoi(*GetValueAsString());
-			return true;
-		case EJsonNotation::Number:
-			Value = static_cast<int32>(GetValueAsNumber());
-			return true;
-		case EJsonNotation::Null:
-			Value = 0;
-			return true;
-		default:
-			return false;
-		}
-	}
-
-	bool ReadValue(int64& Value)
-	{
-		switch (GetNotation())
-		{
-		case EJsonNotation::String:
-			Value = FCString::Atoi64(*GetValueAsString());
-			return true;
-		case EJsonNotation::Number:
-			Value = static_cast<int64>(GetValueAsNumber());
-			return true;
-		case EJsonNotation::Null:
-			Value = 0;
-			return true;
-		default:
-			return false;
-		}
-	}
-
-	bool ReadValue(float& Value)
-	{
-		switch (GetNotation())
-		{
-		case EJsonNotation::String:
-			Value = FCString::Atof(*GetValueAsString());
-			return true;
-		case EJsonNotation::Number:
-			Value = static_cast<float>(GetValueAsNumber());
-			return true;
-		case EJsonNotation::Null:
-			Value = 0;
-			return true;
-		default:
-			return false;
-		}
-	}
-
-	bool ReadValue(double& Value)
-	{
-		switch (GetNotation())
-		{
-		case EJsonNotation::String:
-			Value = FCString::Atod(*GetValueAsString());
-			return true;
-		case EJsonNotation::Number:
-			Value = GetValueAsNumber();
-			return true;
-		case EJsonNotation::Null:
-			Value = 0;
-			return true;
-		default:
-			return false;
-		}
-	}
-
-	bool ReadValue(bool& Value)
-	{
-		switch (GetNotation())
-		{
-		case EJsonNotation::String:
-			Value = GetValueAsString().Equals("true", ESearchCase::IgnoreCase);
-			return true;
-		case EJsonNotation::Number:
-			Value = GetValueAsNumber() > 0;
-			return true;
-		case EJsonNotation::Boolean:
-			Value = GetValueAsBoolean();
-			return true;
-		case EJsonNotation::Null:
-			Value = false;
-			return true;
-		default:
-			return false;
-		}
-	}
-
-	bool ReadValue(FString& Value)
-	{
-		switch (GetNotation())
-		{
-		case EJsonNotation::String:
-			Value = GetValueAsString();
-			return true;
-		case EJsonNotation::Number:
-			Value = FString::SanitizeFloat(GetValueAsNumber());
-			return true;
-		case EJsonNotation::Boolean:
-			Value = GetValueAsBoolean() ? "True" : "False";
-			return true;
-		case EJsonNotation::Null:
-			Value.Empty();
-			return true;
-		default:
-			return false;
-		}
-	}
-
-	bool ReadValue(FTimespan& Value)
-	{
-		switch (GetNotation())
-		{
-		case EJsonNotation::String:
-			return FTimespan::Parse(GetValueAsString(), Value);
-		case EJsonNotation::Number:
-			Value = FTimespan(static_cast<int64>(GetValueAsNumber()));
-			return true;
-		case EJsonNotation::Null:
-			Value = FTimespan(0);
-			return true;
-		default:
-			return false;
-		}
-	}
-
-	bool ReadValue(FDateTime& Value)
-	{
-		switch (GetNotation())
-		{
-		case EJsonNotation::String:
-			return FDateTime::ParseIso8601(*GetValueAsString(), Value);
-		case EJsonNotation::Null:
-			Value = FDateTime();
-			return true;
-		default:
-			return false;
-		}
-	}
-
-	bool ReadValue(FVariant& Value)
-	{
-		switch (GetNotation())
-		{
-		case EJsonNotation::String:
-			Value = FVariant(GetValueAsString());
-			return true;
-		case EJsonNotation::Number:
-			Value = FVariant(GetValueAsNumber());
-			return true;
-		case EJsonNotation::Boolean:
-			Value = FVariant(GetValueAsBoolean());
-			return true;
-		case EJsonNotation::Null:
-			Value = FVariant();
-			return true;
-		default:
-			return false;
-		}
-	}
-
-	bool ReadValue(FText& Value)
-	{
-		switch (GetNotation())
-		{
-		case EJsonNotation::String:
-			Value = FText::FromStringView(GetValueAsString());
-			return true;
-		case EJsonNotation::Number:
-			Value = FText::FromStringView(FString::SanitizeFloat(GetValueAsNumber()));
-			return true;
-		case EJsonNotation::Boolean:
-			Value = FText::FromString(GetValueAsBoolean() ? "True" : "False");
-			return true;
-		case EJsonNotation::Null:
-			Value = FText::GetEmpty();
-			return true;
-		default:
-			return false;
-		}
-	}
-
-	template <typename T>
-	bool ReadValue(TOptional<T>& Optional)
-	{
-		T Value;
-		if (ReadValue(Value))
-		{
-			Optional = TOptional<T>(Value);
-			return true;
-		}
 		return false;
 	}
 
-	template <typename EnumType, typename = std::enable_if_t<std::is_enum_v<EnumType>>>
-	bool ReadValue(EnumType& EnumValue)
+	/*
+	 * Create reader of the same format over bytes returned by ReadRawValue(). Created reader has its own position and
+	 * could be used on another thread, except compiled reader's which shares decoded strings with this one.
+	 */
+	virtual TSharedPtr<IGameDataReader> CreateRawValueReader(const TArrayView<const uint8> RawValue) const
 	{
-		std::underlying_type_t<EnumType> Value;
-		if (ReadValue(Value))
-		{
-			EnumValue = static_cast<EnumType>(Value);
-			return true;
-		}
-		return false;
+		return nullptr;
 	}
 
-	template <typename E>
-	constexpr auto ReadEnumValue(TOptional<E>& OptionalEnumValue) -> bool
+	/*
+	 * Get bounds of current token in reader's buffer. Value walked token by token spans from start of its first token to
+	 * end of its last token, which is the same range ReadRawValue() returns. Readers not backed by an in-memory buffer return false.
+	 */
+	virtual bool GetRawTokenBounds(const uint8*& OutTokenStart, const uint8*& OutTokenEnd) const
 	{
-		static_assert(std::is_enum_v<E>, "E must be an enum type");
-		TOptional<std::underlying_type_t<E>> OptionalValue;
-		if (ReadValue(OptionalValue) && OptionalValue.IsSet())
-		{
-			OptionalEnumValue = static_cast<E>(OptionalValue.GetValue());
-			return true;
-		}
 		return false;
 	}
 
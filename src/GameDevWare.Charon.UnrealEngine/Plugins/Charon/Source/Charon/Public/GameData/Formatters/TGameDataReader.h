@@ -0,0 +1,96 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "IGameDataReader.h"
+#include "TGameDataReaderHelpers.h"
+#include "FMessagePackGameDataReader.h"
+#include "FCompiledGameDataReader.h"
+#include "FStructuralJsonGameDataReader.h"
+
+#include <type_traits>
+
+/*
+ * Statically bound view over concrete reader for generated game data loaders. It has the same token API as IGameDataReader,
+ * but calls go directly to ReaderType's methods, so compiler could inline helpers and token accessors instead of making
+ * virtual calls for each token. ReaderType should be final.
+ */
+template <typename ReaderType>
+class TGameDataReader final : public TGameDataReaderHelpers<TGameDataReader<ReaderType>>
+{
+	static_assert(std::is_final_v<ReaderType>, "ReaderType should be final, otherwise calls are still virtual.");
+
+private:
+	ReaderType& Reader;
+
+public:
+	explicit TGameDataReader(ReaderType& Reader) : Reader(Reader)
+	{
+	}
+
+	FORCEINLINE bool ReadNext() { return Reader.ReadNext(); }
+	FORCEINLINE const FString& GetIdentifier() const { return Reader.GetIdentifier(); }
+	FORCEINLINE const FString& GetValueAsString() const { return Reader.GetValueAsString(); }
+	FORCEINLINE FStringView GetIdentifierView() const { return Reader.GetIdentifierView(); }
+	FORCEINLINE FStringView GetValueAsStringView() const { return Reader.GetValueAsStringView(); }
+	FORCEINLINE uint32 GetIdentifierHash() const { return Reader.GetIdentifierHash(); }
+	FORCEINLINE double GetValueAsNumber() const { return Reader.GetValueAsNumber(); }
+	FORCEINLINE int64 GetValueAsInt64() { return Reader.GetValueAsInt64(); }
+	FORCEINLINE uint64 GetValueAsUInt64() { return Reader.GetValueAsUInt64(); }
+	FORCEINLINE bool GetValueAsBoolean() const { return Reader.GetValueAsBoolean(); }
+	FORCEINLINE const FString& GetErrorMessage() const { return Reader.GetErrorMessage(); }
+	FORCEINLINE EJsonNotation GetNotation() { return Reader.GetNotation(); }
+	FORCEINLINE void SetErrorState(const FString& Message) { Reader.SetErrorState(Message); }
+	FORCEINLINE void SkipAny(const bool NextToken = true) { Reader.SkipAny(NextToken); }
+	FORCEINLINE bool ReadRawValue(TArrayView<const uint8>& RawValue, const bool NextToken = true) { return Reader.ReadRawValue(RawValue, NextToken); }
+	FORCEINLINE TSharedPtr<IGameDataReader> CreateRawValueReader(const TArrayView<const uint8> RawValue) const { return Reader.CreateRawValueReader(RawValue); }
+	FORCEINLINE bool GetRawTokenBounds(const uint8*& OutTokenStart, const uint8*& OutTokenEnd) const { return Reader.GetRawTokenBounds(OutTokenStart, OutTokenEnd); }
+};
+
+/*
+ * Dispatch from IGameDataReader to statically bound TGameDataReader. Function is called once per reader with TGameDataReader
+ * for known reader types (see EGameDataReaderType) and with IGameDataReader itself for others.
+ */
+class CHARON_API FGameDataReaderDispatch
+{
+private:
+	static bool IsStaticDispatchEnabled;
+
+public:
+	/*
+	 * Enable or disable static dispatch, e.g. to compare load times. Enabled by default.
+	 */
+	static void SetStaticDispatchEnabled(const bool Enabled) { IsStaticDispatchEnabled = Enabled; }
+	static bool GetStaticDispatchEnabled() { return IsStaticDispatchEnabled; }
+
+	template <typename FunctionType>
+	static auto Visit(IGameDataReader& Reader, FunctionType&& Function) -> decltype(Function(Reader))
+	{
+		if (!IsStaticDispatchEnabled)
+		{
+			return Function(Reader);
+		}
+
+		switch (Reader.GetReaderType())
+		{
+		case EGameDataReaderType::StructuralJson:
+			{
+				TGameDataReader<FStructuralJsonGameDataReader> TypedReader(static_cast<FStructuralJsonGameDataReader&>(Reader));
+				return Function(TypedReader);
+			}
+		case EGameDataReaderType::MessagePack:
+			{
+				TGameDataReader<FMessagePackGameDataReader> TypedReader(static_cast<FMessagePackGameDataReader&>(Reader));
+				return Function(TypedReader);
+			}
+		case EGameDataReaderType::Compiled:
+			{
+				TGameDataReader<FCompiledGameDataReader> TypedReader(static_cast<FCompiledGameDataReader&>(Reader));
+				return Function(TypedReader);
+			}
+		case EGameDataReaderType::Other:
+		default:
+			return Function(Reader);
+		}
+	}
+};
@@ -0,0 +1,605 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "Containers/StringView.h"
+#include "Templates/SharedPointer.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/Optional.h"
+#include "Misc/DateTime.h"
+#include "Misc/Timespan.h"
+#include "Misc/Variant.h"
+#include "Internationalization/Text.h"
+#include "Serialization/JsonTypes.h"
+
+#include <type_traits>
+
+/*
+ * De-serialization helpers over basic token accessors of ReaderType (ReadNext(), GetNotation(), GetValueAs...() etc.).
+ * Shared by IGameDataReader, where accessors are virtual, and TGameDataReader, where they are bound at compile time.
+ */
+template <typename ReaderType>
+class TGameDataReaderHelpers
+{
+private:
+	FORCEINLINE ReaderType& Self()
+	{
+		return *static_cast<ReaderType*>(this);
+	}
+
+public:
+	bool ReadObject(TSharedPtr<FJsonObject>& JsonObject, const bool NextToken = true)
+	{
+		ReadObjectBegin();
+		if (IsError())
+		{
+			return false;
+		}
+
+		if (JsonObject == nullptr)
+		{
+			JsonObject = MakeShared<FJsonObject>();
+		}
+		while (Self().GetNotation() != EJsonNotation::ObjectEnd)
+		{
+			auto MemberName = ReadMember();
+			TSharedPtr<FJsonValue> MemberValue;
+			if (!ReadAny(MemberValue) || IsError() || MemberValue == nullptr)
+			{
+				return false;
+			}
+			JsonObject->SetField(MemberName, MemberValue);
+		}
+
+		if (!ReadObjectEnd(NextToken))
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	bool ReadArray(TArray<TSharedPtr<FJsonValue>>& JsonArray, const bool NextToken = true)
+	{
+		ReadArrayBegin();
+		if (IsError())
+		{
+			return false;
+		}
+		
+		while (Self().GetNotation() != EJsonNotation::ArrayEnd)
+		{
+			TSharedPtr<FJsonValue> Item;
+			if (!ReadAny(Item) || IsError() || Item == nullptr)
+			{
+				return false;
+			}
+			JsonArray.Add(Item);
+		}
+
+		if (!ReadArrayEnd(NextToken))
+		{
+			return false;
+		}
+		return true;
+	}
+
+	bool ReadAny(TSharedPtr<FJsonValue>& JsonValue, const bool NextToken = true)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::ArrayStart:
+			{
+				TArray<TSharedPtr<FJsonValue>> JsonArray;
+				if (!ReadArray(JsonArray, /* NextToken */ false))
+				{
+					return false;
+				}
+				JsonValue = MakeShared<FJsonValueArray>(JsonArray);
+				break;
+			}
+		case EJsonNotation::ObjectStart:
+			{
+				TSharedPtr<FJsonObject> JsonObject;
+				if (!ReadObject(JsonObject, /* NextToken */ false))
+				{
+					return false;
+				}
+				JsonValue = MakeShared<FJsonValueObject>(JsonObject);
+				break;
+			}
+		case EJsonNotation::Null:
+			JsonValue = MakeShared<FJsonValueNull>();
+			break;
+		case EJsonNotation::String:
+			JsonValue = MakeShared<FJsonValueString>(Self().GetValueAsString());
+			break;
+		case EJsonNotation::Number:
+			{
+				const double Number = Self().GetValueAsNumber();
+				if (FMath::Abs(Number) >= 9007199254740992.0 /* 2^53 */ && FMath::Abs(Number) <= 18446744073709551615.0)
+				{
+					// keep large integers exact, double can't hold all 64-bit values
+					JsonValue = MakeShared<FJsonValueNumberString>(Number > 0 ? LexToString(Self().GetValueAsUInt64()) : LexToString(Self().GetValueAsInt64()));
+				}
+				else
+				{
+					JsonValue = MakeShared<FJsonValueNumber>(Number);
+				}
+				break;
+			}
+		case EJsonNotation::Boolean:
+			JsonValue = MakeShared<FJsonValueBoolean>(Self().GetValueAsBoolean());
+			break;
+		case EJsonNotation::Error:
+			return false;
+		default:
+			Self().SetErrorState("Unexpected notation.");
+			return false;
+		}
+
+		if (NextToken)
+		{
+			Self().ReadNext();
+		}
+
+		return true;
+	}
+
+	bool ReadArrayBegin(const bool NextToken = true)
+	{
+		if (IsError())
+		{
+			return false;
+		}
+
+		if (Self().GetNotation() != EJsonNotation::ArrayStart)
+		{
+			Self().SetErrorState("Unexpected token while ArrayStart is expected.");
+			return false;
+		}
+
+		if (NextToken)
+		{
+			Self().ReadNext();
+		}
+
+		return true;
+	}
+
+	bool ReadArrayEnd(const bool NextToken = true)
+	{
+		if (IsError())
+		{
+			return false;
+		}
+
+		if (Self().GetNotation() != EJsonNotation::ArrayEnd)
+		{
+			Self().SetErrorState("Unexpected token while ArrayEnd is expected.");
+			return false;
+		}
+		if (NextToken)
+		{
+			Self().ReadNext();
+		}
+
+		return true;
+	}
+
+	bool ReadObjectBegin(const bool NextToken = true)
+	{
+		if (IsError())
+		{
+			return false;
+		}
+
+		if (Self().GetNotation() != EJsonNotation::ObjectStart)
+		{
+			Self().SetErrorState("Unexpected token while ObjectStart is expected.");
+			return false;
+		}
+		if (NextToken)
+		{
+			Self().ReadNext();
+		}
+
+		return true;
+	}
+
+	bool ReadObjectEnd(const bool NextToken = true)
+	{
+		if (IsError())
+		{
+			return false;
+		}
+
+		if (Self().GetNotation() != EJsonNotation::ObjectEnd)
+		{
+			Self().SetErrorState("Unexpected token while ObjectEnd is expected.");
+			return false;
+		}
+		if (NextToken)
+		{
+			Self().ReadNext();
+		}
+
+		return true;
+	}
+
+	bool IsNull()
+	{
+		return Self().GetNotation() == EJsonNotation::Null;
+	}
+
+	bool IsError()
+	{
+		return Self().GetNotation() == EJsonNotation::Error;
+	}
+
+	const FString& ReadMember()
+	{
+		const FString& MemberName = Self().GetIdentifier();
+
+		// ReSharper disable once CppIncompleteSwitchStatement, CppDefaultCaseNotHandledInSwitchStatement
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::ArrayEnd: Self().SetErrorState("Unexpected end of array when object's member is expected.");
+			return MemberName;
+		case EJsonNotation::ObjectEnd: Self().SetErrorState("Unexpected end of object when object's member is expected.");
+			return MemberName;
+		case EJsonNotation::Error: return MemberName;
+		}
+
+		if (MemberName.IsEmpty())
+		{
+			Self().SetErrorState("Unexpected empty member name. Probably array instead of object is read.");
+			return MemberName;
+		}
+		return MemberName;
+	}
+
+	/*
+	 * Same as ReadMember() but doesn't copy member name. Returned view is valid until next ReadNext() call.
+	 */
+	FStringView ReadMemberView()
+	{
+		const FStringView MemberName = Self().GetIdentifierView();
+
+		// ReSharper disable once CppIncompleteSwitchStatement, CppDefaultCaseNotHandledInSwitchStatement
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::ArrayEnd: Self().SetErrorState("Unexpected end of array when object's member is expected.");
+			return MemberName;
+		case EJsonNotation::ObjectEnd: Self().SetErrorState("Unexpected end of object when object's member is expected.");
+			return MemberName;
+		case EJsonNotation::Error: return MemberName;
+		}
+
+		if (MemberName.IsEmpty())
+		{
+			Self().SetErrorState("Unexpected empty member name. Probably array instead of object is read.");
+			return MemberName;
+		}
+		return MemberName;
+	}
+
+	bool ReadValue(int8& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+		case EJsonNotation::Number:
+			Value = static_cast<int8>(Self().GetValueAsInt64());
+			return true;
+		case EJsonNotation::Null:
+			Value = 0;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(uint8& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+		case EJsonNotation::Number:
+			Value = static_cast<uint8>(Self().GetValueAsInt64());
+			return true;
+		case EJsonNotation::Null:
+			Value = 0;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(int16& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+		case EJsonNotation::Number:
+			Value = static_cast<int16>(Self().GetValueAsInt64());
+			return true;
+		case EJsonNotation::Null:
+			Value = 0;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(uint16& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+		case EJsonNotation::Number:
+			Value = static_cast<uint16>(Self().GetValueAsInt64());
+			return true;
+		case EJsonNotation::Null:
+			Value = 0;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(int32& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+		case EJsonNotation::Number:
+			Value = static_cast<int32>(Self().GetValueAsInt64());
+			return true;
+		case EJsonNotation::Null:
+			Value = 0;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(uint32& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+		case EJsonNotation::Number:
+			Value = static_cast<uint32>(Self().GetValueAsInt64());
+			return true;
+		case EJsonNotation::Null:
+			Value = 0;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(int64& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+		case EJsonNotation::Number:
+			Value = Self().GetValueAsInt64();
+			return true;
+		case EJsonNotation::Null:
+			Value = 0;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(uint64& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+		case EJsonNotation::Number:
+			Value = Self().GetValueAsUInt64();
+			return true;
+		case EJsonNotation::Null:
+			Value = 0;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(float& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+			Value = FCString::Atof(*Self().GetValueAsString());
+			return true;
+		case EJsonNotation::Number:
+			Value = static_cast<float>(Self().GetValueAsNumber());
+			return true;
+		case EJsonNotation::Null:
+			Value = 0;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(double& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+			Value = FCString::Atod(*Self().GetValueAsString());
+			return true;
+		case EJsonNotation::Number:
+			Value = Self().GetValueAsNumber();
+			return true;
+		case EJsonNotation::Null:
+			Value = 0;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(bool& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+			Value = Self().GetValueAsStringView().Equals(TEXT("true"), ESearchCase::IgnoreCase);
+			return true;
+		case EJsonNotation::Number:
+			Value = Self().GetValueAsNumber() > 0;
+			return true;
+		case EJsonNotation::Boolean:
+			Value = Self().GetValueAsBoolean();
+			return true;
+		case EJsonNotation::Null:
+			Value = false;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(FString& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+			Value = Self().GetValueAsString();
+			return true;
+		case EJsonNotation::Number:
+			Value = FString::SanitizeFloat(Self().GetValueAsNumber());
+			return true;
+		case EJsonNotation::Boolean:
+			Value = Self().GetValueAsBoolean() ? "True" : "False";
+			return true;
+		case EJsonNotation::Null:
+			Value.Empty();
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(FTimespan& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+			return FTimespan::Parse(Self().GetValueAsString(), Value);
+		case EJsonNotation::Number:
+			Value = FTimespan(static_cast<int64>(Self().GetValueAsNumber()));
+			return true;
+		case EJsonNotation::Null:
+			Value = FTimespan(0);
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(FDateTime& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+			return FDateTime::ParseIso8601(*Self().GetValueAsString(), Value);
+		case EJsonNotation::Null:
+			Value = FDateTime();
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(FVariant& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+			Value = FVariant(Self().GetValueAsString());
+			return true;
+		case EJsonNotation::Number:
+			Value = FVariant(Self().GetValueAsNumber());
+			return true;
+		case EJsonNotation::Boolean:
+			Value = FVariant(Self().GetValueAsBoolean());
+			return true;
+		case EJsonNotation::Null:
+			Value = FVariant();
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool ReadValue(FText& Value)
+	{
+		switch (Self().GetNotation())
+		{
+		case EJsonNotation::String:
+			Value = FText::FromStringView(Self().GetValueAsStringView());
+			return true;
+		case EJsonNotation::Number:
+			Value = FText::FromStringView(FString::SanitizeFloat(Self().GetValueAsNumber()));
+			return true;
+		case EJsonNotation::Boolean:
+			Value = FText::FromString(Self().GetValueAsBoolean() ? "True" : "False");
+			return true;
+		case EJsonNotation::Null:
+			Value = FText::GetEmpty();
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	template <typename T>
+	bool ReadValue(TOptional<T>& Optional)
+	{
+		T Value;
+		if (ReadValue(Value))
+		{
+			Optional = TOptional<T>(Value);
+			return true;
+		}
+		return false;
+	}
+
+	template <typename EnumType, typename = std::enable_if_t<std::is_enum_v<EnumType>>>
+	bool ReadValue(EnumType& EnumValue)
+	{
+		std::underlying_type_t<EnumType> Value;
+		if (ReadValue(Value))
+		{
+			EnumValue = static_cast<EnumType>(Value);
+			return true;
+		}
+		return false;
+	}
+
+	template <typename E>
+	constexpr auto ReadEnumValue(TOptional<E>& OptionalEnumValue) -> bool
+	{
+		static_assert(std::is_enum_v<E>, "E must be an enum type");
+		TOptional<std::underlying_type_t<E>> OptionalValue;
+		if (ReadValue(OptionalValue) && OptionalValue.IsSet())
+		{
+			OptionalEnumValue = static_cast<E>(OptionalValue.GetValue());
+			return true;
+		}
+		return false;
+	}
+};
@@ -0,0 +1,88 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Array.h"
+#include "Containers/BitArray.h"
+#include "Containers/Map.h"
+
+/*
+ * Dense view of enum-keyed document collection. Documents are stored in array indexed by enum value with validity bitmap,
+ * so lookup is bounds-checked array index instead of hash probe. Used by derived game data classes alongside TMap collection
+ * which stays source for Blueprints. View doesn't keep documents alive and should be rebuilt after collection is changed (see Build).
+ */
+template <typename EnumType, typename DocumentType>
+class TGameDataDenseDocumentMap
+{
+	static_assert(TIsEnum<EnumType>::Value, "Should only be used with enum types");
+	static_assert(sizeof(EnumType) <= sizeof(uint16), "Should only be used with 8-bit or 16-bit enum types");
+
+private:
+	TArray<DocumentType*> Documents;
+	TBitArray<> ValidDocuments;
+	int32 DocumentCount = 0;
+
+	static int32 ToIndex(const EnumType Id)
+	{
+		return static_cast<int32>(static_cast<std::underlying_type_t<EnumType>>(Id));
+	}
+
+public:
+	/*
+	 * Replace content of view with documents from specified collection.
+	 */
+	void Build(const TMap<EnumType, DocumentType*>& DocumentsById)
+	{
+		Reset();
+		for (const TPair<EnumType, DocumentType*>& DocumentById : DocumentsById)
+		{
+			Add(DocumentById.Key, DocumentById.Value);
+		}
+	}
+
+	void Add(const EnumType Id, DocumentType* Document)
+	{
+		const int32 Index = ToIndex(Id);
+		if (Index < 0)
+		{
+			return; // negative values of signed enums are not supported by dense view
+		}
+		if (Index >= Documents.Num())
+		{
+			Documents.SetNumZeroed(Index + 1);
+			ValidDocuments.Add(false, Index + 1 - ValidDocuments.Num());
+		}
+		if (!ValidDocuments[Index])
+		{
+			DocumentCount++;
+		}
+		Documents[Index] = Document;
+		ValidDocuments[Index] = true;
+	}
+
+	/*
+	 * Get document by id or nullptr if document is not found. Same as TMap::FindRef.
+	 */
+	DocumentType* FindRef(const EnumType Id) const
+	{
+		const int32 Index = ToIndex(Id);
+		return ValidDocuments.IsValidIndex(Index) && ValidDocuments[Index] ? Documents[Index] : nullptr;
+	}
+
+	bool Contains(const EnumType Id) const
+	{
+		const int32 Index = ToIndex(Id);
+		return ValidDocuments.IsValidIndex(Index) && ValidDocuments[Index];
+	}
+
+	int32 Num() const { return DocumentCount; }
+	bool IsEmpty() const { return DocumentCount == 0; }
+
+	void Reset()
+	{
+		Documents.Reset();
+		ValidDocuments.Reset();
+		DocumentCount = 0;
+	}
+};
@@ -0,0 +1,211 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/BitArray.h"
+#include "Containers/Map.h"
+#include "Serialization/Archive.h"
+#include "Templates/Casts.h"
+#include "UObject/UObjectGlobals.h"
+
+/*
+ * Storage of all documents of one schema in derived game data classes. Root and embedded documents are kept in one
+ * contiguous array with bitmask of root documents, and this array is what asset serializes, so each document is written
+ * once. AllXXX and XXX maps of game data stay Blueprint-visible UPROPERTYs, store keeps them in sync and keeps them out of
+ * saved asset (see DetachIdMaps). Store is not a UPROPERTY, owner should call Serialize() from its own override.
+ */
+template <typename IdType, typename DocumentType>
+class TGameDataDocumentStore
+{
+private:
+	TArray<DocumentType*> Documents;
+	TBitArray<> RootDocumentFlags;
+	TMap<IdType, DocumentType*>& AllDocumentsById;
+	TMap<IdType, DocumentType*>& RootDocumentsById;
+	// maps of owner moved aside while owner is saved, see DetachIdMaps()
+	TMap<IdType, DocumentType*> DetachedAllDocumentsById;
+	TMap<IdType, DocumentType*> DetachedRootDocumentsById;
+
+public:
+	/*
+	 * Create store which fills specified maps of owner with all and root documents.
+	 */
+	TGameDataDocumentStore(TMap<IdType, DocumentType*>& AllDocumentsById, TMap<IdType, DocumentType*>& RootDocumentsById)
+		: AllDocumentsById(AllDocumentsById), RootDocumentsById(RootDocumentsById) { }
+	TGameDataDocumentStore(const TGameDataDocumentStore&) = delete;
+	TGameDataDocumentStore& operator=(const TGameDataDocumentStore&) = delete;
+
+	/*
+	 * Add document or mark already added document as root. Document with same id as other stored document is ignored,
+	 * first added one wins like with TMap::FindOrAdd. Returns false if document is ignored.
+	 */
+	bool Add(DocumentType* Document, const bool bIsRoot)
+	{
+		if (Document == nullptr)
+		{
+			return false;
+		}
+
+		int32 Index = INDEX_NONE;
+		DocumentType*& StoredDocument = AllDocumentsById.FindOrAdd(Document->Id, nullptr);
+		if (StoredDocument == nullptr)
+		{
+			StoredDocument = Document;
+			Index = Documents.Add(Document);
+			RootDocumentFlags.Add(false);
+		}
+		else if (StoredDocument != Document)
+		{
+			return false;
+		}
+
+		if (bIsRoot && !RootDocumentsById.Contains(Document->Id))
+		{
+			RootDocumentsById.Add(Document->Id, Document);
+			if (Index == INDEX_NONE)
+			{
+				Index = Documents.Find(Document); // rare, document was found as embedded one before its collection was read
+			}
+			RootDocumentFlags[Index] = true;
+		}
+		return true;
+	}
+	void Append(const TArray<DocumentType*>& NewDocuments, const bool bIsRoot)
+	{
+		Reserve(Documents.Num() + NewDocuments.Num());
+		for (DocumentType* Document : NewDocuments)
+		{
+			Add(Document, bIsRoot);
+		}
+	}
+
+	/*
+	 * Get document by id or nullptr if document is not found.
+	 */
+	DocumentType* FindRef(const IdType& Id) const { return AllDocumentsById.FindRef(Id); }
+	bool IsRoot(const int32 Index) const { return RootDocumentFlags[Index]; }
+	int32 Num() const { return Documents.Num(); }
+	int32 NumRoots() const { return RootDocumentsById.Num(); }
+	TArrayView<DocumentType* const> GetDocuments() const { return Documents; }
+
+	/*
+	 * Append all or only root documents to specified array in order they were added, without walking maps.
+	 */
+	template <typename ElementType>
+	void AppendTo(TArray<ElementType*>& OutDocuments, const bool bRootOnly) const
+	{
+		OutDocuments.Reserve(OutDocuments.Num() + (bRootOnly ? NumRoots() : Num()));
+		for (int32 Index = 0; Index < Documents.Num(); Index++)
+		{
+			if (!bRootOnly || RootDocumentFlags[Index])
+			{
+				OutDocuments.Add(Documents[Index]);
+			}
+		}
+	}
+
+	void Reserve(const int32 Number)
+	{
+		Documents.Reserve(Number);
+		RootDocumentFlags.Reserve(Number);
+		AllDocumentsById.Reserve(Number);
+	}
+	void Reset()
+	{
+		Documents.Reset();
+		RootDocumentFlags.Reset();
+		AllDocumentsById.Reset();
+		RootDocumentsById.Reset();
+	}
+
+	/*
+	 * Serialize documents with their root flags. Ids are not serialized because documents are not loaded yet when owner is
+	 * serialized, owner should call RebuildIdMaps() from PostLoad().
+	 */
+	void Serialize(FArchive& Ar)
+	{
+		int32 DocumentCount = Documents.Num();
+		Ar << DocumentCount;
+		if (Ar.IsLoading())
+		{
+			Reset();
+			if (DocumentCount < 0)
+			{
+				Ar.SetError();
+				return;
+			}
+			Documents.SetNumZeroed(DocumentCount);
+		}
+
+		for (DocumentType*& Document : Documents)
+		{
+			UObject* Object = Document;
+			Ar << Object;
+			Document = Cast<DocumentType>(Object);
+		}
+		Ar << RootDocumentFlags;
+
+		if (Ar.IsLoading() && RootDocumentFlags.Num() != Documents.Num())
+		{
+			Reset();
+			Ar.SetError();
+		}
+	}
+	/*
+	 * Re-create id maps from stored documents. Documents which are gone since serialization are dropped.
+	 */
+	void RebuildIdMaps()
+	{
+		TArray<DocumentType*> LoadedDocuments = MoveTemp(Documents);
+		TBitArray<> LoadedRootDocumentFlags = MoveTemp(RootDocumentFlags);
+		Reset();
+		Reserve(LoadedDocuments.Num());
+		for (int32 Index = 0; Index < LoadedDocuments.Num(); Index++)
+		{
+			Add(LoadedDocuments[Index], LoadedRootDocumentFlags.IsValidIndex(Index) && LoadedRootDocumentFlags[Index]);
+		}
+	}
+	/*
+	 * Re-create stored documents from id maps of owner. Used for assets saved before FGameDataCustomVersion::DocumentStores,
+	 * which have AllXXX and XXX maps serialized as tagged properties instead of store.
+	 */
+	void RebuildFromIdMaps()
+	{
+		const TMap<IdType, DocumentType*> LoadedAllDocumentsById = MoveTemp(AllDocumentsById);
+		const TMap<IdType, DocumentType*> LoadedRootDocumentsById = MoveTemp(RootDocumentsById);
+		Reset();
+		Reserve(LoadedAllDocumentsById.Num() + LoadedRootDocumentsById.Num());
+		for (const TPair<IdType, DocumentType*>& DocumentById : LoadedRootDocumentsById)
+		{
+			Add(DocumentById.Value, /* bIsRoot */ true);
+		}
+		for (const TPair<IdType, DocumentType*>& DocumentById : LoadedAllDocumentsById)
+		{
+			Add(DocumentById.Value, /* bIsRoot */ false);
+		}
+	}
+
+	/*
+	 * Move id maps of owner aside while owner saves its tagged properties. Empty maps are equal to class defaults and are
+	 * not written, documents are saved once by Serialize(). Call AttachIdMaps() when saving is done.
+	 */
+	void DetachIdMaps()
+	{
+		DetachedAllDocumentsById = MoveTemp(AllDocumentsById);
+		DetachedRootDocumentsById = MoveTemp(RootDocumentsById);
+	}
+	void AttachIdMaps()
+	{
+		AllDocumentsById = MoveTemp(DetachedAllDocumentsById);
+		RootDocumentsById = MoveTemp(DetachedRootDocumentsById);
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return Documents.GetAllocatedSize() + RootDocumentFlags.GetAllocatedSize() + AllDocumentsById.GetAllocatedSize() +
+			RootDocumentsById.GetAllocatedSize();
+	}
+};
@@ -4,14 +4,21 @@
 
 #include "CoreMinimal.h"
 #include "EGameDataFormat.h"
+#include "FGameDataLoadOptions.h"
 #include "UGameDataDocument.h"
 #include "UObject/Class.h"
 #include "Engine/DataAsset.h"
 #include "GameData/UGameDataImportData.h"
 #include "Misc/EngineVersionComparison.h"
+#include "Async/Future.h"
+#include "Formatters/IGameDataReader.h"
+#include "FGameDataReferrersIndex.h"
+#include "FGameDataDocumentIndexes.h"
 
 #include "UGameDataBase.generated.h"
 
+DECLARE_LOG_CATEGORY_EXTERN(LogUGameDataBase, Log, All);
+
 /*
  * Base class for specific game data classes. Provides methods and data for UE editor extensions and stores import-related information.
  */
@@ -26,17 +33,71 @@ public:
 	 */
 	UPROPERTY(VisibleAnywhere, Instanced, Category = ImportSettings)
 	TObjectPtr<UGameDataImportData> AssetImportData;
+	/*
+	 * Secondary indexes on document properties which are built after each load, see FindDocumentsByIndex().
+	 */
+	UPROPERTY(EditAnywhere, Category = "Document Indexes")
+	TArray<FGameDataDocumentIndexDeclaration> IndexDeclarations;
 
 	/*
 	 * Try to load game data from specified game data file/stream using specified file format.
 	 * Used for import. Patch-enabled load method is defined on derived class. 
 	 */
 	virtual bool TryLoad(FArchive* const GameDataStream, EGameDataFormat Format) { return false; }
+	/*
+	 * Try to load game data from specified in-memory game data file using specified file format.
+	 * Buffer should outlive this call. Derived class reads buffer directly, default implementation wraps it into FArchive.
+	 */
+	virtual bool TryLoad(const TArrayView<const uint8> GameDataBuffer, EGameDataFormat Format);
+	/*
+	 * Same as TryLoad(TArrayView, EGameDataFormat) with load options. Derived class supports all options, default implementation only Format.
+	 */
+	virtual bool TryLoad(const TArrayView<const uint8> GameDataBuffer, FGameDataLoadOptions Options);
+	/*
+	 * Try to load game data from specified game data file using specified file format.
+	 * File is memory mapped and read in place with TryLoad(TArrayView), so it is never copied when platform supports mapping.
+	 * When FGameDataCompiledCache is enabled, game data is loaded from cached compiled image with same RevisionHash if it exists.
+	 */
+	bool TryLoadFile(const FString& GameDataFilePath, EGameDataFormat Format);
+	/*
+	 * Same as TryLoadFile(FString, EGameDataFormat) with load options. Cache is not used when Options has patches,
+	 * because cached image is compiled from source file alone.
+	 */
+	bool TryLoadFile(const FString& GameDataFilePath, const FGameDataLoadOptions& Options);
+	/*
+	 * Try to load game data from compiled image of specified game data file (see FCompiledGameDataWriter::GetCompiledFilePath).
+	 * Image is written by editor import. Image is rejected if its RevisionHash differs from source file or it has other format
+	 * version, then game data is loaded from source (through FGameDataCompiledCache if it is enabled), image is not overwritten.
+	 * If source file is missing (e.g. only compiled image is shipped), image is loaded as is.
+	 */
+	bool TryLoadCompiledFile(const FString& GameDataFilePath, EGameDataFormat Format);
+	/*
+	 * Asynchronously load game data from specified game data file using specified file format.
+	 * File is read in chunks and compiled on worker thread while next chunk is read (see FCompiledGameDataWriter), then documents
+	 * are created from compiled image and linked on game thread. With Patches source is read as is and parsed on game thread.
+	 * OnProgress is called on game thread with fraction of file read [0..1]. Returned future is completed on game thread.
+	 * Only one asynchronous load could run at a time, overlapping load is rejected with warning and completed with false.
+	 * Patches and Stats of Options should outlive returned future.
+	 */
+	TFuture<bool> TryLoadAsync(const FString& GameDataFilePath, const FGameDataLoadOptions& Options, TFunction<void(float)> OnProgress = nullptr);
+	TFuture<bool> TryLoadAsync(const FString& GameDataFilePath, EGameDataFormat Format, TFunction<void(float)> OnProgress = nullptr);
 
 	/*
 	 * Find UGameDataDocument of specified SchemaNameOrId by DocumentId. Returns nullptr if document or schema is not found. Used by FGameDataDocumentReference.
 	 */
 	virtual UGameDataDocument* FindGameDataDocumentById(const FString& SchemaNameOrId, const FString& DocumentId) { return  nullptr; }
+	/*
+	 * Find UGameDataDocument for each pair of SchemaNameOrId and DocumentId. OutDocuments receives one entry per pair in the same order, nullptr if document or schema is not found.
+	 * Derived classes resolve schema once for consecutive pairs of the same schema.
+	 */
+	virtual void FindGameDataDocumentsById(const TArrayView<const TPair<FString, FString>> SchemaNameAndDocumentIds, TArray<UGameDataDocument*>& OutDocuments)
+	{
+		OutDocuments.Reset(SchemaNameAndDocumentIds.Num());
+		for (const TPair<FString, FString>& SchemaNameAndDocumentId : SchemaNameAndDocumentIds)
+		{
+			OutDocuments.Add(FindGameDataDocumentById(SchemaNameAndDocumentId.Key, SchemaNameAndDocumentId.Value));
+		}
+	}
 	/*
 	 * Find document UClass by specified SchemaNameOrId. Used by FGameDataDocumentReferenceCustomization.
 	 */
@@ -72,10 +133,127 @@ public:
 		// fallback to empty value 
 		return FStringView();
 	}
+	/*
+	 * Get version of generator which produced derived class. Part of FGameDataCompiledCache key.
+	 */
+	virtual FStringView GetGeneratorVersion() const { return FStringView(); }
+	/*
+	 * Get generation of loaded documents. Changed each time documents are replaced by load, used by FGameDataDocumentReference
+	 * to check cached document with integer compare. Values are unique across all game data instances and never 0.
+	 */
+	uint32 GetLoadGeneration() const { return LoadGeneration; }
+	/*
+	 * Get documents which reference specified document and referencing property names.
+	 * Requires game data loaded with FGameDataLoadOptions::BuildReferrersIndex, otherwise result is empty.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Game Data")
+	TArray<FGameDataDocumentReferrer> GetReferrers(const UGameDataDocument* Document) const
+	{
+		return TArray<FGameDataDocumentReferrer>(ReferrersIndex.GetReferrers(Document));
+	}
+	/*
+	 * Same as GetReferrers() without copying result. View is valid until next load.
+	 */
+	TArrayView<const FGameDataDocumentReferrer> GetReferrersView(const UGameDataDocument* Document) const
+	{
+		return ReferrersIndex.GetReferrers(Document);
+	}
+	/*
+	 * Find documents of specified schema by value of string/name property or by primary language text of localized text property,
+	 * e.g. 'Name' of UHero. Requires hash index declared in IndexDeclarations
+	 * or FGameDataLoadOptions::DocumentIndexes, otherwise result is empty.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Game Data")
+	TArray<UGameDataDocument*> FindDocumentsByIndex(const FString& SchemaName, FName PropertyName, const FString& Value) const
+	{
+		return TArray<UGameDataDocument*>(DocumentIndexes.Find(SchemaName, PropertyName, Value));
+	}
+	/*
+	 * Find documents of specified schema by value of integer/enum/bool property. Requires hash index, see FindDocumentsByIndex().
+	 */
+	UFUNCTION(BlueprintCallable, Category="Game Data")
+	TArray<UGameDataDocument*> FindDocumentsByIntegerIndex(const FString& SchemaName, FName PropertyName, int64 Value) const
+	{
+		return TArray<UGameDataDocument*>(DocumentIndexes.Find(SchemaName, PropertyName, Value));
+	}
+	/*
+	 * Find documents of specified schema with numeric property value in [Min, Max] range, ordered by value.
+	 * Requires sorted index declared in IndexDeclarations or FGameDataLoadOptions::DocumentIndexes, otherwise result is empty.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Game Data")
+	TArray<UGameDataDocument*> FindDocumentsInRange(const FString& SchemaName, FName PropertyName, double Min, double Max) const
+	{
+		return TArray<UGameDataDocument*>(DocumentIndexes.FindInRange(SchemaName, PropertyName, Min, Max));
+	}
+	/*
+	 * Find documents of specified schema with integer/enum property value in [Min, Max] range ordered by value. Unlike FindDocumentsInRange()
+	 * bounds are exact for 64-bit values. Requires sorted index, see FindDocumentsByIndex().
+	 */
+	UFUNCTION(BlueprintCallable, Category="Game Data")
+	TArray<UGameDataDocument*> FindDocumentsInIntegerRange(const FString& SchemaName, FName PropertyName, int64 Min, int64 Max) const
+	{
+		return TArray<UGameDataDocument*>(DocumentIndexes.FindInIntegerRange(SchemaName, PropertyName, Min, Max));
+	}
+	/*
+	 * Same as FindDocumentsByIndex() and FindDocumentsByIntegerIndex() without copying result. View is valid until next load.
+	 */
+	TArrayView<UGameDataDocument* const> FindDocumentsByIndexView(const FString& SchemaName, const FName PropertyName, const FString& Value) const
+	{
+		return DocumentIndexes.Find(SchemaName, PropertyName, Value);
+	}
+	TArrayView<UGameDataDocument* const> FindDocumentsByIndexView(const FString& SchemaName, const FName PropertyName, const int64 Value) const
+	{
+		return DocumentIndexes.Find(SchemaName, PropertyName, Value);
+	}
+	/*
+	 * Same as FindDocumentsInRange() without copying result. View is valid until next load.
+	 */
+	TArrayView<UGameDataDocument* const> FindDocumentsInRangeView(const FString& SchemaName, const FName PropertyName, const double Min, const double Max) const
+	{
+		return DocumentIndexes.FindInRange(SchemaName, PropertyName, Min, Max);
+	}
+	/*
+	 * Same as FindDocumentsInIntegerRange() without copying result. View is valid until next load.
+	 */
+	TArrayView<UGameDataDocument* const> FindDocumentsInIntegerRangeView(const FString& SchemaName, const FName PropertyName, const int64 Min, const int64 Max) const
+	{
+		return DocumentIndexes.FindInIntegerRange(SchemaName, PropertyName, Min, Max);
+	}
 	
 	virtual void PostInitProperties() override;
 	virtual void PostLoad() override;
 #if UE_VERSION_NEWER_THAN(5, 4, -1)
 	virtual void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
 #endif
+
+protected:
+	/*
+	 * Load game data from prepared reader. Implemented by derived class.
+	 */
+	virtual bool TryLoadFromReader(TSharedRef<IGameDataReader> GameDataReader, const FGameDataLoadOptions& Options) { return false; }
+	/*
+	 * Start new load generation. Called by derived class before loaded documents are replaced.
+	 */
+	void IncrementLoadGeneration();
+	/*
+	 * Build indexes of IndexDeclarations and LoadIndexDeclarations over AllDocuments. Called by derived class at end of load.
+	 * Localized texts are indexed by their text in PrimaryLanguageId.
+	 */
+	void BuildDocumentIndexes(const TArray<UGameDataDocument*>& AllDocuments, const TArrayView<const FGameDataDocumentIndexDeclaration> LoadIndexDeclarations,
+		const FString& PrimaryLanguageId);
+
+	/*
+	 * Filled by derived class during reference linking, see GetReferrers().
+	 */
+	FGameDataReferrersIndex ReferrersIndex;
+	/*
+	 * Built by BuildDocumentIndexes(), see FindDocumentsByIndex().
+	 */
+	FGameDataDocumentIndexes DocumentIndexes;
+
+private:
+	uint32 LoadGeneration = 0;
+	bool IsLoadingAsync = false;
+
+	bool TryLoadCached(const TArrayView<const uint8> GameDataBuffer, FGameDataLoadOptions Options);
 };
\ No newline at end of file
@@ -12,6 +12,9 @@
 #include "EDocumentReferenceGetResult.h"
 #include "FLocalizedText.h"
 #include "UGameDataDocument.h"
+#include "UGameDataBase.h"
+#include "EGameDataFormat.h"
+#include "Engine/LatentActionManager.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 
 #include "UGameDataLibrary.generated.h"
@@ -43,6 +46,12 @@ public:
 		return Document;
 	}
 
+	/*
+	 * Asynchronously load specified GameData from game data file with UGameDataBase::TryLoadAsync. Execution continues when loading is finished.
+	 */
+	UFUNCTION(BlueprintCallable, Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"), Category="Game Data")
+	static void LoadGameDataAsync(UObject* WorldContextObject, UGameDataBase* GameData, FString GameDataFilePath, EGameDataFormat Format, bool& bSuccess, FLatentActionInfo LatentInfo);
+
 	/*
 	 * Get current text specified in internal ULanguageSwitcher of selected LocalizedString.
 	 */
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
 #include "ELocalizedTextFallbackOption.h"
 #include "UObject/Class.h"
 
@@ -37,5 +39,46 @@ public:
 	 */
 	UPROPERTY(BlueprintReadOnly, Category="Game Data")
 	ELocalizedTextFallbackOption FallbackOption = ELocalizedTextFallbackOption::OnNull;
+
+	/*
+	 * Changed by MarkLanguageChanged(). FLocalizedText keeps epoch of its cached value, so cache check is a single integer compare.
+	 */
+	uint32 LanguageEpoch = 0;
+
+	/*
+	 * Call after changing any of language properties to rebuild language lookup order and invalidate cached values of FLocalizedText.
+	 */
+	void MarkLanguageChanged()
+	{
+		LanguageLookupOrder.Reset();
+		for (const FString* LanguageId : { &CurrentLanguageId, &FallbackLanguageId, &PrimaryLanguageId })
+		{
+			if (!LanguageId->IsEmpty())
+			{
+				LanguageLookupOrder.AddUnique(*LanguageId);
+			}
+		}
+		LanguageEpoch++;
+	}
+
+	/*
+	 * Languages to look for text in, resolved from CurrentLanguageId, FallbackLanguageId and PrimaryLanguageId once per language switch.
+	 */
+	const TArray<FString, TInlineAllocator<3>>& GetLanguageLookupOrder() const { return LanguageLookupOrder; }
+
+	virtual void PostInitProperties() override
+	{
+		Super::PostInitProperties();
+		MarkLanguageChanged();
+	}
+
+	virtual void PostLoad() override
+	{
+		Super::PostLoad();
+		MarkLanguageChanged();
+	}
+
+private:
+	TArray<FString, TInlineAllocator<3>> LanguageLookupOrder;
 };
 
@@ -2,6 +2,8 @@
 
 #include "GameData/FGameDataReimportHandler.h"
 #include "GameData/UGameDataBase.h"
+#include "GameData/FGameDataMappedFile.h"
+#include "GameData/Formatters/FCompiledGameDataWriter.h"
 
 DEFINE_LOG_CATEGORY(LogFGameDataReimportHandler);
 
@@ -73,18 +75,25 @@ EReimportResult::Type FGameDataReimportHandler::Reimport(UObject* Obj)
 		return EReimportResult::Failed;
 	}
 
-	const TUniquePtr<FArchive> Stream(IFileManager::Get().CreateFileReader(*GameDataFilePath, 0));
-	if (Stream == nullptr)
+	if (!FPaths::FileExists(GameDataFilePath))
 	{
 		UE_LOG(LogFGameDataReimportHandler, Error, TEXT("Failed open file '%s' for import."), *GameDataFilePath);
 		return EReimportResult::Failed;
 	}
-	if (!GameData->TryLoad(Stream.Get(), Format))
+	FGameDataMappedFile GameDataFile;
+	if (!GameDataFile.Open(GameDataFilePath) || !GameData->TryLoad(GameDataFile.GetData(), Format))
 	{
 		UE_LOG(LogFGameDataReimportHandler, Error, TEXT("Failed to import Game Data from file '%s'. Read logs for details."), *GameDataFilePath);
 		return EReimportResult::Failed;
 	}
 
+	// re-compile image next to source file for TryLoadCompiledFile(), runtime never writes it
+	TArray<uint8> CompiledImage;
+	if (!FCompiledGameDataWriter::CompileFile(GameDataFilePath, GameDataFile.GetData(), Format, CompiledImage))
+	{
+		UE_LOG(LogFGameDataReimportHandler, Warning, TEXT("Failed to compile Game Data file '%s'. Read logs for details."), *GameDataFilePath);
+	}
+
 	UE_LOG(LogFGameDataReimportHandler, Log, TEXT("Successfully imported game data from file '%s' in %f seconds."), *GameDataFilePath, FPlatformTime::Seconds() - StartTime);
 
 	if (!GameData->AssetImportData->PublishLanguages.IsEmpty())
@@ -6,6 +6,8 @@
 #include "Misc/FeedbackContext.h"
 #include "JsonObjectConverter.h"
 #include "GameData/UGameDataBase.h"
+#include "GameData/FGameDataMappedFile.h"
+#include "GameData/Formatters/FCompiledGameDataWriter.h"
 #include "Serialization/MemoryReader.h"
 #include "ClassViewerModule.h"
 #include "FAssetClassParentFilter.h"
@@ -15,6 +17,22 @@
 
 DEFINE_LOG_CATEGORY(LogUImportGameDataFactory);
 
+static bool UImportGameDataFactory_TryGetFormat(const TCHAR* InType, EGameDataFormat& OutFormat)
+{
+	if (FCString::Stricmp(InType, TEXT("GDJS")) == 0 || FCString::Stricmp(InType, TEXT("JSON")) == 0)
+	{
+		OutFormat = EGameDataFormat::Json;
+		return true;
+	}
+	if (FCString::Stricmp(InType, TEXT("GDMP")) == 0 || FCString::Stricmp(InType, TEXT("MSGPACK")) == 0 ||
+		FCString::Stricmp(InType, TEXT("MSGPCK")) == 0)
+	{
+		OutFormat = EGameDataFormat::MessagePack;
+		return true;
+	}
+	return false;
+}
+
 bool UImportGameDataFactory::PickClass()
 {
 	// nullptr the GameDataClass so we can check for selection
@@ -91,11 +109,30 @@ UObject* UImportGameDataFactory::FactoryCreateFile
 	bool& bOutOperationCanceled
 )
 {
+	// same as Super::FactoryCreateFile() but file is memory mapped instead of being copied into array
+	FGameDataMappedFile GameDataFile;
+	if (!GameDataFile.Open(Filename))
+	{
+		Warn->Logf(ELogVerbosity::Error, TEXT("Failed to load file '%s'."), *Filename);
+		return nullptr;
+	}
+	ParseParms(Params);
+	const TArrayView<const uint8> GameDataBuffer = GameDataFile.GetData();
+	const uint8* Buffer = GameDataBuffer.GetData();
 	const auto GameData = Cast<UGameDataBase>(
-		Super::FactoryCreateFile(InClass, InParent, InName, Flags, Filename, Params, Warn, bOutOperationCanceled));
+		FactoryCreateBinary(InClass, InParent, InName, Flags, nullptr, *FPaths::GetExtension(Filename), Buffer, Buffer + GameDataBuffer.Num(), Warn));
 	if (GameData != nullptr)
 	{
 		GameData->AssetImportData->UpdateFilenameOnly(Filename);
+
+		// publish compiled image next to source file for TryLoadCompiledFile(), runtime never writes it
+		EGameDataFormat Format;
+		TArray<uint8> CompiledImage;
+		if (UImportGameDataFactory_TryGetFormat(*FPaths::GetExtension(Filename), Format) &&
+			!FCompiledGameDataWriter::CompileFile(Filename, GameDataBuffer, Format, CompiledImage))
+		{
+			Warn->Logf(ELogVerbosity::Warning, TEXT("Failed to compile game data file '%s'. Detailed information is provided in the Output Log."), *Filename);
+		}
 	}
 	return GameData;
 }
@@ -122,16 +159,7 @@ UObject* UImportGameDataFactory::FactoryCreateBinary
 
 	const FString FileName = InName.ToString();
 	const FString Extension = FPaths::GetExtension(FileName);
-	if (FCString::Stricmp(InType, TEXT("GDJS")) == 0 || FCString::Stricmp(InType, TEXT("JSON")) == 0)
-	{
-		Format = EGameDataFormat::Json;
-	}
-	else if (FCString::Stricmp(InType, TEXT("GDMP")) == 0 || FCString::Stricmp(InType, TEXT("MSGPACK")) == 0 ||
-		FCString::Stricmp(InType, TEXT("MSGPCK")) == 0)
-	{
-		Format = EGameDataFormat::MessagePack;
-	}
-	else
+	if (!UImportGameDataFactory_TryGetFormat(InType, Format))
 	{
 		Warn->Logf(ELogVerbosity::Error,
 		           TEXT(
@@ -178,8 +206,8 @@ UObject* UImportGameDataFactory::FactoryCreateBinary
 		GameData = NewObject<UGameDataBase>(InParent, InClass, InName, Flags);
 	}
 
-	FBufferReader Stream((void*)Buffer, BufferEnd - Buffer, false);
-	if (!GameData->TryLoad(&Stream, Format))
+	const TArrayView<const uint8> GameDataBuffer(Buffer, BufferEnd - Buffer);
+	if (!GameData->TryLoad(GameDataBuffer, Format))
 	{
 		Warn->Logf(ELogVerbosity::Error,
 		           TEXT(
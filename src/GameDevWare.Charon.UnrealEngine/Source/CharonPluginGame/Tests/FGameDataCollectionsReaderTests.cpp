@@ -0,0 +1,191 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#if WITH_TESTS
+
+#include "Tests/TestHarnessAdapter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/BufferReader.h"
+#include "GameData/EGameDataFormat.h"
+#include "GameData/Formatters/FGameDataReaderFactory.h"
+#include "GameData/Formatters/FGameDataCollectionsReader.h"
+#include "GameData/Formatters/FCompiledGameDataWriter.h"
+
+TEST_CASE_NAMED(FGameDataCollectionsReaderTest, "Charon::FGameDataCollectionsReaderTest", "[Core]")
+{
+	auto ToBuffer = [](const ANSICHAR* Json) -> TArray<uint8>
+	{
+		return TArray<uint8>(reinterpret_cast<const uint8*>(Json), FCStringAnsi::Strlen(Json));
+	};
+	auto ToString = [](const TArrayView<const uint8> Utf8) -> FString
+	{
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Utf8.GetData()), Utf8.Num());
+		return FString(Converted.Length(), Converted.Get());
+	};
+	// reads current value to the end and collects its tokens
+	auto ReadValueTokens = [](const TSharedRef<IGameDataReader>& Reader, TArray<EJsonNotation>& Tokens)
+	{
+		int32 Depth = 0;
+		do
+		{
+			const EJsonNotation Notation = Reader->GetNotation();
+			Tokens.Add(Notation);
+			if (Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart)
+			{
+				Depth++;
+			}
+			else if (Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd)
+			{
+				Depth--;
+			}
+			else if (Notation == EJsonNotation::Error)
+			{
+				return;
+			}
+		} while (Depth > 0 && Reader->ReadNext());
+		Reader->ReadNext();
+	};
+	auto MoveToCollections = [](const TSharedRef<IGameDataReader>& Reader)
+	{
+		Reader->ReadNext();
+		Reader->ReadObjectBegin();
+		while (Reader->GetNotation() != EJsonNotation::ObjectEnd && !Reader->IsError())
+		{
+			if (Reader->ReadMemberView() == TEXT("Collections"))
+			{
+				return true;
+			}
+			Reader->SkipAny();
+		}
+		return false;
+	};
+
+	SECTION("ReadRawValue")
+	{
+		TArray<uint8> Buffer = ToBuffer(R"({ "a": [1, {"b": "text"}], "c": "value", "d": 2 })");
+
+		auto Reader = FGameDataReaderFactory::CreateJsonReader(TArrayView<const uint8>(Buffer));
+		Reader->ReadNext();
+		Reader->ReadObjectBegin();
+
+		TArrayView<const uint8> RawValue;
+		REQUIRE(Reader->ReadRawValue(RawValue));
+		CHECK(ToString(RawValue) == TEXT(R"([1, {"b": "text"}])"));
+		REQUIRE(Reader->ReadRawValue(RawValue));
+		CHECK(ToString(RawValue) == TEXT(R"("value")"));
+		CHECK(Reader->GetIdentifier() == TEXT("d"));
+
+		const TSharedPtr<IGameDataReader> ValueReader = Reader->CreateRawValueReader(RawValue);
+		REQUIRE(ValueReader.IsValid());
+		REQUIRE(ValueReader->ReadNext());
+		CHECK(ValueReader->GetValueAsString() == TEXT("value"));
+		CHECK(!ValueReader->ReadNext());
+		CHECK(ValueReader->GetErrorMessage().IsEmpty());
+
+		auto Stream = MakeUnique<FBufferReader>(Buffer.GetData(), Buffer.Num(), false, false);
+		auto StreamReader = FGameDataReaderFactory::CreateJsonReader(Stream.Get());
+		StreamReader->ReadNext();
+		StreamReader->ReadObjectBegin();
+		CHECK(!StreamReader->ReadRawValue(RawValue));
+		CHECK(StreamReader->GetNotation() == EJsonNotation::ArrayStart);
+	}
+
+	SECTION("GetRawTokenBounds")
+	{
+		auto CreateReader = [](const TArrayView<const uint8> Buffer, const EGameDataFormat Format)
+		{
+			switch (Format)
+			{
+			case EGameDataFormat::MessagePack: return FGameDataReaderFactory::CreateMessagePackReader(Buffer);
+			case EGameDataFormat::Compiled: return FGameDataReaderFactory::CreateCompiledReader(Buffer);
+			default: return FGameDataReaderFactory::CreateJsonReader(Buffer);
+			}
+		};
+		for (const TTuple<const TCHAR*, EGameDataFormat> GameDataFile : {
+			MakeTuple(TEXT("TestData.gdjs"), EGameDataFormat::Json),
+			MakeTuple(TEXT("TestData.gdmp"), EGameDataFormat::MessagePack) })
+		{
+			TArray<uint8> Buffer;
+			REQUIRE(FFileHelper::LoadFileToArray(Buffer, *FPaths::Combine(FPaths::ProjectContentDir(), GameDataFile.Key)));
+			TArray<uint8> CompiledImage;
+			REQUIRE(FCompiledGameDataWriter::Compile(Buffer, GameDataFile.Value, CompiledImage));
+
+			for (const TTuple<TArray<uint8>*, EGameDataFormat> Source : {
+				MakeTuple(&Buffer, GameDataFile.Value),
+				MakeTuple(&CompiledImage, EGameDataFormat::Compiled) })
+			{
+				const TSharedRef<IGameDataReader> RawValueReader = CreateReader(*Source.Key, Source.Value);
+				REQUIRE(MoveToCollections(RawValueReader));
+				TArrayView<const uint8> RawValue;
+				REQUIRE(RawValueReader->ReadRawValue(RawValue));
+
+				// value walked token by token spans the same bytes as raw value
+				const TSharedRef<IGameDataReader> Reader = CreateReader(*Source.Key, Source.Value);
+				REQUIRE(MoveToCollections(Reader));
+				const uint8* ValueStart = nullptr;
+				const uint8* TokenStart = nullptr;
+				const uint8* TokenEnd = nullptr;
+				REQUIRE(Reader->GetRawTokenBounds(ValueStart, TokenEnd));
+				int32 Depth = 0;
+				do
+				{
+					const EJsonNotation Notation = Reader->GetNotation();
+					Depth += Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart ? 1 : 0;
+					Depth -= Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd ? 1 : 0;
+				} while (Depth > 0 && Reader->ReadNext());
+				REQUIRE(Reader->GetRawTokenBounds(TokenStart, TokenEnd));
+				CHECK(ValueStart == RawValue.GetData());
+				CHECK(TokenEnd == RawValue.GetData() + RawValue.Num());
+			}
+		}
+	}
+
+	SECTION("ReadCollectionsInParallel")
+	{
+		for (const TTuple<const TCHAR*, EGameDataFormat> GameDataFile : {
+			MakeTuple(TEXT("TestData.gdjs"), EGameDataFormat::Json),
+			MakeTuple(TEXT("TestData.gdmp"), EGameDataFormat::MessagePack) })
+		{
+			TArray<uint8> Buffer;
+			REQUIRE(FFileHelper::LoadFileToArray(Buffer, *FPaths::Combine(FPaths::ProjectContentDir(), GameDataFile.Key)));
+
+			auto Stream = MakeUnique<FBufferReader>(Buffer.GetData(), Buffer.Num(), false, false);
+			const bool IsJson = GameDataFile.Value == EGameDataFormat::Json;
+			auto ExpectedReader = IsJson ? FGameDataReaderFactory::CreateJsonReader(Stream.Get()) : FGameDataReaderFactory::CreateMessagePackReader(Stream.Get());
+			auto ActualReader = IsJson ? FGameDataReaderFactory::CreateJsonReader(TArrayView<const uint8>(Buffer)) : FGameDataReaderFactory::CreateMessagePackReader(TArrayView<const uint8>(Buffer));
+			REQUIRE(MoveToCollections(ExpectedReader));
+			REQUIRE(MoveToCollections(ActualReader));
+
+			FGameDataCollectionsReader ExpectedCollections(ExpectedReader);
+			FGameDataCollectionsReader ActualCollections(ActualReader, /* MinParallelSize */ 0);
+			REQUIRE(ExpectedCollections.ReadBegin());
+			REQUIRE(ActualCollections.ReadBegin());
+			CHECK(!ExpectedCollections.IsParallel());
+			CHECK(ActualCollections.IsParallel());
+
+			int32 CollectionCount = 0;
+			FStringView ExpectedName, ActualName;
+			while (ExpectedCollections.ReadNextCollection(ExpectedName))
+			{
+				REQUIRE(ActualCollections.ReadNextCollection(ActualName));
+				CHECK(FString(ExpectedName) == FString(ActualName));
+				CHECK(ActualCollections.GetCollectionReader()->GetReaderType() == EGameDataReaderType::Compiled);
+
+				TArray<EJsonNotation> ExpectedTokens, ActualTokens;
+				ReadValueTokens(ExpectedCollections.GetCollectionReader(), ExpectedTokens);
+				ReadValueTokens(ActualCollections.GetCollectionReader(), ActualTokens);
+				CHECK(ExpectedTokens == ActualTokens);
+				CollectionCount++;
+			}
+			CHECK(!ActualCollections.ReadNextCollection(ActualName));
+			CHECK(!ExpectedCollections.IsError());
+			CHECK(!ActualCollections.IsError());
+			CHECK(CollectionCount > 1);
+
+			// both readers are moved past "Collections" object
+			CHECK(ExpectedReader->GetNotation() == ActualReader->GetNotation());
+		}
+	}
+}
+
+#endif //WITH_TESTS
@@ -5,6 +5,19 @@
 #include "MathUtil.h"
 #include "UTestData.h"
 #include "Tests/TestHarnessAdapter.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/FileHelper.h"
+#include "GameData/Formatters/TGameDataReader.h"
+#include "GameData/Formatters/FCompiledGameDataFormat.h"
+#include "GameData/Formatters/FCompiledGameDataWriter.h"
+#include "GameData/FGameDataCompiledCache.h"
+#include "GameData/FGameDataLoadStats.h"
+#include "GameData/TGameDataDenseDocumentMap.h"
+#include "GameData/TGameDataDocumentStore.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 
 TEST_CASE_NAMED(FGameDataTests, "Charon::TestGameData", "[Core]")
 {
@@ -92,6 +105,741 @@ TEST_CASE_NAMED(FGameDataTests, "Charon::TestGameData", "[Core]")
 		CHECK(TestEntity->DocumentField->IntegerFieldX64 == -9223372036854775807 - 1);
 	}
 
+	SECTION("Loading mapped files")
+	{
+		for (const TTuple<const TCHAR*, EGameDataFormat> GameDataFile : {
+			MakeTuple(TEXT("TestData.gdjs"), EGameDataFormat::Json),
+			MakeTuple(TEXT("TestData.gdmp"), EGameDataFormat::MessagePack) })
+		{
+			auto GameData = NewObject<UTestData>();
+
+			auto GameDataFilePath = FPaths::Combine(FPaths::ProjectContentDir(), GameDataFile.Key);
+
+			REQUIRE(GameData->TryLoadFile(GameDataFilePath, GameDataFile.Value));
+
+			CHECK(GameData->SupportedLanguages.Num() != 0);
+			CHECK(GameData->RevisionHash.Len() != 0);
+			CHECK(GameData->AllTestEntities.Num() == 3);
+			CHECK(GameData->AllRecursiveEntities.Num() == 6);
+			CHECK(GameData->AllNumberTestEntities.Num() == 4);
+			CHECK(GameData->AllUniqueAttributeEntities.Num() == 1);
+
+			const auto TestEntity = GameData->TestEntities.FindRef(ETestEntityId::TestEntity1);
+			REQUIRE(TestEntity != nullptr);
+			CHECK(TestEntity->IntegerFieldX64 == 9223372036854775807);
+		}
+
+		auto GameData = NewObject<UTestData>();
+		CHECK(!GameData->TryLoadFile(FPaths::Combine(FPaths::ProjectContentDir(), TEXT("NotExisting.gdjs")), EGameDataFormat::Json));
+	}
+
+	SECTION("Loading compiled")
+	{
+		for (const TTuple<const TCHAR*, EGameDataFormat> GameDataFile : {
+			MakeTuple(TEXT("TestData.gdjs"), EGameDataFormat::Json),
+			MakeTuple(TEXT("TestData.gdmp"), EGameDataFormat::MessagePack) })
+		{
+			TArray<uint8> Buffer;
+			REQUIRE(FFileHelper::LoadFileToArray(Buffer, *FPaths::Combine(FPaths::ProjectContentDir(), GameDataFile.Key)));
+
+			TArray<uint8> CompiledImage;
+			REQUIRE(FCompiledGameDataWriter::Compile(Buffer, GameDataFile.Value, CompiledImage));
+			CHECK(FCompiledGameDataWriter::IsCompiledFrom(CompiledImage, Buffer));
+
+			auto GameData = NewObject<UTestData>();
+			REQUIRE(GameData->TryLoad(TArrayView<const uint8>(CompiledImage), EGameDataFormat::Compiled));
+
+			CHECK(GameData->SupportedLanguages.Num() != 0);
+			CHECK(GameData->RevisionHash.Len() != 0);
+			CHECK(GameData->AllTestEntities.Num() == 3);
+			CHECK(GameData->AllRecursiveEntities.Num() == 6);
+			CHECK(GameData->AllNumberTestEntities.Num() == 4);
+			CHECK(GameData->AllUniqueAttributeEntities.Num() == 1);
+
+			const auto TestEntity = GameData->TestEntities.FindRef(ETestEntityId::TestEntity1);
+			REQUIRE(TestEntity != nullptr);
+			CHECK(TestEntity->NumberFieldX64 == 9007199254740992);
+			CHECK(TestEntity->IntegerFieldX64 == 9223372036854775807);
+			REQUIRE(TestEntity->DocumentField != nullptr);
+			CHECK(TestEntity->DocumentField->IntegerFieldX64 == -9223372036854775807 - 1);
+
+			// image of changed source is stale
+			TArray<uint8> ChangedBuffer = Buffer;
+			ChangedBuffer.Add(' ');
+			CHECK(!FCompiledGameDataWriter::IsCompiledFrom(CompiledImage, ChangedBuffer));
+
+			// image of other format version is rejected
+			TArray<uint8> OtherVersionImage = CompiledImage;
+			reinterpret_cast<FCompiledGameDataHeader*>(OtherVersionImage.GetData())->FormatVersion++;
+			CHECK(!FCompiledGameDataWriter::IsCompiledFrom(OtherVersionImage, Buffer));
+			CHECK(!NewObject<UTestData>()->TryLoad(TArrayView<const uint8>(OtherVersionImage), EGameDataFormat::Compiled));
+
+			// image with broken container token is rejected instead of jumping to wrong token
+			const FCompiledGameDataHeader& Header = *reinterpret_cast<const FCompiledGameDataHeader*>(CompiledImage.GetData());
+			const int64 RootTokenOffset = static_cast<int64>(Header.TokenTableOffset);
+			for (const TFunction<void(FCompiledGameDataToken&)> Corrupt : {
+				TFunction<void(FCompiledGameDataToken&)>([](FCompiledGameDataToken& RootToken) { RootToken.ValueType = static_cast<uint8>(ECompiledGameDataValueType::Int64); }),
+				TFunction<void(FCompiledGameDataToken&)>([](FCompiledGameDataToken& RootToken) { RootToken.Value = 0; }),
+				TFunction<void(FCompiledGameDataToken&)>([](FCompiledGameDataToken& RootToken) { RootToken.Value = MAX_uint64; }),
+				TFunction<void(FCompiledGameDataToken&)>([](FCompiledGameDataToken& RootToken) { RootToken.Value = 1; /* first member, not ObjectEnd */ }) })
+			{
+				TArray<uint8> CorruptedImage = CompiledImage;
+				Corrupt(*reinterpret_cast<FCompiledGameDataToken*>(CorruptedImage.GetData() + RootTokenOffset));
+				CHECK(!NewObject<UTestData>()->TryLoad(TArrayView<const uint8>(CorruptedImage), EGameDataFormat::Compiled));
+			}
+		}
+
+		// stale image next to source file is ignored on load and is not overwritten
+		const FString GameDataFilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Tests"), TEXT("TestData.gdjs"));
+		const FString CompiledFilePath = FCompiledGameDataWriter::GetCompiledFilePath(GameDataFilePath);
+		REQUIRE(IFileManager::Get().Copy(*GameDataFilePath, *FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"))) == COPY_OK);
+		REQUIRE(FFileHelper::SaveStringToFile(TEXT("stale"), *CompiledFilePath));
+
+		auto GameData = NewObject<UTestData>();
+		REQUIRE(GameData->TryLoadCompiledFile(GameDataFilePath, EGameDataFormat::Json));
+		CHECK(GameData->AllTestEntities.Num() == 3);
+
+		TArray<uint8> Buffer;
+		TArray<uint8> CompiledImage;
+		REQUIRE(FFileHelper::LoadFileToArray(Buffer, *GameDataFilePath));
+		REQUIRE(FFileHelper::LoadFileToArray(CompiledImage, *CompiledFilePath));
+		CHECK(!FCompiledGameDataWriter::IsCompiledFromRevision(CompiledImage, Buffer, EGameDataFormat::Json));
+
+		// image compiled by import is matched to source by RevisionHash
+		REQUIRE(FCompiledGameDataWriter::CompileFile(GameDataFilePath, Buffer, EGameDataFormat::Json, CompiledImage));
+		CHECK(FCompiledGameDataWriter::IsCompiledFromRevision(CompiledImage, Buffer, EGameDataFormat::Json));
+		REQUIRE(NewObject<UTestData>()->TryLoadCompiledFile(GameDataFilePath, EGameDataFormat::Json));
+
+		// up-to-date image is loaded even without source file
+		IFileManager::Get().Delete(*GameDataFilePath);
+		REQUIRE(NewObject<UTestData>()->TryLoadCompiledFile(GameDataFilePath, EGameDataFormat::Json));
+		IFileManager::Get().Delete(*CompiledFilePath);
+	}
+
+	SECTION("Loading with compiled cache")
+	{
+		FGameDataCompiledCache::SetEnabled(true);
+		for (const TTuple<const TCHAR*, EGameDataFormat> GameDataFile : {
+			MakeTuple(TEXT("TestData.gdjs"), EGameDataFormat::Json),
+			MakeTuple(TEXT("TestData.gdmp"), EGameDataFormat::MessagePack) })
+		{
+			auto GameDataFilePath = FPaths::Combine(FPaths::ProjectContentDir(), GameDataFile.Key);
+			TArray<uint8> Buffer;
+			REQUIRE(FFileHelper::LoadFileToArray(Buffer, *GameDataFilePath));
+
+			FString CacheKey;
+			REQUIRE(FGameDataCompiledCache::GetCacheKey(Buffer, GameDataFile.Value, UTestData::GeneratorVersion, CacheKey));
+			const FString CacheFilePath = FGameDataCompiledCache::GetCacheFilePath(CacheKey);
+			IFileManager::Get().Delete(*CacheFilePath);
+
+			// first load is a miss and writes entry, second one is a hit
+			for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+			{
+				auto GameData = NewObject<UTestData>();
+				REQUIRE(GameData->TryLoadFile(GameDataFilePath, GameDataFile.Value));
+				CHECK(IFileManager::Get().FileExists(*CacheFilePath));
+
+				CHECK(GameData->RevisionHash.Len() != 0);
+				CHECK(GameData->AllTestEntities.Num() == 3);
+				CHECK(GameData->AllRecursiveEntities.Num() == 6);
+				const auto TestEntity = GameData->TestEntities.FindRef(ETestEntityId::TestEntity1);
+				REQUIRE(TestEntity != nullptr);
+				CHECK(TestEntity->IntegerFieldX64 == 9223372036854775807);
+			}
+
+			FGameDataMappedFile CacheFile;
+			TArrayView<const uint8> CompiledImage;
+			double SourceLoadSeconds = 0;
+			CHECK(FGameDataCompiledCache::TryOpen(CacheKey, CacheFile, CompiledImage, SourceLoadSeconds));
+			CHECK(SourceLoadSeconds > 0);
+		}
+		FGameDataCompiledCache::SetEnabled(false);
+	}
+
+	SECTION("Loading lazily")
+	{
+		for (const TTuple<const TCHAR*, EGameDataFormat> GameDataFile : {
+			MakeTuple(TEXT("TestData.gdjs"), EGameDataFormat::Json),
+			MakeTuple(TEXT("TestData.gdmp"), EGameDataFormat::MessagePack) })
+		{
+			TArray<uint8> Buffer;
+			REQUIRE(FFileHelper::LoadFileToArray(Buffer, *FPaths::Combine(FPaths::ProjectContentDir(), GameDataFile.Key)));
+			TArray<uint8> CompiledImage;
+			REQUIRE(FCompiledGameDataWriter::Compile(Buffer, GameDataFile.Value, CompiledImage));
+
+			for (const TTuple<TArray<uint8>*, EGameDataFormat> Source : {
+				MakeTuple(&Buffer, GameDataFile.Value),
+				MakeTuple(&CompiledImage, EGameDataFormat::Compiled) })
+			{
+				auto Options = FGameDataLoadOptions();
+				Options.Format = Source.Value;
+				Options.LazyDocuments = true;
+
+				auto GameData = NewObject<UTestData>();
+				{
+					// documents are created from game data's own copy of buffer
+					const TArray<uint8> SourceBuffer = *Source.Key;
+					REQUIRE(GameData->TryLoad(TArrayView<const uint8>(SourceBuffer), Options));
+				}
+
+				CHECK(GameData->RevisionHash.Len() != 0);
+				CHECK(GameData->SupportedLanguages.Num() != 0);
+				CHECK(GameData->ProjectSettings != nullptr);
+				CHECK(GameData->TestEntities.Num() == 0);
+				CHECK(GameData->AllTestEntities.Num() == 0);
+
+				TArray<FString> TestEntityIds;
+				GameData->GetDocumentIds(TEXT("TestEntity"), TestEntityIds);
+				CHECK(TestEntityIds.Contains(ETestEntityId::TestEntity1));
+
+				// unknown document is not found and no documents are created to look for it
+				CHECK(GameData->FindGameDataDocumentById(TEXT("TestEntity"), TEXT("UnknownTestEntity")) == nullptr);
+				CHECK(GameData->AllTestEntities.Num() == 0);
+
+				// embedded document is found by creating only root document which embeds it
+				const auto EmbeddedTestEntity = Cast<UTestEntity>(GameData->FindGameDataDocumentById(TEXT("TestEntity"), ETestEntityId::TestEntity2));
+				REQUIRE(EmbeddedTestEntity != nullptr);
+				CHECK(GameData->TestEntities.Num() == 1);
+				CHECK(GameData->AllRecursiveEntities.Num() == 0);
+
+				// root document is created on first access with its embedded documents
+				const auto TestEntity = Cast<UTestEntity>(GameData->FindGameDataDocumentById(TEXT("TestEntity"), ETestEntityId::TestEntity1));
+				REQUIRE(TestEntity != nullptr);
+				CHECK(GameData->FindGameDataDocumentById(TEXT("TestEntity"), ETestEntityId::TestEntity1) == TestEntity);
+				CHECK(GameData->TestEntities.FindRef(ETestEntityId::TestEntity1) == TestEntity);
+				CHECK(GameData->AllTestEntities.Num() > 1);
+				CHECK(GameData->AllRecursiveEntities.Num() == 0);
+				CHECK(TestEntity->IntegerFieldX64 == 9223372036854775807);
+				REQUIRE(TestEntity->DocumentField != nullptr);
+				CHECK(TestEntity->DocumentField->IntegerFieldX64 == -9223372036854775807 - 1);
+
+				GameData->LoadAllDocuments();
+				CHECK(GameData->AllTestEntities.Num() == 3);
+				CHECK(GameData->AllRecursiveEntities.Num() == 6);
+				CHECK(GameData->AllNumberTestEntities.Num() == 4);
+				CHECK(GameData->AllUniqueAttributeEntities.Num() == 1);
+				CHECK(GameData->TestEntities.FindRef(ETestEntityId::TestEntity1) == TestEntity);
+			}
+		}
+	}
+
+	SECTION("Finding documents by id")
+	{
+		auto GameData = NewObject<UTestData>();
+
+		auto GameDataFilePath = FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"));
+		const TUniquePtr<FArchive> GameDataStream(IFileManager::Get().CreateFileReader(*GameDataFilePath, 0));
+		REQUIRE(GameData->TryLoad(GameDataStream.Get(), EGameDataFormat::Json));
+
+		const auto TestEntity = GameData->TestEntities.FindRef(ETestEntityId::TestEntity1);
+		REQUIRE(TestEntity != nullptr);
+
+		// schema could be referenced by name in any case or by id
+		CHECK(GameData->FindGameDataDocumentById(TEXT("TestEntity"), ETestEntityId::TestEntity1) == TestEntity);
+		CHECK(GameData->FindGameDataDocumentById(TEXT("testentity"), ETestEntityId::TestEntity1) == TestEntity);
+		CHECK(GameData->FindGameDataDocumentById(TEXT("592fc86c983a36266c0912a0"), ETestEntityId::TestEntity1) == TestEntity);
+		CHECK(GameData->FindGameDataDocumentById(TEXT("UnknownSchema"), ETestEntityId::TestEntity1) == nullptr);
+		CHECK(GameData->FindDocumentSchemaClass(TEXT("592fc86c983a36266c0912a0")) == UTestEntity::StaticClass());
+
+		TArray<int32> NumberTestEntityIds;
+		GameData->AllNumberTestEntities.GetKeys(NumberTestEntityIds);
+		REQUIRE(NumberTestEntityIds.Num() != 0);
+
+		const TArray<TPair<FString, FString>> SchemaNameAndDocumentIds = {
+			TPair<FString, FString>(TEXT("TestEntity"), ETestEntityId::TestEntity1),
+			TPair<FString, FString>(TEXT("TestEntity"), TEXT("MissingId")),
+			TPair<FString, FString>(TEXT("NumberTestEntity"), FString::FromInt(NumberTestEntityIds[0])),
+			TPair<FString, FString>(TEXT("UnknownSchema"), ETestEntityId::TestEntity1),
+		};
+		TArray<UGameDataDocument*> FoundDocuments;
+		GameData->FindGameDataDocumentsById(SchemaNameAndDocumentIds, FoundDocuments);
+		REQUIRE(FoundDocuments.Num() == SchemaNameAndDocumentIds.Num());
+		CHECK(FoundDocuments[0] == TestEntity);
+		CHECK(FoundDocuments[1] == nullptr);
+		CHECK(FoundDocuments[2] == GameData->AllNumberTestEntities.FindRef(NumberTestEntityIds[0]));
+		CHECK(FoundDocuments[3] == nullptr);
+	}
+
+	SECTION("Resolving references on load")
+	{
+		TArray<uint8> Buffer;
+		REQUIRE(FFileHelper::LoadFileToArray(Buffer, *FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"))));
+
+		FGameDataLoadStats LoadStats;
+		auto Options = FGameDataLoadOptions();
+		Options.Format = EGameDataFormat::Json;
+		Options.Stats = &LoadStats;
+
+		auto GameData = NewObject<UTestData>();
+		REQUIRE(GameData->TryLoad(TArrayView<const uint8>(Buffer), Options));
+		const uint32 FirstLoadGeneration = GameData->GetLoadGeneration();
+		CHECK(FirstLoadGeneration != 0);
+		CHECK(LoadStats.UnresolvedReferences == 0);
+
+		for (const auto& TestEntityById : GameData->AllTestEntities)
+		{
+			const FGameDataDocumentReference& Reference = TestEntityById.Value->ReferenceFieldRaw;
+			if (!Reference.IsValid())
+			{
+				continue;
+			}
+			// references are linked by load, so cached document is used without lookup
+			CHECK(Reference.IsActual());
+			CHECK(Reference.GetReferencedDocument() == GameData->FindGameDataDocumentById(Reference.SchemaIdOrName, Reference.Id));
+		}
+
+		REQUIRE(GameData->TryLoad(TArrayView<const uint8>(Buffer), Options));
+		CHECK(GameData->GetLoadGeneration() != FirstLoadGeneration);
+	}
+
+	SECTION("Reading reference collections")
+	{
+		auto GameData = NewObject<UTestData>();
+
+		auto GameDataFilePath = FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"));
+		const TUniquePtr<FArchive> GameDataStream(IFileManager::Get().CreateFileReader(*GameDataFilePath, 0));
+		REQUIRE(GameData->TryLoad(GameDataStream.Get(), EGameDataFormat::Json));
+
+		for (const auto& TestEntityById : GameData->AllTestEntities)
+		{
+			const UTestEntity* TestEntity = TestEntityById.Value;
+			const auto& ReferencedDocuments = TestEntity->GetListOfReferencesFieldView();
+
+			// collection is built once per load and then returned as is
+			CHECK(&TestEntity->GetListOfReferencesFieldView() == &ReferencedDocuments);
+			CHECK(TestEntity->GetListOfReferencesField().Num() == ReferencedDocuments.Num());
+
+			int32 ReferencedDocumentCount = 0;
+			TestEntity->ForEachListOfReferencesField([&](UTestEntity* ReferencedDocument)
+			{
+				CHECK(ReferencedDocuments.FindRef(ReferencedDocument->Id) == ReferencedDocument);
+				ReferencedDocumentCount++;
+			});
+			CHECK(ReferencedDocumentCount == ReferencedDocuments.Num());
+		}
+	}
+
+	SECTION("Finding referrers")
+	{
+		TArray<uint8> Buffer;
+		REQUIRE(FFileHelper::LoadFileToArray(Buffer, *FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"))));
+
+		FGameDataLoadStats LoadStats;
+		auto Options = FGameDataLoadOptions();
+		Options.Format = EGameDataFormat::Json;
+		Options.Stats = &LoadStats;
+		Options.BuildReferrersIndex = true;
+
+		auto GameData = NewObject<UTestData>();
+		REQUIRE(GameData->TryLoad(TArrayView<const uint8>(Buffer), Options));
+
+		int32 ReferenceCount = 0;
+		for (const auto& TestEntityById : GameData->AllTestEntities)
+		{
+			UTestEntity* TestEntity = TestEntityById.Value;
+			const UGameDataDocument* ReferencedDocument = TestEntity->ReferenceFieldRaw.GetReferencedDocument();
+			if (ReferencedDocument == nullptr)
+			{
+				continue;
+			}
+			ReferenceCount++;
+
+			const auto Referrers = GameData->GetReferrersView(ReferencedDocument);
+			CHECK(Referrers.ContainsByPredicate([TestEntity](const FGameDataDocumentReferrer& Referrer)
+			{
+				return Referrer.Document == TestEntity && Referrer.PropertyName == TEXT("ReferenceField");
+			}));
+		}
+		if (ReferenceCount > 0)
+		{
+			CHECK(LoadStats.ReferrersIndexBytes > 0);
+		}
+
+		// index is not built unless requested
+		Options.BuildReferrersIndex = false;
+		REQUIRE(GameData->TryLoad(TArrayView<const uint8>(Buffer), Options));
+		for (const auto& TestEntityById : GameData->AllTestEntities)
+		{
+			CHECK(GameData->GetReferrers(TestEntityById.Value).Num() == 0);
+		}
+	}
+
+	SECTION("Querying document indexes")
+	{
+		TArray<uint8> Buffer;
+		REQUIRE(FFileHelper::LoadFileToArray(Buffer, *FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"))));
+
+		const auto DeclareIndex = [](const FName PropertyName, const EGameDataDocumentIndexType Type)
+		{
+			FGameDataDocumentIndexDeclaration IndexDeclaration;
+			IndexDeclaration.SchemaName = TEXT("TestEntity");
+			IndexDeclaration.PropertyName = PropertyName;
+			IndexDeclaration.Type = Type;
+			return IndexDeclaration;
+		};
+
+		FGameDataLoadStats LoadStats;
+		auto Options = FGameDataLoadOptions();
+		Options.Format = EGameDataFormat::Json;
+		Options.Stats = &LoadStats;
+		Options.DocumentIndexes.Add(DeclareIndex(TEXT("TextField"), EGameDataDocumentIndexType::Hash));
+		Options.DocumentIndexes.Add(DeclareIndex(TEXT("PickListField"), EGameDataDocumentIndexType::Hash));
+		Options.DocumentIndexes.Add(DeclareIndex(TEXT("IntegerField"), EGameDataDocumentIndexType::Sorted));
+		Options.DocumentIndexes.Add(DeclareIndex(TEXT("IntegerFieldX64"), EGameDataDocumentIndexType::Sorted));
+		Options.DocumentIndexes.Add(DeclareIndex(TEXT("LocalizedTextField"), EGameDataDocumentIndexType::Hash));
+
+		auto GameData = NewObject<UTestData>();
+		REQUIRE(GameData->TryLoad(TArrayView<const uint8>(Buffer), Options));
+		CHECK(LoadStats.DocumentIndexesBytes > 0);
+
+		int32 TestEntityCount = 0;
+		for (const UGameDataDocument* Document : GameData->GetAllDocuments())
+		{
+			const UTestEntity* TestEntity = Cast<UTestEntity>(Document);
+			if (TestEntity == nullptr)
+			{
+				continue;
+			}
+			TestEntityCount++;
+
+			CHECK(GameData->FindDocumentsByIndexView(TEXT("TestEntity"), TEXT("TextField"), TestEntity->TextField).Contains(TestEntity));
+			CHECK(GameData->FindDocumentsByIndexView(TEXT("TestEntity"), TEXT("PickListField"), static_cast<int64>(TestEntity->PickListField)).Contains(TestEntity));
+			CHECK(GameData->FindDocumentsInRangeView(TEXT("TestEntity"), TEXT("IntegerField"), TestEntity->IntegerField, TestEntity->IntegerField).Contains(TestEntity));
+			CHECK(GameData->FindDocumentsInIntegerRangeView(TEXT("TestEntity"), TEXT("IntegerFieldX64"), TestEntity->IntegerFieldX64, TestEntity->IntegerFieldX64).Contains(TestEntity));
+
+			// localized texts are indexed by primary language text
+			FText PrimaryLanguageText;
+			if (TestEntity->LocalizedTextFieldRaw.TryGetText(TEXT("ru-RU"), PrimaryLanguageText))
+			{
+				CHECK(GameData->FindDocumentsByIndexView(TEXT("TestEntity"), TEXT("LocalizedTextField"), PrimaryLanguageText.ToString()).Contains(TestEntity));
+			}
+		}
+
+		// int64 keys are not rounded to double
+		CHECK(GameData->FindDocumentsInIntegerRangeView(TEXT("TestEntity"), TEXT("IntegerFieldX64"), MAX_int64, MAX_int64).Num() == 1);
+		CHECK(GameData->FindDocumentsInIntegerRangeView(TEXT("TestEntity"), TEXT("IntegerFieldX64"), MAX_int64 - 1, MAX_int64 - 1).Num() == 0);
+		CHECK(GameData->FindDocumentsInIntegerRangeView(TEXT("TestEntity"), TEXT("IntegerFieldX64"), MIN_int64, MIN_int64).Num() == 1);
+
+		const auto AllByIntegerField = GameData->FindDocumentsInRangeView(TEXT("TestEntity"), TEXT("IntegerField"), TNumericLimits<double>::Lowest(), TNumericLimits<double>::Max());
+		CHECK(AllByIntegerField.Num() == TestEntityCount);
+		for (int32 Index = 1; Index < AllByIntegerField.Num(); Index++)
+		{
+			CHECK(CastChecked<UTestEntity>(AllByIntegerField[Index - 1])->IntegerField <= CastChecked<UTestEntity>(AllByIntegerField[Index])->IntegerField);
+		}
+
+		// only declared indexes could be queried
+		CHECK(GameData->FindDocumentsByIndexView(TEXT("TestEntity"), TEXT("IntegerField"), static_cast<int64>(0)).Num() == 0);
+		CHECK(GameData->FindDocumentsInRange(TEXT("TestEntity"), TEXT("TextField"), 0, 1).Num() == 0);
+	}
+
+	SECTION("Loading selected languages")
+	{
+		TArray<uint8> Buffer;
+		REQUIRE(FFileHelper::LoadFileToArray(Buffer, *FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdmp"))));
+
+		auto Options = FGameDataLoadOptions();
+		Options.Format = EGameDataFormat::MessagePack;
+		Options.Languages = { TEXT("fr-FR") };
+
+		auto GameData = NewObject<UTestData>();
+		REQUIRE(GameData->TryLoad(TArrayView<const uint8>(Buffer), Options));
+
+		CHECK(GameData->SupportedLanguages == TArray<FString>({ TEXT("fr-FR") }));
+
+		const auto TestEntity = GameData->TestEntities.FindRef(ETestEntityId::TestEntity1);
+		REQUIRE(TestEntity != nullptr);
+		TArray<FString> LanguageIds;
+		TestEntity->LocalizedTextFieldRaw.TextByLanguageId.GetKeys(LanguageIds);
+		for (const FString& LanguageId : LanguageIds)
+		{
+			CHECK(LanguageId == TEXT("fr-FR"));
+		}
+
+		// same options are applied to mapped file
+		auto MappedGameData = NewObject<UTestData>();
+		REQUIRE(MappedGameData->TryLoadFile(FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdmp")), Options));
+		CHECK(MappedGameData->SupportedLanguages == TArray<FString>({ TEXT("fr-FR") }));
+		CHECK(MappedGameData->AllTestEntities.Num() == 3);
+	}
+
+	SECTION("Switching language")
+	{
+		auto GameData = NewObject<UTestData>();
+
+		auto GameDataFilePath = FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"));
+		const TUniquePtr<FArchive> GameDataStream(IFileManager::Get().CreateFileReader(*GameDataFilePath, 0));
+		REQUIRE(GameData->TryLoad(GameDataStream.Get(), EGameDataFormat::Json));
+
+		const auto TestEntity = GameData->TestEntities.FindRef(ETestEntityId::TestEntity1);
+		REQUIRE(TestEntity != nullptr);
+
+		for (const TCHAR* LanguageId : { TEXT("en-US"), TEXT("fr-FR"), TEXT("en-US") })
+		{
+			GameData->SetLanguage(LanguageId, LanguageId, ELocalizedTextFallbackOption::OnNotDefined);
+
+			// cached value is replaced on language switch and equals to text of current language
+			FText ExpectedText;
+			if (!TestEntity->LocalizedTextFieldRaw.TryGetText(LanguageId, ExpectedText))
+			{
+				continue;
+			}
+			CHECK(TestEntity->GetLocalizedTextField().EqualTo(ExpectedText));
+			CHECK(TestEntity->GetLocalizedTextField().EqualTo(ExpectedText));
+		}
+	}
+
+	SECTION("Pooling localized texts")
+	{
+		TArray<uint8> Buffer;
+		REQUIRE(FFileHelper::LoadFileToArray(Buffer, *FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"))));
+
+		auto Options = FGameDataLoadOptions();
+		Options.Format = EGameDataFormat::Json;
+		auto GameData = NewObject<UTestData>();
+		REQUIRE(GameData->TryLoad(TArrayView<const uint8>(Buffer), Options));
+
+		Options.PoolLocalizedTexts = true;
+		auto PooledGameData = NewObject<UTestData>();
+		REQUIRE(PooledGameData->TryLoad(TArrayView<const uint8>(Buffer), Options));
+
+		const auto TestEntity = GameData->TestEntities.FindRef(ETestEntityId::TestEntity1);
+		const auto PooledTestEntity = PooledGameData->TestEntities.FindRef(ETestEntityId::TestEntity1);
+		REQUIRE(TestEntity != nullptr);
+		REQUIRE(PooledTestEntity != nullptr);
+		CHECK(PooledTestEntity->LocalizedTextFieldRaw.TextByLanguageId.Num() == 0);
+
+		for (const TCHAR* LanguageId : { TEXT("en-US"), TEXT("fr-FR") })
+		{
+			GameData->SetLanguage(LanguageId, LanguageId, ELocalizedTextFallbackOption::OnNotDefined);
+			PooledGameData->SetLanguage(LanguageId, LanguageId, ELocalizedTextFallbackOption::OnNotDefined);
+			CHECK(PooledTestEntity->GetLocalizedTextField().EqualTo(TestEntity->GetLocalizedTextField()));
+
+			FText Text;
+			FText PooledText;
+			CHECK(PooledTestEntity->LocalizedTextFieldRaw.TryGetText(LanguageId, PooledText) == TestEntity->LocalizedTextFieldRaw.TryGetText(LanguageId, Text));
+			CHECK(PooledText.EqualTo(Text));
+		}
+
+		PooledGameData->SetSupportedLanguages({ TEXT("en-US") });
+		FText RemovedText;
+		CHECK(!PooledTestEntity->LocalizedTextFieldRaw.TryGetText(TEXT("fr-FR"), RemovedText));
+	}
+
+	SECTION("Storing documents once per schema")
+	{
+		auto GameData = NewObject<UTestData>();
+
+		auto GameDataFilePath = FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"));
+		const TUniquePtr<FArchive> GameDataStream(IFileManager::Get().CreateFileReader(*GameDataFilePath, 0));
+		REQUIRE(GameData->TryLoad(GameDataStream.Get(), EGameDataFormat::Json));
+
+		// All* and root maps stay Blueprint-visible and are filled by one store
+		const FProperty* AllTestEntitiesProperty = UTestData::StaticClass()->FindPropertyByName(TEXT("AllTestEntities"));
+		REQUIRE(AllTestEntitiesProperty != nullptr);
+		CHECK(AllTestEntitiesProperty->HasAnyPropertyFlags(CPF_BlueprintVisible));
+		for (const auto DocumentById : GameData->AllRecursiveEntities)
+		{
+			CHECK(GameData->RecursiveEntities.Contains(DocumentById.Key) == (DocumentById.Value->GetOuter() == GameData));
+		}
+		CHECK(GameData->AllTestEntities.FindRef(ETestEntityId::TestEntity1) == GameData->TestEntities.FindRef(ETestEntityId::TestEntity1));
+
+		// finding documents again doesn't duplicate them
+		const int32 AllTestEntityCount = GameData->AllTestEntities.Num();
+		const int32 AllRecursiveEntityCount = GameData->AllRecursiveEntities.Num();
+		GameData->FindAllDocuments();
+		CHECK(GameData->AllTestEntities.Num() == AllTestEntityCount);
+		CHECK(GameData->AllRecursiveEntities.Num() == AllRecursiveEntityCount);
+	}
+
+	SECTION("Document store")
+	{
+		const auto RootDocument = NewObject<UTestEntity>();
+		const auto EmbeddedDocument = NewObject<UTestEntity>();
+		const auto DuplicateDocument = NewObject<UTestEntity>();
+		RootDocument->Id = TEXT("Root");
+		EmbeddedDocument->Id = TEXT("Embedded");
+		DuplicateDocument->Id = TEXT("Root");
+
+		TMap<FString, UTestEntity*> AllDocuments;
+		TMap<FString, UTestEntity*> RootDocuments;
+		TGameDataDocumentStore<FString, UTestEntity> Store(AllDocuments, RootDocuments);
+		CHECK(Store.Add(EmbeddedDocument, /* bIsRoot */ false));
+		CHECK(Store.Add(RootDocument, /* bIsRoot */ true));
+		CHECK(Store.Add(RootDocument, /* bIsRoot */ false)); // found again while visiting all documents
+		CHECK(!Store.Add(DuplicateDocument, /* bIsRoot */ true));
+
+		CHECK(AllDocuments.Num() == 2);
+		CHECK(RootDocuments.Num() == 1);
+		CHECK(AllDocuments.FindRef(TEXT("Embedded")) == EmbeddedDocument);
+		CHECK(RootDocuments.FindRef(TEXT("Embedded")) == nullptr);
+		CHECK(RootDocuments.FindRef(TEXT("Root")) == RootDocument);
+		TArray<UTestEntity*> StoredRootDocuments;
+		Store.AppendTo(StoredRootDocuments, /* bRootOnly */ true);
+		CHECK(StoredRootDocuments == TArray<UTestEntity*>({ RootDocument }));
+
+		// documents and root flags survive serialization, ids are restored from documents
+		TArray<uint8> Bytes;
+		FMemoryWriter BytesWriter(Bytes);
+		FObjectAndNameAsStringProxyArchive Writer(BytesWriter, /* bInLoadIfFindFails */ false);
+		Store.Serialize(Writer);
+
+		TMap<FString, UTestEntity*> LoadedAllDocuments;
+		TMap<FString, UTestEntity*> LoadedRootDocuments;
+		TGameDataDocumentStore<FString, UTestEntity> LoadedStore(LoadedAllDocuments, LoadedRootDocuments);
+		FMemoryReader BytesReader(Bytes);
+		FObjectAndNameAsStringProxyArchive Reader(BytesReader, /* bInLoadIfFindFails */ false);
+		LoadedStore.Serialize(Reader);
+		LoadedStore.RebuildIdMaps();
+		CHECK(!Reader.IsError());
+		CHECK(LoadedAllDocuments.FindRef(TEXT("Embedded")) == EmbeddedDocument);
+		CHECK(LoadedRootDocuments.FindRef(TEXT("Root")) == RootDocument);
+		CHECK(LoadedStore.NumRoots() == 1);
+
+		// maps are kept out of saved asset and are put back after saving
+		Store.DetachIdMaps();
+		CHECK(AllDocuments.IsEmpty());
+		CHECK(RootDocuments.IsEmpty());
+		Store.AttachIdMaps();
+		CHECK(AllDocuments.Num() == 2);
+		CHECK(RootDocuments.Num() == 1);
+
+		// assets saved before document stores have only maps, documents are moved from them into store
+		TMap<FString, UTestEntity*> LegacyAllDocuments = { { TEXT("Embedded"), EmbeddedDocument }, { TEXT("Root"), RootDocument } };
+		TMap<FString, UTestEntity*> LegacyRootDocuments = { { TEXT("Root"), RootDocument } };
+		TGameDataDocumentStore<FString, UTestEntity> LegacyStore(LegacyAllDocuments, LegacyRootDocuments);
+		LegacyStore.RebuildFromIdMaps();
+		CHECK(LegacyStore.Num() == 2);
+		CHECK(LegacyStore.NumRoots() == 1);
+		CHECK(LegacyStore.IsRoot(0));
+		CHECK(LegacyAllDocuments.FindRef(TEXT("Embedded")) == EmbeddedDocument);
+
+		Store.Reset();
+		CHECK(AllDocuments.IsEmpty());
+		CHECK(Store.FindRef(TEXT("Root")) == nullptr);
+	}
+
+	SECTION("Dense document map")
+	{
+		const auto FirstDocument = NewObject<UTestEntity>();
+		const auto SecondDocument = NewObject<UTestEntity>();
+		TMap<ENumberTestEntityPickList8Bit, UTestEntity*> DocumentsById;
+		DocumentsById.Add(ENumberTestEntityPickList8Bit::Two, FirstDocument);
+		DocumentsById.Add(ENumberTestEntityPickList8Bit::Five, SecondDocument);
+
+		TGameDataDenseDocumentMap<ENumberTestEntityPickList8Bit, UTestEntity> DenseDocuments;
+		DenseDocuments.Build(DocumentsById);
+
+		CHECK(DenseDocuments.Num() == 2);
+		CHECK(DenseDocuments.FindRef(ENumberTestEntityPickList8Bit::Two) == FirstDocument);
+		CHECK(DenseDocuments.FindRef(ENumberTestEntityPickList8Bit::Five) == SecondDocument);
+		CHECK(DenseDocuments.FindRef(ENumberTestEntityPickList8Bit::One) == nullptr);
+		CHECK(!DenseDocuments.Contains(ENumberTestEntityPickList8Bit::None));
+		CHECK(!DenseDocuments.Contains(static_cast<ENumberTestEntityPickList8Bit>(200))); // out of bounds
+
+		DenseDocuments.Reset();
+		CHECK(DenseDocuments.IsEmpty());
+		CHECK(DenseDocuments.FindRef(ENumberTestEntityPickList8Bit::Two) == nullptr);
+	}
+
+	SECTION("Loading stats")
+	{
+		TArray<uint8> Buffer;
+		REQUIRE(FFileHelper::LoadFileToArray(Buffer, *FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"))));
+
+		FGameDataLoadStats LoadStats;
+		auto Options = FGameDataLoadOptions();
+		Options.Format = EGameDataFormat::Json;
+		Options.Stats = &LoadStats;
+
+		auto GameData = NewObject<UTestData>();
+		REQUIRE(GameData->TryLoad(TArrayView<const uint8>(Buffer), Options));
+
+		CHECK(LoadStats.IsSucceeded);
+		CHECK(LoadStats.TotalSeconds > 0);
+		CHECK(LoadStats.ParseSeconds <= LoadStats.TotalSeconds);
+		CHECK(LoadStats.GetTotalBytes() > 0);
+		CHECK(LoadStats.GetTotalDocuments() == GameData->GetAllDocuments().Num());
+
+		const FGameDataCollectionLoadStats* TestEntityStats = LoadStats.Collections.FindByPredicate([](const FGameDataCollectionLoadStats& CollectionStats)
+		{
+			return CollectionStats.Name == TEXT("TestEntity");
+		});
+		REQUIRE(TestEntityStats != nullptr);
+		CHECK(TestEntityStats->Documents >= GameData->AllTestEntities.Num());
+		CHECK(TestEntityStats->Allocations >= TestEntityStats->Documents);
+
+		// last load is kept for 'Charon.DumpLoadStats' console command
+		CHECK(FGameDataLoadStats::GetLastLoadStats().GameDataName == GameData->GetName());
+		CHECK(FGameDataLoadStats::GetLastLoadStats().ToTable().Contains(TEXT("TestEntity")));
+	}
+
+	SECTION("Loading asynchronously")
+	{
+		for (const TTuple<const TCHAR*, EGameDataFormat> GameDataFile : {
+			MakeTuple(TEXT("TestData.gdjs"), EGameDataFormat::Json),
+			MakeTuple(TEXT("TestData.gdmp"), EGameDataFormat::MessagePack) })
+		{
+			auto GameData = NewObject<UTestData>();
+
+			auto GameDataFilePath = FPaths::Combine(FPaths::ProjectContentDir(), GameDataFile.Key);
+
+			float LastProgress = 0.0f;
+			TFuture<bool> LoadFuture = GameData->TryLoadAsync(GameDataFilePath, GameDataFile.Value, [&LastProgress](const float Progress)
+			{
+				LastProgress = Progress;
+			});
+			while (!LoadFuture.IsReady())
+			{
+				FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			}
+
+			REQUIRE(LoadFuture.Get());
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread); // flush progress notifications
+
+			CHECK(LastProgress == 1.0f);
+			CHECK(GameData->SupportedLanguages.Num() != 0);
+			CHECK(GameData->RevisionHash.Len() != 0);
+			CHECK(GameData->AllTestEntities.Num() == 3);
+			CHECK(GameData->AllRecursiveEntities.Num() == 6);
+			CHECK(GameData->AllNumberTestEntities.Num() == 4);
+			CHECK(GameData->AllUniqueAttributeEntities.Num() == 1);
+
+			const auto TestEntity = GameData->TestEntities.FindRef(ETestEntityId::TestEntity1);
+			REQUIRE(TestEntity != nullptr);
+			CHECK(TestEntity->IntegerFieldX64 == 9223372036854775807);
+		}
+
+		{
+			auto Options = FGameDataLoadOptions();
+			Options.Format = EGameDataFormat::Json;
+			Options.LazyDocuments = true;
+
+			// overlapping load is rejected without affecting load in progress
+			auto GameData = NewObject<UTestData>();
+			const auto GameDataFilePath = FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"));
+			TFuture<bool> LoadFuture = GameData->TryLoadAsync(GameDataFilePath, Options);
+			TFuture<bool> OverlappingLoadFuture = GameData->TryLoadAsync(GameDataFilePath, Options);
+			REQUIRE(OverlappingLoadFuture.IsReady());
+			CHECK(!OverlappingLoadFuture.Get());
+			while (!LoadFuture.IsReady())
+			{
+				FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			}
+
+			REQUIRE(LoadFuture.Get());
+			CHECK(GameData->AllTestEntities.Num() == 0);
+			CHECK(GameData->FindGameDataDocumentById(TEXT("TestEntity"), ETestEntityId::TestEntity1) != nullptr);
+		}
+
+		auto GameData = NewObject<UTestData>();
+		TFuture<bool> LoadFuture = GameData->TryLoadAsync(FPaths::Combine(FPaths::ProjectContentDir(), TEXT("NotExisting.gdjs")), EGameDataFormat::Json);
+		while (!LoadFuture.IsReady())
+		{
+			FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		}
+		CHECK(!LoadFuture.Get());
+	}
+
 	SECTION("Patching JSON")
 	{
 		auto GameData = NewObject<UTestData>();
@@ -145,6 +893,89 @@ TEST_CASE_NAMED(FGameDataTests, "Charon::TestGameData", "[Core]")
 		CHECK(TestEntity->DocumentField == nullptr);
 		REQUIRE(TestEntity->IntFormula != nullptr);
 		CHECK_EQUALS("Result", 300, TestEntity->IntFormula->Invoke(100, 200));
+
+		// documents missing in patches are read as is
+		auto UnpatchedGameData = NewObject<UTestData>();
+		const TUniquePtr<FArchive> UnpatchedGameDataStream(IFileManager::Get().CreateFileReader(*GameDataFilePath, 0));
+		REQUIRE(UnpatchedGameData->TryLoad(UnpatchedGameDataStream.Get(), EGameDataFormat::Json));
+		CHECK(GameData->TestEntities.Num() == UnpatchedGameData->TestEntities.Num());
+		CHECK(GameData->NumberTestEntities.Num() == UnpatchedGameData->NumberTestEntities.Num());
+		for (const auto& TestEntityById : UnpatchedGameData->TestEntities)
+		{
+			const UTestEntity* PatchedTestEntity = GameData->TestEntities.FindRef(TestEntityById.Key);
+			REQUIRE(PatchedTestEntity != nullptr);
+			if (TestEntityById.Key != ETestEntityId::TestEntity1)
+			{
+				CHECK(PatchedTestEntity->TextField == TestEntityById.Value->TextField);
+			}
+		}
+
+		// unpatched documents of by-id collections are streamed, patched ones are merged
+		FString GameDataJson;
+		REQUIRE(FFileHelper::LoadFileToString(GameDataJson, *GameDataFilePath));
+		TSharedPtr<FJsonObject> GameDataObject;
+		REQUIRE(FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(GameDataJson), GameDataObject));
+		const TSharedPtr<FJsonObject> Collections = GameDataObject->GetObjectField(TEXT("Collections"));
+		for (auto& CollectionByName : Collections->Values)
+		{
+			const TSharedRef<FJsonObject> DocumentsById = MakeShared<FJsonObject>();
+			for (const TSharedPtr<FJsonValue>& Document : CollectionByName.Value->AsArray())
+			{
+				DocumentsById->SetField(Document->AsObject()->GetStringField(TEXT("Id")), Document);
+			}
+			CollectionByName.Value = MakeShared<FJsonValueObject>(DocumentsById);
+		}
+		FString ByIdGameDataJson;
+		REQUIRE(FJsonSerializer::Serialize(GameDataObject.ToSharedRef(), TJsonWriterFactory<>::Create(&ByIdGameDataJson)));
+		const FTCHARToUTF8 ByIdGameDataUtf8(*ByIdGameDataJson);
+
+		GameDataPatch1Stream->Seek(0);
+		GameDataPatch2Stream->Seek(0);
+		auto ByIdGameData = NewObject<UTestData>();
+		REQUIRE(ByIdGameData->TryLoad(TArrayView<const uint8>(reinterpret_cast<const uint8*>(ByIdGameDataUtf8.Get()), ByIdGameDataUtf8.Length()), Options));
+		CHECK(ByIdGameData->AllTestEntities.Num() == GameData->AllTestEntities.Num());
+		CHECK(ByIdGameData->AllNumberTestEntities.Num() == GameData->AllNumberTestEntities.Num());
+		CHECK(ByIdGameData->AllRecursiveEntities.Num() == GameData->AllRecursiveEntities.Num());
+		const auto ByIdTestEntity = ByIdGameData->TestEntities.FindRef(ETestEntityId::TestEntity1);
+		REQUIRE(ByIdTestEntity != nullptr);
+		CHECK(ByIdTestEntity->TextField == TEXT("Patched2"));
+		CHECK(ByIdTestEntity->DocumentField == nullptr);
+	}
+
+	SECTION("Loading throughput")
+	{
+		for (const TTuple<const TCHAR*, EGameDataFormat> GameDataFile : {
+			MakeTuple(TEXT("TestData.gdjs"), EGameDataFormat::Json),
+			MakeTuple(TEXT("TestData.gdmp"), EGameDataFormat::MessagePack) })
+		{
+			TArray<uint8> Buffer;
+			REQUIRE(FFileHelper::LoadFileToArray(Buffer, *FPaths::Combine(FPaths::ProjectContentDir(), GameDataFile.Key)));
+
+			auto GameData = NewObject<UTestData>();
+			auto MeasureDocumentLoadTime = [&](const bool StaticDispatch) -> double
+			{
+				constexpr int32 Iterations = 200;
+				FGameDataReaderDispatch::SetStaticDispatchEnabled(StaticDispatch);
+				const double StartTime = FPlatformTime::Seconds();
+				for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+				{
+					GameData->TryLoad(TArrayView<const uint8>(Buffer), GameDataFile.Value);
+				}
+				const double Seconds = FPlatformTime::Seconds() - StartTime;
+				FGameDataReaderDispatch::SetStaticDispatchEnabled(true);
+				return Seconds / (Iterations * FMath::Max(GameData->GetAllDocuments().Num(), 1));
+			};
+
+			MeasureDocumentLoadTime(true); // warm up
+			const double VirtualSeconds = MeasureDocumentLoadTime(false);
+			const double StaticSeconds = MeasureDocumentLoadTime(true);
+
+			CHECK(GameData->GetAllDocuments().Num() > 0);
+			CHECK(FGameDataReaderDispatch::GetStaticDispatchEnabled());
+
+			UE_LOG(LogTemp, Display, TEXT("%s load time per document: IGameDataReader %.3f us, TGameDataReader %.3f us."),
+				GameDataFile.Key, VirtualSeconds * 1e6, StaticSeconds * 1e6);
+		}
 	}
 }
 
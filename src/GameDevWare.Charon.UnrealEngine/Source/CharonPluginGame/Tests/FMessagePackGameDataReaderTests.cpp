@@ -4,6 +4,9 @@
 
 #include "Tests/TestHarnessAdapter.h"
 #include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/ArchiveProxy.h"
 #include "GameData/Formatters/FMessagePackGameDataReader.h"
 
 TEST_CASE_NAMED(FMessagePackGameDataReaderTest, "Charon::FMessagePackGameDataReaderTest", "[Core]")
@@ -145,6 +148,44 @@ TEST_CASE_NAMED(FMessagePackGameDataReaderTest, "Charon::FMessagePackGameDataRea
 		}
 	}
 
+	SECTION("ReadIntegers")
+	{
+		TArray<uint8> Buffer;
+		auto Base64Chars = FString(TEXT("jqJ2MdEA/6J2MtCAonYzf6J2NNIAAP//onY10YAAonY20X//onY3zv////+idjjSgAAAAKJ2OdJ/////onoxz///////////onoy04AAAAAAAAAAonoz03//////////ono0yn9///+iejXLf+////////8="));
+		FBase64::Decode(Base64Chars, Buffer, EBase64Mode::Standard);
+
+		auto ExpectedValues = TArray<int64>({
+			255, -128, 127, 65535, -32768, 32767, 4294967295LL, -2147483648LL, 2147483647, -1, MIN_int64, MAX_int64
+		});
+		auto ActualValues = TArray<int64>();
+		uint64 UnsignedValue = 0;
+
+		auto Reader = MakeUnique<FMessagePackGameDataReader>(TArrayView<const uint8>(Buffer));
+		while (Reader->ReadNext() && ActualValues.Num() < ExpectedValues.Num())
+		{
+			if (Reader->GetNotation() != EJsonNotation::Number && Reader->GetNotation() != EJsonNotation::String)
+			{
+				continue;
+			}
+
+			int64 Value = 0;
+			CHECK(Reader->ReadValue(Value));
+			ActualValues.Add(Value);
+
+			if (Reader->GetIdentifierView() == TEXT("z1"))
+			{
+				CHECK(Reader->ReadValue(UnsignedValue));
+			}
+		}
+
+		REQUIRE(ExpectedValues.Num() == ActualValues.Num());
+		for (int i = 0; i < ExpectedValues.Num(); ++i)
+		{
+			CHECK_MESSAGE(FString::Printf(TEXT("Expected: %lld, Actual: %lld"), ExpectedValues[i], ActualValues[i]), ExpectedValues[i] == ActualValues[i]);
+		}
+		CHECK(UnsignedValue == MAX_uint64);
+	}
+
 	SECTION("StringSimpleEscapes")
 	{
 		TArray<uint8> Buffer;
@@ -210,6 +251,201 @@ TEST_CASE_NAMED(FMessagePackGameDataReaderTest, "Charon::FMessagePackGameDataRea
 			CHECK(ExpectedValues[i] == ActualValues[i]);
 		}
 	}
+
+	SECTION("ReadStringViews")
+	{
+		TArray<uint8> Buffer;
+		auto Base64Chars = FString(TEXT("gqFhoKFixAIBAg==")); // {"a":"","b":bin[0x01,0x02]}
+		FBase64::Decode(Base64Chars, Buffer, EBase64Mode::Standard);
+		auto Stream = MakeUnique<FBufferReader>(Buffer.GetData(), Buffer.Num(), false, false);
+
+		auto StreamReader = MakeUnique<FMessagePackGameDataReader>(Stream.Get());
+		auto BufferReader = MakeUnique<FMessagePackGameDataReader>(TArrayView<const uint8>(Buffer));
+		for (IGameDataReader* Reader : { static_cast<IGameDataReader*>(StreamReader.Get()), static_cast<IGameDataReader*>(BufferReader.Get()) })
+		{
+			REQUIRE(Reader->ReadNext());
+			REQUIRE(Reader->ReadObjectBegin());
+			CHECK(Reader->ReadMemberView() == TEXT("a"));
+			CHECK(Reader->GetNotation() == EJsonNotation::String);
+			CHECK(Reader->GetValueAsStringView().IsEmpty());
+			REQUIRE(Reader->ReadNext());
+			CHECK(Reader->GetIdentifierView() == TEXT("b"));
+			CHECK(Reader->GetIdentifierHash() == FGameDataMemberNameHash::Of(TEXT("B")));
+			CHECK(Reader->GetNotation() == EJsonNotation::String);
+			CHECK(Reader->GetValueAsStringView() == TEXT("AQI="));
+			REQUIRE(Reader->ReadNext());
+			CHECK(Reader->ReadObjectEnd());
+		}
+	}
+
+	SECTION("ReadTruncatedBuffer")
+	{
+		TArray<uint8> Buffer;
+		auto Base64Chars = FString(TEXT("gaZ2YWx1ZXOWpHRleHQBw8LAyj/AAAA="));
+		FBase64::Decode(Base64Chars, Buffer, EBase64Mode::Standard);
+		Buffer.RemoveAt(Buffer.Num() - 2, 2); // cut float value in half
+
+		auto Reader = MakeUnique<FMessagePackGameDataReader>(TArrayView<const uint8>(Buffer));
+		while (Reader->ReadNext() && Reader->GetNotation() != EJsonNotation::Error)
+		{
+		}
+
+		CHECK(Reader->GetNotation() == EJsonNotation::Error);
+		CHECK(!Reader->GetErrorMessage().IsEmpty());
+	}
+
+	SECTION("ReadCorruptedLength")
+	{
+		// bin32 of 8 MiB and str32 of 4 GiB followed by 3 bytes
+		for (const uint8 Format : { static_cast<uint8>(0xc6), static_cast<uint8>(0xdb) })
+		{
+			TArray<uint8> Buffer = { Format, 0x00, 0x80, 0x00, 0x00, 0x01, 0x02, 0x03 };
+			if (Format == 0xdb)
+			{
+				Buffer[1] = Buffer[2] = Buffer[3] = Buffer[4] = 0xFF;
+			}
+
+			auto Stream = MakeUnique<FBufferReader>(Buffer.GetData(), Buffer.Num(), false, false);
+			auto StreamReader = MakeUnique<FMessagePackGameDataReader>(Stream.Get());
+			auto BufferReader = MakeUnique<FMessagePackGameDataReader>(TArrayView<const uint8>(Buffer));
+			for (FMessagePackGameDataReader* Reader : { StreamReader.Get(), BufferReader.Get() })
+			{
+				while (Reader->ReadNext() && Reader->GetNotation() != EJsonNotation::Error)
+				{
+				}
+
+				CHECK(Reader->GetNotation() == EJsonNotation::Error);
+				CHECK(!Reader->GetErrorMessage().IsEmpty());
+			}
+		}
+	}
+
+	SECTION("SkipContainers")
+	{
+		TArray<uint8> Buffer;
+		auto GameDataFilePath = FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdmp"));
+		REQUIRE(FFileHelper::LoadFileToArray(Buffer, *GameDataFilePath));
+
+		// skip every third container and record tokens around it, length-prefix skip should match token-by-token skip
+		auto ReadWithSkips = [](FMessagePackGameDataReader& Reader, const bool UseTokenSkip) -> TArray<FString>
+		{
+			TArray<FString> Tokens;
+			int32 ContainerCount = 0;
+			while (Reader.ReadNext() && Reader.GetNotation() != EJsonNotation::Error)
+			{
+				const EJsonNotation Notation = Reader.GetNotation();
+				const bool IsEnd = Notation == EJsonNotation::ObjectEnd || Notation == EJsonNotation::ArrayEnd;
+				Tokens.Add(FString::Printf(TEXT("%d:%s"), static_cast<int32>(Notation), IsEnd ? TEXT("") : *Reader.GetIdentifier()));
+
+				if ((Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart) && ++ContainerCount % 3 == 0)
+				{
+					if (UseTokenSkip)
+					{
+						Reader.IGameDataReader::SkipAny(false);
+					}
+					else
+					{
+						Reader.SkipAny(false);
+					}
+					Tokens.Add(FString::Printf(TEXT("%d:skipped"), static_cast<int32>(Reader.GetNotation())));
+				}
+			}
+			Tokens.Add(Reader.GetErrorMessage());
+			return Tokens;
+		};
+
+		auto Stream = MakeUnique<FBufferReader>(Buffer.GetData(), Buffer.Num(), false, false);
+		auto StreamReader = MakeUnique<FMessagePackGameDataReader>(Stream.Get());
+		auto BufferReader = MakeUnique<FMessagePackGameDataReader>(TArrayView<const uint8>(Buffer));
+		auto TokenSkipReader = MakeUnique<FMessagePackGameDataReader>(TArrayView<const uint8>(Buffer));
+
+		const TArray<FString> ExpectedTokens = ReadWithSkips(*TokenSkipReader, true);
+		const TArray<FString> StreamTokens = ReadWithSkips(*StreamReader, false);
+		const TArray<FString> BufferTokens = ReadWithSkips(*BufferReader, false);
+
+		REQUIRE(ExpectedTokens.Num() == StreamTokens.Num());
+		REQUIRE(ExpectedTokens.Num() == BufferTokens.Num());
+		for (int i = 0; i < ExpectedTokens.Num(); ++i)
+		{
+			CHECK_MESSAGE(FString::Format(TEXT("Expected: {0}, Actual: {1}"), { ExpectedTokens[i], StreamTokens[i] }), ExpectedTokens[i] == StreamTokens[i]);
+			CHECK_MESSAGE(FString::Format(TEXT("Expected: {0}, Actual: {1}"), { ExpectedTokens[i], BufferTokens[i] }), ExpectedTokens[i] == BufferTokens[i]);
+		}
+	}
+
+	SECTION("ReadThroughput")
+	{
+		TArray<uint8> GameDataBytes;
+		auto GameDataFilePath = FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdmp"));
+		REQUIRE(FFileHelper::LoadFileToArray(GameDataBytes, *GameDataFilePath));
+
+		// wrap N copies of game data into Array32 to get measurable input size
+		constexpr uint32 Copies = 64;
+		TArray<uint8> Buffer;
+		Buffer.Reserve(GameDataBytes.Num() * Copies + 5);
+		Buffer.Add(0xdd);
+		Buffer.Add((Copies >> 24) & 0xFF);
+		Buffer.Add((Copies >> 16) & 0xFF);
+		Buffer.Add((Copies >> 8) & 0xFF);
+		Buffer.Add(Copies & 0xFF);
+		for (uint32 Copy = 0; Copy < Copies; ++Copy)
+		{
+			Buffer.Append(GameDataBytes);
+		}
+
+		auto CountTokens = [](IGameDataReader& Reader, double& OutSeconds) -> int32
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			int32 TokenCount = 0;
+			while (Reader.ReadNext() && Reader.GetNotation() != EJsonNotation::Error)
+			{
+				TokenCount++;
+			}
+			OutSeconds = FPlatformTime::Seconds() - StartTime;
+			return TokenCount;
+		};
+
+		// reader used to pull each byte through FArchive, so baseline is measured over archive which serializes byte by byte
+		class FPerByteArchive final : public FArchiveProxy
+		{
+		public:
+			explicit FPerByteArchive(FArchive& InnerArchive) : FArchiveProxy(InnerArchive)
+			{
+			}
+
+			virtual void Serialize(void* Data, const int64 Length) override
+			{
+				for (int64 Index = 0; Index < Length; ++Index)
+				{
+					InnerArchive.Serialize(static_cast<uint8*>(Data) + Index, 1);
+				}
+			}
+		};
+
+		double PerByteSeconds = 0;
+		auto PerByteInnerStream = MakeUnique<FBufferReader>(Buffer.GetData(), Buffer.Num(), false, false);
+		auto PerByteStream = MakeUnique<FPerByteArchive>(*PerByteInnerStream);
+		auto PerByteReader = MakeUnique<FMessagePackGameDataReader>(PerByteStream.Get());
+		const int32 PerByteTokenCount = CountTokens(*PerByteReader, PerByteSeconds);
+
+		double StreamSeconds = 0;
+		auto Stream = MakeUnique<FBufferReader>(Buffer.GetData(), Buffer.Num(), false, false);
+		auto StreamReader = MakeUnique<FMessagePackGameDataReader>(Stream.Get());
+		const int32 StreamTokenCount = CountTokens(*StreamReader, StreamSeconds);
+
+		double BufferSeconds = 0;
+		auto BufferReader = MakeUnique<FMessagePackGameDataReader>(TArrayView<const uint8>(Buffer));
+		const int32 BufferTokenCount = CountTokens(*BufferReader, BufferSeconds);
+
+		CHECK(PerByteReader->GetErrorMessage().IsEmpty());
+		CHECK(StreamReader->GetErrorMessage().IsEmpty());
+		CHECK(BufferReader->GetErrorMessage().IsEmpty());
+		CHECK(PerByteTokenCount == BufferTokenCount);
+		CHECK(StreamTokenCount == BufferTokenCount);
+
+		const double SizeInMb = Buffer.Num() / (1024.0 * 1024.0);
+		UE_LOG(LogTemp, Display, TEXT("MessagePack read throughput for %.2f MiB: per-byte FArchive (baseline) %.2f MiB/s, FArchive %.2f MiB/s, buffer %.2f MiB/s."),
+			SizeInMb, SizeInMb / FMath::Max(PerByteSeconds, 1e-6), SizeInMb / FMath::Max(StreamSeconds, 1e-6), SizeInMb / FMath::Max(BufferSeconds, 1e-6));
+	}
 }
 
 #endif //WITH_TESTS
\ No newline at end of file
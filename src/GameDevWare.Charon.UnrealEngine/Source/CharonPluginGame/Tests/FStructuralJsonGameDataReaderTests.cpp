@@ -0,0 +1,303 @@
+﻿// Copyright GameDevWare, Denis Zykov 2025
+
+#if WITH_TESTS
+
+#include "Tests/TestHarnessAdapter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/BufferReader.h"
+#include "GameData/Formatters/FJsonGameDataReader.h"
+#include "GameData/Formatters/FStructuralJsonGameDataReader.h"
+
+TEST_CASE_NAMED(FStructuralJsonGameDataReaderTest, "Charon::FStructuralJsonGameDataReaderTest", "[Core]")
+{
+	auto ToBuffer = [](const ANSICHAR* Json) -> TArray<uint8>
+	{
+		return TArray<uint8>(reinterpret_cast<const uint8*>(Json), FCStringAnsi::Strlen(Json));
+	};
+
+	SECTION("ReadTokens")
+	{
+		TArray<uint8> Buffer = ToBuffer(R"({ "values": ["text", 1, true, false, null, 1.1] })");
+
+		auto ExpectedTokens = TArray<EJsonNotation>({
+			EJsonNotation::ObjectStart, EJsonNotation::ArrayStart, EJsonNotation::String, EJsonNotation::Number,
+			EJsonNotation::Boolean, EJsonNotation::Boolean, EJsonNotation::Null, EJsonNotation::Number, EJsonNotation::ArrayEnd, EJsonNotation::ObjectEnd
+		});
+		auto ActualTokens = TArray<EJsonNotation>();
+
+		auto Reader = MakeUnique<FStructuralJsonGameDataReader>(TArrayView<const uint8>(Buffer));
+		while (Reader->ReadNext())
+		{
+			ActualTokens.Add(Reader->GetNotation());
+		}
+
+		REQUIRE(ExpectedTokens.Num() == ActualTokens.Num());
+		for (int i = 0; i < ExpectedTokens.Num(); ++i)
+		{
+			CHECK(ExpectedTokens[i] == ActualTokens[i]);
+		}
+	}
+
+	SECTION("ReadValues")
+	{
+		TArray<uint8> Buffer = ToBuffer(R"({"values":["text",1,true,false,null,1.5]})");
+
+		auto ExpectedValues = TArray<FString>({
+			"", "", "text", "1.000000", "true", "false", "null", "1.500000", "", ""
+		});
+		auto ActualValues = TArray<FString>();
+
+		auto Reader = MakeUnique<FStructuralJsonGameDataReader>(TArrayView<const uint8>(Buffer));
+		while (Reader->ReadNext())
+		{
+			switch (Reader->GetNotation())
+			{
+			case EJsonNotation::String:
+				ActualValues.Add(Reader->GetValueAsString());
+				break;
+			case EJsonNotation::Number:
+				ActualValues.Add(FString::Format(TEXT("{0}"), { Reader->GetValueAsNumber() }));
+				break;
+			case EJsonNotation::Null:
+				ActualValues.Add(TEXT("null"));
+				break;
+			case EJsonNotation::Boolean:
+				ActualValues.Add(Reader->GetValueAsBoolean() ? TEXT("true"): TEXT("false"));
+				break;
+			default:
+				ActualValues.Add(TEXT(""));
+				break;
+			}
+		}
+
+		REQUIRE(ExpectedValues.Num() == ActualValues.Num());
+		for (int i = 0; i < ExpectedValues.Num(); ++i)
+		{
+			CHECK_MESSAGE(FString::Format(TEXT("Expected: {0}, Actual: {1}"), { ExpectedValues[i], ActualValues[i] }), ExpectedValues[i] == ActualValues[i]);
+		}
+	}
+
+	SECTION("ReadIntegers")
+	{
+		TArray<uint8> Buffer = ToBuffer(R"({"v1":255,"v2":-128,"v3":127,"v4":65535,"v5":-32768,"v6":32767,"v7":4294967295,"v8":-2147483648,"v9":2147483647,)"
+			R"("z1":18446744073709551615,"z2":-9223372036854775808,"z3":9223372036854775807})");
+
+		auto ExpectedValues = TArray<int64>({
+			255, -128, 127, 65535, -32768, 32767, 4294967295LL, -2147483648LL, 2147483647, -1, MIN_int64, MAX_int64
+		});
+		auto ActualValues = TArray<int64>();
+		uint64 UnsignedValue = 0;
+
+		auto Reader = MakeUnique<FStructuralJsonGameDataReader>(TArrayView<const uint8>(Buffer));
+		while (Reader->ReadNext())
+		{
+			if (Reader->GetNotation() != EJsonNotation::Number)
+			{
+				continue;
+			}
+
+			int64 Value = 0;
+			CHECK(Reader->ReadValue(Value));
+			ActualValues.Add(Value);
+
+			if (Reader->GetIdentifierView() == TEXT("z1"))
+			{
+				CHECK(Reader->ReadValue(UnsignedValue));
+			}
+		}
+
+		REQUIRE(ExpectedValues.Num() == ActualValues.Num());
+		for (int i = 0; i < ExpectedValues.Num(); ++i)
+		{
+			CHECK_MESSAGE(FString::Printf(TEXT("Expected: %lld, Actual: %lld"), ExpectedValues[i], ActualValues[i]), ExpectedValues[i] == ActualValues[i]);
+		}
+		CHECK(UnsignedValue == MAX_uint64);
+	}
+
+	SECTION("StringSimpleEscapes")
+	{
+		TArray<uint8> Buffer = ToBuffer(R"(["\\ \"\/\b\f\t\"\r\n"])");
+
+		auto ExpectedValues = TArray<FString>({
+			"", TEXT("\\ \"/\x08\x0C\t\"\r\n"), ""
+		});
+		auto ActualValues = TArray<FString>();
+
+		auto Reader = MakeUnique<FStructuralJsonGameDataReader>(TArrayView<const uint8>(Buffer));
+		while (Reader->ReadNext())
+		{
+			switch (Reader->GetNotation())
+			{
+			case EJsonNotation::String:
+				ActualValues.Add(Reader->GetValueAsString());
+				break;
+			default:
+				ActualValues.Add(TEXT(""));
+				break;
+			}
+		}
+
+		REQUIRE(ExpectedValues.Num() == ActualValues.Num());
+		for (int i = 0; i < ExpectedValues.Num(); ++i)
+		{
+			CHECK_MESSAGE(FString::Format(TEXT("Expected: {0}, Actual: {1}"), { ExpectedValues[i], ActualValues[i] }), ExpectedValues[i] == ActualValues[i]);
+		}
+	}
+
+	SECTION("StringUnicodeEscapes")
+	{
+		TArray<uint8> Buffer = ToBuffer("[\"\\u4E16\", \"\xE4\xB8\x96\", \"\\uD83D\\uDE00\"]");
+
+		auto ExpectedValues = TArray<FString>({
+			"", TEXT("\u4E16"), TEXT("\u4E16"), TEXT("\U0001F600"), ""
+		});
+		auto ActualValues = TArray<FString>();
+
+		auto Reader = MakeUnique<FStructuralJsonGameDataReader>(TArrayView<const uint8>(Buffer));
+		while (Reader->ReadNext())
+		{
+			switch (Reader->GetNotation())
+			{
+			case EJsonNotation::String:
+				ActualValues.Add(Reader->GetValueAsString());
+				break;
+			default:
+				ActualValues.Add(TEXT(""));
+				break;
+			}
+		}
+
+		REQUIRE(ExpectedValues.Num() == ActualValues.Num());
+		for (int i = 0; i < ExpectedValues.Num(); ++i)
+		{
+			CHECK(ExpectedValues[i] == ActualValues[i]);
+		}
+	}
+
+	SECTION("SkipContainers")
+	{
+		TArray<uint8> Buffer = ToBuffer(R"({"a":{"b":["}",{"c":"]\"{"}],"d":[]},"e":1})");
+
+		auto Reader = MakeUnique<FStructuralJsonGameDataReader>(TArrayView<const uint8>(Buffer));
+		REQUIRE(Reader->ReadNext());
+		REQUIRE(Reader->ReadNext());
+		CHECK(Reader->GetNotation() == EJsonNotation::ObjectStart);
+		CHECK(Reader->GetIdentifierView() == TEXT("a"));
+		Reader->SkipAny();
+		CHECK(Reader->GetNotation() == EJsonNotation::Number);
+		CHECK(Reader->GetIdentifierView() == TEXT("e"));
+		REQUIRE(Reader->ReadNext());
+		CHECK(Reader->GetNotation() == EJsonNotation::ObjectEnd);
+		CHECK(!Reader->ReadNext());
+		CHECK(Reader->GetErrorMessage().IsEmpty());
+	}
+
+	SECTION("ReadMalformed")
+	{
+		for (const ANSICHAR* Json : { R"({"a":1,})", R"([1 2])", R"({"a" 1})", R"({"a":tru})", R"([1,2)", R"(["abc)", R"({"a":1}x)" })
+		{
+			TArray<uint8> Buffer = ToBuffer(Json);
+			auto Reader = MakeUnique<FStructuralJsonGameDataReader>(TArrayView<const uint8>(Buffer));
+			while (Reader->ReadNext() && Reader->GetNotation() != EJsonNotation::Error)
+			{
+			}
+
+			CHECK(Reader->GetNotation() == EJsonNotation::Error);
+			CHECK(!Reader->GetErrorMessage().IsEmpty());
+		}
+	}
+
+	SECTION("MatchesJsonReader")
+	{
+		TArray<uint8> Buffer;
+		auto GameDataFilePath = FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"));
+		REQUIRE(FFileHelper::LoadFileToArray(Buffer, *GameDataFilePath));
+
+		auto Stream = MakeUnique<FBufferReader>(Buffer.GetData(), Buffer.Num(), false, false);
+		auto ExpectedReader = MakeUnique<FJsonGameDataReader>(Stream.Get());
+		auto ActualReader = MakeUnique<FStructuralJsonGameDataReader>(TArrayView<const uint8>(Buffer));
+		int32 TokenCount = 0;
+		while (ExpectedReader->ReadNext())
+		{
+			REQUIRE(ActualReader->ReadNext());
+			REQUIRE(ExpectedReader->GetNotation() == ActualReader->GetNotation());
+			CHECK(ExpectedReader->GetIdentifier() == ActualReader->GetIdentifier());
+			switch (ExpectedReader->GetNotation())
+			{
+			case EJsonNotation::String:
+				CHECK(ExpectedReader->GetValueAsString() == ActualReader->GetValueAsString());
+				break;
+			case EJsonNotation::Number:
+				CHECK(ExpectedReader->GetValueAsNumber() == ActualReader->GetValueAsNumber());
+				break;
+			case EJsonNotation::Boolean:
+				CHECK(ExpectedReader->GetValueAsBoolean() == ActualReader->GetValueAsBoolean());
+				break;
+			default:
+				break;
+			}
+			TokenCount++;
+		}
+		CHECK(!ActualReader->ReadNext());
+		CHECK(ActualReader->GetErrorMessage().IsEmpty());
+		CHECK(TokenCount > 0);
+	}
+
+	SECTION("ReadThroughput")
+	{
+		TArray<uint8> GameDataBytes;
+		auto GameDataFilePath = FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TestData.gdjs"));
+		REQUIRE(FFileHelper::LoadFileToArray(GameDataBytes, *GameDataFilePath));
+
+		// wrap N copies of game data into array to get measurable input size
+		constexpr int32 Copies = 64;
+		TArray<uint8> Buffer;
+		Buffer.Reserve((GameDataBytes.Num() + 1) * Copies + 2);
+		Buffer.Add('[');
+		for (int32 Copy = 0; Copy < Copies; ++Copy)
+		{
+			if (Copy > 0)
+			{
+				Buffer.Add(',');
+			}
+			const bool HasBom = GameDataBytes.Num() >= 3 && GameDataBytes[0] == 0xEF && GameDataBytes[1] == 0xBB && GameDataBytes[2] == 0xBF;
+			Buffer.Append(GameDataBytes.GetData() + (HasBom ? 3 : 0), GameDataBytes.Num() - (HasBom ? 3 : 0));
+		}
+		Buffer.Add(']');
+
+		auto CountTokens = [](IGameDataReader& Reader, double& OutSeconds) -> int32
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			int32 TokenCount = 0;
+			while (Reader.ReadNext() && Reader.GetNotation() != EJsonNotation::Error)
+			{
+				TokenCount++;
+			}
+			OutSeconds = FPlatformTime::Seconds() - StartTime;
+			return TokenCount;
+		};
+
+		double JsonSeconds = 0;
+		auto Stream = MakeUnique<FBufferReader>(Buffer.GetData(), Buffer.Num(), false, false);
+		auto JsonReader = MakeUnique<FJsonGameDataReader>(Stream.Get());
+		const int32 JsonTokenCount = CountTokens(*JsonReader, JsonSeconds);
+
+		const double IndexStartTime = FPlatformTime::Seconds();
+		auto StructuralReader = MakeUnique<FStructuralJsonGameDataReader>(TArrayView<const uint8>(Buffer));
+		const double IndexSeconds = FPlatformTime::Seconds() - IndexStartTime;
+		double StructuralSeconds = 0;
+		const int32 StructuralTokenCount = CountTokens(*StructuralReader, StructuralSeconds);
+		StructuralSeconds += IndexSeconds; // structural index is built in constructor
+
+		CHECK(JsonReader->GetErrorMessage().IsEmpty());
+		CHECK(StructuralReader->GetErrorMessage().IsEmpty());
+		CHECK(JsonTokenCount == StructuralTokenCount);
+
+		const double SizeInMb = Buffer.Num() / (1024.0 * 1024.0);
+		UE_LOG(LogTemp, Display, TEXT("JSON read throughput for %.2f MiB: FJsonGameDataReader %.2f MiB/s, FStructuralJsonGameDataReader %.2f MiB/s."),
+			SizeInMb, SizeInMb / FMath::Max(JsonSeconds, 1e-6), SizeInMb / FMath::Max(StructuralSeconds, 1e-6));
+	}
+}
+
+#endif //WITH_TESTS
@@ -26,6 +26,8 @@ FText UCurio::GetDescription() const {
 	return DescriptionRaw.GetCurrent();
 }
 TMap<FString,ULocation*> UCurio::GetLocations() const {
-	FGameDataDocumentReference::GetReferencedDocuments(LocationsRaw, _LocationsDocuments);
-	return _LocationsDocuments;
+	return GetLocationsView();
+}
+const TMap<FString,ULocation*>& UCurio::GetLocationsView() const {
+	return FGameDataDocumentReference::GetReferencedDocumentsCached(LocationsRaw, _LocationsDocuments, _LocationsDocumentsLoadGeneration);
 }
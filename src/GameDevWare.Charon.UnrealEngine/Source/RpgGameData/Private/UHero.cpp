@@ -27,8 +27,10 @@ FText UHero::GetBio() const {
 	return BioRaw.GetCurrent();
 }
 TMap<FString,UHero*> UHero::GetDislikeHeroes() const {
-	FGameDataDocumentReference::GetReferencedDocuments(DislikeHeroesRaw, _DislikeHeroesDocuments);
-	return _DislikeHeroesDocuments;
+	return GetDislikeHeroesView();
+}
+const TMap<FString,UHero*>& UHero::GetDislikeHeroesView() const {
+	return FGameDataDocumentReference::GetReferencedDocumentsCached(DislikeHeroesRaw, _DislikeHeroesDocuments, _DislikeHeroesDocumentsLoadGeneration);
 }
 UProvision* UHero::GetProvisions() const {
 	FGameDataDocumentReference::GetReferencedDocument(ProvisionsRaw, _ProvisionsDocument);
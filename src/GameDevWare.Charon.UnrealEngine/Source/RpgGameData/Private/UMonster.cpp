@@ -23,6 +23,8 @@ FText UMonster::GetName() const {
 	return NameRaw.GetCurrent();
 }
 TMap<FString,ULocation*> UMonster::GetLocations() const {
-	FGameDataDocumentReference::GetReferencedDocuments(LocationsRaw, _LocationsDocuments);
-	return _LocationsDocuments;
+	return GetLocationsView();
+}
+const TMap<FString,ULocation*>& UMonster::GetLocationsView() const {
+	return FGameDataDocumentReference::GetReferencedDocumentsCached(LocationsRaw, _LocationsDocuments, _LocationsDocumentsLoadGeneration);
 }
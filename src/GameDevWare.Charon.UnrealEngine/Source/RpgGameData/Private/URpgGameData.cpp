@@ -14,6 +14,7 @@
 // ReSharper disable All
 
 #include "URpgGameData.h"
+#include "GameData/FGameDataCustomVersion.h"
 #include "URpgGameDataProjectSettings.h"
 #include "UParameter.h"
 #include "UParameterValue.h"
@@ -100,11 +101,15 @@ TSharedRef<FFormulaTypeResolver> URpgGameData::GetSharedFormulaTypeResolver()
 
 void URpgGameData::Empty()
 {
+	// documents cached by FGameDataDocumentReference, referrers and document indexes are about to be destroyed
+	IncrementLoadGeneration();
+
 	if (LanguageSwitcher)
 	{
 		LanguageSwitcher->CurrentLanguageId = TEXT("en-US");
 		LanguageSwitcher->FallbackLanguageId = TEXT("en-US");
 		LanguageSwitcher->PrimaryLanguageId = TEXT("en-US");
+		LanguageSwitcher->MarkLanguageChanged();
 	}
 
 	RootDocuments = nullptr;
@@ -114,47 +119,29 @@ void URpgGameData::Empty()
 	RevisionHash.Empty();
 
 	ProjectSettings = nullptr;
-	AllProjectSettingsList.Reset();
-	ProjectSettingsList.Reset();
-	AllParameters.Reset();
-	Parameters.Reset();
-	AllParameterValues.Reset();
-	ParameterValues.Reset();
-	AllProvisions.Reset();
-	Provisions.Reset();
-	AllHeros.Reset();
-	Heros.Reset();
-	AllItems.Reset();
-	Items.Reset();
-	AllLocations.Reset();
-	Locations.Reset();
-	AllTrinkets.Reset();
-	Trinkets.Reset();
-	AllMonsters.Reset();
-	Monsters.Reset();
-	AllLoots.Reset();
-	Loots.Reset();
-	AllCombatEffects.Reset();
-	CombatEffects.Reset();
-	AllCurioCleansingOptions.Reset();
-	CurioCleansingOptions.Reset();
-	AllCurios.Reset();
-	Curios.Reset();
-	AllDiseases.Reset();
-	Diseases.Reset();
-	AllQuirks.Reset();
-	Quirks.Reset();
-	AllConditionsList.Reset();
-	ConditionsList.Reset();
-	AllWeapons.Reset();
-	Weapons.Reset();
-	AllArmors.Reset();
-	Armors.Reset();
-	AllItemWithCounts.Reset();
-	ItemWithCounts.Reset();
+	RpgGameDataProjectSettingsStore.Reset();
+	ParameterStore.Reset();
+	DenseAllParameters.Reset();
+	DenseParameters.Reset();
+	ParameterValueStore.Reset();
+	ProvisionStore.Reset();
+	HeroStore.Reset();
+	ItemStore.Reset();
+	LocationStore.Reset();
+	TrinketStore.Reset();
+	MonsterStore.Reset();
+	LootStore.Reset();
+	CombatEffectStore.Reset();
+	CurioCleansingOptionStore.Reset();
+	CurioStore.Reset();
+	DiseaseStore.Reset();
+	QuirkStore.Reset();
+	ConditionStore.Reset();
+	WeaponStore.Reset();
+	ArmorStore.Reset();
+	ItemWithCountStore.Reset();
 	StartingSet = nullptr;
-	AllStartingSets.Reset();
-	StartingSets.Reset();
+	StartingSetStore.Reset();
 
 	SupportedLanguages.Reset();
 
@@ -191,8 +178,81 @@ bool URpgGameData::TryLoad(FArchive* const GameDataStream, EGameDataFormat Forma
 }
 bool URpgGameData::TryLoad(FArchive* const GameDataStream, FGameDataLoadOptions Options)
 {
+	return TryLoadFromReader(CreateReader(GameDataStream, Options), Options);
+}
+bool URpgGameData::TryLoad(const TArrayView<const uint8> GameDataBuffer, EGameDataFormat Format)
+{
+	auto Options = FGameDataLoadOptions();
+	Options.Format = Format;
+	return TryLoad(GameDataBuffer, Options);
+}
+bool URpgGameData::TryLoad(const TArrayView<const uint8> GameDataBuffer, FGameDataLoadOptions Options)
+{
+	if (Options.LazyDocuments && Options.Patches.Num() == 0)
+	{
+		// only document ids are read now, documents are created from game data's own copy of buffer on first access
+		LazyDocuments = MakeShared<FGameDataLazyDocuments>();
+		const TSharedPtr<IGameDataReader> LazyDocumentsReader = LazyDocuments->Open(GameDataBuffer, Options.Format);
+		if (LazyDocumentsReader.IsValid())
+		{
+			if (Options.BuildReferrersIndex || Options.DocumentIndexes.Num() > 0 || IndexDeclarations.Num() > 0)
+			{
+				UE_LOG(LogURpgGameData, Warning, TEXT("Referrers index and document indexes are not built for game data loaded with 'LazyDocuments' option. Load game data without 'LazyDocuments' to use them."));
+			}
+			return TryLoadFromReader(LazyDocumentsReader.ToSharedRef(), Options);
+		}
+		LazyDocuments.Reset();
+	}
+
+	// read directly from buffer without FArchive indirection
+	switch (Options.Format)
+	{
+	case EGameDataFormat::Json: return TryLoadFromReader(FGameDataReaderFactory::CreateJsonReader(GameDataBuffer), Options);
+	case EGameDataFormat::MessagePack: return TryLoadFromReader(FGameDataReaderFactory::CreateMessagePackReader(GameDataBuffer), Options);
+	case EGameDataFormat::Compiled: return TryLoadFromReader(FGameDataReaderFactory::CreateCompiledReader(GameDataBuffer), Options);
+	default: break;
+	}
+
+	FMemoryReaderView GameDataStream(GameDataBuffer);
+	return TryLoad(&GameDataStream, Options);
+}
+bool URpgGameData::TryLoadFromReader(TSharedRef<IGameDataReader> GameDataReader, const FGameDataLoadOptions& Options)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(URpgGameData_TryLoad, CharonChannel);
+
+	// stats are per collection and phase, so they are always collected and kept for 'Charon.DumpLoadStats'
+	FGameDataLoadStats LoadStats;
+	LoadStats.GameDataName = GetName();
+	LoadStats.Format = Options.Format;
+	const double LoadStartTime = FPlatformTime::Seconds();
+	ON_SCOPE_EXIT
+	{
+		LoadStats.TotalSeconds = FPlatformTime::Seconds() - LoadStartTime;
+		FGameDataLoadStats::SetLastLoadStats(LoadStats);
+		if (Options.Stats != nullptr)
+		{
+			*Options.Stats = LoadStats;
+		}
+	};
+
 	Empty(); // Reset current state
 
+	if (LazyDocuments.IsValid() && !LazyDocuments->IsReader(*GameDataReader))
+	{
+		LazyDocuments.Reset(); // documents are created during load
+	}
+
+	LanguageFilter = Options.Languages;
+
+	if (Options.PoolLocalizedTexts)
+	{
+		LocalizedStringPool = MakeShared<FGameDataLocalizedStringPool>();
+	}
+	else
+	{
+		LocalizedStringPool.Reset();
+	}
+
 	SupportedLanguages.Add(TEXT("en-US"));
 
 	if (LanguageSwitcher == nullptr)
@@ -202,61 +262,87 @@ bool URpgGameData::TryLoad(FArchive* const GameDataStream, FGameDataLoadOptions
 	LanguageSwitcher->CurrentLanguageId = TEXT("en-US");
 	LanguageSwitcher->FallbackLanguageId = TEXT("en-US");
 	LanguageSwitcher->PrimaryLanguageId = TEXT("en-US");
+	LanguageSwitcher->MarkLanguageChanged();
 
-	auto GameDataReader = CreateReader(GameDataStream, Options);
 	GameDataReader->ReadNext(); // initialize reader and move to first token
 
 	if (Options.Patches.Num() > 0)
 	{
-		TSharedPtr<FJsonObject> GameDataDocument = nullptr;
-		if (!GameDataReader->ReadObject(GameDataDocument, /* NextToken */  false))
-		{
-			GameDataDocument = nullptr;
-			UE_LOG(LogURpgGameData, Error, TEXT("Failed to read Game Data from file. Probably file format is wrong or file is broken."));
-			return false;
-		}
+		TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(URpgGameData_MergePatches, CharonChannel);
+		const double PatchMergeStartTime = FPlatformTime::Seconds();
+
+		// patches are indexed by document and applied while game data is streamed, see ReadPatchedDocumentCollection
+		PatchIndex = MakeShared<FGameDataPatchIndex>();
 		for (const auto GameDataPatchStream : Options.Patches)
 		{
 			const auto GameDataPatchReader = CreateReader(GameDataPatchStream, Options);
 			GameDataPatchReader->ReadNext(); // initialize reader and move to first token
 
-			TSharedPtr<FJsonObject> GameDataPatchDocument;
-			if (!GameDataPatchReader->ReadObject(GameDataPatchDocument, /* NextToken */  false))
+			if (!PatchIndex->AddPatch(*GameDataPatchReader, *this))
 			{
-				GameDataPatchDocument = nullptr;
+				PatchIndex.Reset();
 				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read Game Data patch from file. Probably file format is wrong or file is broken."));
 				return false;
 			}
-
-			GameDataDocument = MergeGameData(GameDataDocument, GameDataPatchDocument);
-		}
-
-		if (GameDataDocument == nullptr)
-		{
-			UE_LOG(LogURpgGameData, Error, TEXT("Failed to apply Game Data patch."));
-			return false;
 		}
 
-		GameDataReader = FGameDataReaderFactory::CreateJsonObjectReader(GameDataDocument);
-		GameDataReader->ReadNext(); // initialize reader and move to first token
+		LoadStats.PatchMergeSeconds = FPlatformTime::Seconds() - PatchMergeStartTime;
 	}
 
-	if (!ReadGameData(GameDataReader))
+	const double ParseStartTime = FPlatformTime::Seconds();
+	const bool bParsed = ReadGameData(GameDataReader, LoadStats);
+	LoadStats.ParseSeconds = FPlatformTime::Seconds() - ParseStartTime;
+	PatchIndex.Reset(); // all patches are applied by now
+	if (!bParsed)
 	{
 		UE_LOG(LogURpgGameData, Error, TEXT("Failed to parse Game Data from file."));
 		return false;
 	}
 
+	const double FindAllDocumentsStartTime = FPlatformTime::Seconds();
 	FindAllDocuments();
+	LoadStats.FindAllDocumentsSeconds = FPlatformTime::Seconds() - FindAllDocumentsStartTime;
+
+	const double UpdateSettingsStartTime = FPlatformTime::Seconds();
 	UpdateProjectSettings();
 	UpdateSettings();
+	if (LanguageFilter.Num() > 0)
+	{
+		SupportedLanguages.RemoveAll([this](const FString& LanguageId) { return !LanguageFilter.Contains(LanguageId); });
+	}
+	LoadStats.UpdateSettingsSeconds = FPlatformTime::Seconds() - UpdateSettingsStartTime;
 
+	// lazily created documents are resolved on access, resolving them here would create all documents
+	if (!LazyDocuments.IsValid())
+	{
+		const double ResolveReferencesStartTime = FPlatformTime::Seconds();
+		LoadStats.UnresolvedReferences = ResolveAllReferences(Options.BuildReferrersIndex);
+		LoadStats.ReferrersIndexBytes = ReferrersIndex.GetAllocatedSize();
+		LoadStats.ResolveReferencesSeconds = FPlatformTime::Seconds() - ResolveReferencesStartTime;
+
+		if (IndexDeclarations.Num() > 0 || Options.DocumentIndexes.Num() > 0)
+		{
+			const double BuildIndexesStartTime = FPlatformTime::Seconds();
+			BuildDocumentIndexes(GetAllDocuments(), Options.DocumentIndexes, LanguageSwitcher->PrimaryLanguageId);
+			LoadStats.DocumentIndexesBytes = DocumentIndexes.GetAllocatedSize();
+			LoadStats.BuildIndexesSeconds = FPlatformTime::Seconds() - BuildIndexesStartTime;
+		}
+	}
+
+	if (LazyDocuments.IsValid() && LazyDocuments->IsEmpty())
+	{
+		LazyDocuments.Reset();
+	}
+
+	LoadStats.IsSucceeded = true;
 	return true;
 }
 
 void URpgGameData::UpdateProjectSettings()
 {
-	const auto _ProjectSettings = GetOne(this->ProjectSettingsList);
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(URpgGameData_UpdateProjectSettings, CharonChannel);
+
+	const auto _ProjectSettings = GetOne(this->RpgGameDataProjectSettingsStore);
 	if (_ProjectSettings == nullptr)
 	{
 		return;
@@ -288,6 +374,7 @@ void URpgGameData::UpdateProjectSettings()
 	}
 
 	LanguageSwitcher->CurrentLanguageId = LanguageSwitcher->FallbackLanguageId = LanguageSwitcher->PrimaryLanguageId;
+	LanguageSwitcher->MarkLanguageChanged();
 	if (!SupportedLanguages.Contains(LanguageSwitcher->PrimaryLanguageId))
 	{
 		SupportedLanguages.Add(LanguageSwitcher->PrimaryLanguageId);
@@ -306,8 +393,10 @@ void URpgGameData::ParseLanguageList(const FString& InLanguages, TArray<FString>
 
 void URpgGameData::UpdateSettings()
 {
-	this->ProjectSettings = GetOne(this->ProjectSettingsList);
-	this->StartingSet = GetOne(this->StartingSets);
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(URpgGameData_UpdateSettings, CharonChannel);
+
+	this->ProjectSettings = GetOne(this->RpgGameDataProjectSettingsStore);
+	this->StartingSet = GetOne(this->StartingSetStore);
 }
 
 const TArray<UGameDataDocument*>& URpgGameData::GetAllDocuments() const
@@ -318,86 +407,26 @@ const TArray<UGameDataDocument*>& URpgGameData::GetAllDocuments() const
 	}
 
 	const auto FoundDocuments = MakeShared<TArray<UGameDataDocument*>>();
-	for (const auto DocumentById : AllProjectSettingsList)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllParameters)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllParameterValues)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllProvisions)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllHeros)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllItems)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllLocations)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllTrinkets)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllMonsters)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllLoots)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllCombatEffects)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllCurioCleansingOptions)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllCurios)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllDiseases)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllQuirks)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllConditionsList)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllWeapons)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllArmors)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllItemWithCounts)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllStartingSets)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
+	RpgGameDataProjectSettingsStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	ParameterStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	ParameterValueStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	ProvisionStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	HeroStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	ItemStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	LocationStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	TrinketStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	MonsterStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	LootStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	CombatEffectStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	CurioCleansingOptionStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	CurioStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	DiseaseStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	QuirkStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	ConditionStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	WeaponStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	ArmorStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	ItemWithCountStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	StartingSetStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
 	const_cast<URpgGameData*>(this)->AllDocuments = FoundDocuments;
 	return FoundDocuments.Get();
 }
@@ -410,97 +439,42 @@ const TArray<UGameDataDocument*>& URpgGameData::GetRootDocuments() const
 	}
 
 	const auto FoundDocuments = MakeShared<TArray<UGameDataDocument*>>();
-	for (const auto DocumentById : ProjectSettingsList)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Parameters)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : ParameterValues)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Provisions)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Heros)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Items)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Locations)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Trinkets)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Monsters)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Loots)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : CombatEffects)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : CurioCleansingOptions)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Curios)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Diseases)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Quirks)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : ConditionsList)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Weapons)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : Armors)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : ItemWithCounts)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : StartingSets)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
+	RpgGameDataProjectSettingsStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	ParameterStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	ParameterValueStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	ProvisionStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	HeroStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	ItemStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	LocationStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	TrinketStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	MonsterStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	LootStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	CombatEffectStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	CurioCleansingOptionStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	CurioStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	DiseaseStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	QuirkStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	ConditionStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	WeaponStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	ArmorStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	ItemWithCountStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	StartingSetStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
 	const_cast<URpgGameData*>(this)->RootDocuments = FoundDocuments;
 	return FoundDocuments.Get();
 }
 
 template <typename IdType, typename DocumentType>
-DocumentType* URpgGameData::GetOne(const TMap<IdType, DocumentType*>& Documents) const
+DocumentType* URpgGameData::GetOne(const TGameDataDocumentStore<IdType, DocumentType>& Documents) const
 {
-	if (Documents.Num() == 1)
+	if (Documents.NumRoots() == 1)
 	{
-        auto Iterator = Documents.CreateConstIterator();
-        return Iterator->Value;
+		for (int32 Index = 0; Index < Documents.Num(); Index++)
+		{
+			if (Documents.IsRoot(Index))
+			{
+				return Documents.GetDocuments()[Index];
+			}
+		}
 	}
 	return nullptr;
 }
@@ -508,217 +482,510 @@ DocumentType* URpgGameData::GetOne(const TMap<IdType, DocumentType*>& Documents)
 template <typename IdType, typename DocumentType>
 void URpgGameData::ToMapById(TMap<IdType, DocumentType*>& DocumentsById, TArray<DocumentType*>& Documents)
 {
+	DocumentsById.Reserve(DocumentsById.Num() + Documents.Num());
 	for (auto Document : Documents)
 	{
 		DocumentsById.FindOrAdd(Document->Id, Document);
 	}
 }
 
+static int32 URpgGameData_FindSchemaIndex(const FString& SchemaNameOrId)
+{
+	// schema name and schema id both map into schema index, FString keys are compared case-insensitively
+	static const TMap<FString, int32> SchemaIndexByNameOrId = {
+		{ TEXT("ProjectSettings"), 0 }, { TEXT("55a4f32faca22e191098f3d9"), 0 },
+		{ TEXT("Parameter"), 1 }, { TEXT("59f5b0a730bb84165c06b547"), 1 },
+		{ TEXT("ParameterValue"), 2 }, { TEXT("59f5b11030bb84165c06b54e"), 2 },
+		{ TEXT("Provision"), 3 }, { TEXT("59f5b1c830bb84165c06b556"), 3 },
+		{ TEXT("Hero"), 4 }, { TEXT("59f5b29330bb84165c06b55c"), 4 },
+		{ TEXT("Item"), 5 }, { TEXT("59f5b3f130bb84165c06b56b"), 5 },
+		{ TEXT("Location"), 6 }, { TEXT("59f5b57530bb84165c06b579"), 6 },
+		{ TEXT("Trinket"), 7 }, { TEXT("59f5b61630bb84165c06b57f"), 7 },
+		{ TEXT("Monster"), 8 }, { TEXT("59f5b7f330bb84165c06b58a"), 8 },
+		{ TEXT("Loot"), 9 }, { TEXT("59f5b9dd30bb84165c06b59a"), 9 },
+		{ TEXT("CombatEffect"), 10 }, { TEXT("59f5baaa30bb84165c06b5a0"), 10 },
+		{ TEXT("CurioCleansingOption"), 11 }, { TEXT("59f5bac130bb84165c06b5a4"), 11 },
+		{ TEXT("Curio"), 12 }, { TEXT("59f5bbc230bb84165c06b5ae"), 12 },
+		{ TEXT("Disease"), 13 }, { TEXT("59f5d3a7983a361970003662"), 13 },
+		{ TEXT("Quirk"), 14 }, { TEXT("59f5d728983a361970003684"), 14 },
+		{ TEXT("Conditions"), 15 }, { TEXT("59f5dedf983a361970003697"), 15 },
+		{ TEXT("Weapon"), 16 }, { TEXT("59f9e745983a364298db5e22"), 16 },
+		{ TEXT("Armor"), 17 }, { TEXT("59f9e7b6983a364298db5e2c"), 17 },
+		{ TEXT("ItemWithCount"), 18 }, { TEXT("5a1d78d107ff9a7b889cba7d"), 18 },
+		{ TEXT("StartingSet"), 19 }, { TEXT("5a1d78de07ff9a7b889cba83"), 19 },
+	};
+	const int32* FoundIndex = SchemaIndexByNameOrId.Find(SchemaNameOrId);
+	return FoundIndex != nullptr ? *FoundIndex : INDEX_NONE;
+}
+
+void URpgGameData::PostLoad()
+{
+	Super::PostLoad();
+
+	if (HasLegacyDocumentMaps)
+	{
+		// maps are loaded as tagged properties of older asset, documents are moved into stores
+		UE_LOG(LogURpgGameData, Log, TEXT("Game data asset '%s' is saved in older format, it should be re-saved."), *GetPathName());
+		HasLegacyDocumentMaps = false;
+		RpgGameDataProjectSettingsStore.RebuildFromIdMaps();
+		StartingSetStore.RebuildFromIdMaps();
+		ParameterStore.RebuildFromIdMaps();
+		ParameterValueStore.RebuildFromIdMaps();
+		ProvisionStore.RebuildFromIdMaps();
+		HeroStore.RebuildFromIdMaps();
+		ItemStore.RebuildFromIdMaps();
+		LocationStore.RebuildFromIdMaps();
+		TrinketStore.RebuildFromIdMaps();
+		MonsterStore.RebuildFromIdMaps();
+		LootStore.RebuildFromIdMaps();
+		CombatEffectStore.RebuildFromIdMaps();
+		CurioCleansingOptionStore.RebuildFromIdMaps();
+		CurioStore.RebuildFromIdMaps();
+		DiseaseStore.RebuildFromIdMaps();
+		QuirkStore.RebuildFromIdMaps();
+		ConditionStore.RebuildFromIdMaps();
+		WeaponStore.RebuildFromIdMaps();
+		ArmorStore.RebuildFromIdMaps();
+		ItemWithCountStore.RebuildFromIdMaps();
+	}
+	else
+	{
+		// ids are not serialized, documents are loaded by now
+		RpgGameDataProjectSettingsStore.RebuildIdMaps();
+		StartingSetStore.RebuildIdMaps();
+		ParameterStore.RebuildIdMaps();
+		ParameterValueStore.RebuildIdMaps();
+		ProvisionStore.RebuildIdMaps();
+		HeroStore.RebuildIdMaps();
+		ItemStore.RebuildIdMaps();
+		LocationStore.RebuildIdMaps();
+		TrinketStore.RebuildIdMaps();
+		MonsterStore.RebuildIdMaps();
+		LootStore.RebuildIdMaps();
+		CombatEffectStore.RebuildIdMaps();
+		CurioCleansingOptionStore.RebuildIdMaps();
+		CurioStore.RebuildIdMaps();
+		DiseaseStore.RebuildIdMaps();
+		QuirkStore.RebuildIdMaps();
+		ConditionStore.RebuildIdMaps();
+		WeaponStore.RebuildIdMaps();
+		ArmorStore.RebuildIdMaps();
+		ItemWithCountStore.RebuildIdMaps();
+	}
+	UpdateDenseCollections();
+
+	if (IndexDeclarations.Num() > 0)
+	{
+		BuildDocumentIndexes(GetAllDocuments(), TArrayView<const FGameDataDocumentIndexDeclaration>(), LanguageSwitcher != nullptr ? LanguageSwitcher->PrimaryLanguageId : FString());
+	}
+}
+
+void URpgGameData::Serialize(FArchive& Ar)
+{
+	// maps are filled from stores on load, empty maps equal class default and are not written with tagged properties
+	const bool IsSavingAsset = Ar.IsSaving() && Ar.IsPersistent() && !Ar.IsTransacting();
+	if (IsSavingAsset)
+	{
+		RpgGameDataProjectSettingsStore.DetachIdMaps();
+		StartingSetStore.DetachIdMaps();
+		ParameterStore.DetachIdMaps();
+		ParameterValueStore.DetachIdMaps();
+		ProvisionStore.DetachIdMaps();
+		HeroStore.DetachIdMaps();
+		ItemStore.DetachIdMaps();
+		LocationStore.DetachIdMaps();
+		TrinketStore.DetachIdMaps();
+		MonsterStore.DetachIdMaps();
+		LootStore.DetachIdMaps();
+		CombatEffectStore.DetachIdMaps();
+		CurioCleansingOptionStore.DetachIdMaps();
+		CurioStore.DetachIdMaps();
+		DiseaseStore.DetachIdMaps();
+		QuirkStore.DetachIdMaps();
+		ConditionStore.DetachIdMaps();
+		WeaponStore.DetachIdMaps();
+		ArmorStore.DetachIdMaps();
+		ItemWithCountStore.DetachIdMaps();
+	}
+	Super::Serialize(Ar);
+	if (IsSavingAsset)
+	{
+		RpgGameDataProjectSettingsStore.AttachIdMaps();
+		StartingSetStore.AttachIdMaps();
+		ParameterStore.AttachIdMaps();
+		ParameterValueStore.AttachIdMaps();
+		ProvisionStore.AttachIdMaps();
+		HeroStore.AttachIdMaps();
+		ItemStore.AttachIdMaps();
+		LocationStore.AttachIdMaps();
+		TrinketStore.AttachIdMaps();
+		MonsterStore.AttachIdMaps();
+		LootStore.AttachIdMaps();
+		CombatEffectStore.AttachIdMaps();
+		CurioCleansingOptionStore.AttachIdMaps();
+		CurioStore.AttachIdMaps();
+		DiseaseStore.AttachIdMaps();
+		QuirkStore.AttachIdMaps();
+		ConditionStore.AttachIdMaps();
+		WeaponStore.AttachIdMaps();
+		ArmorStore.AttachIdMaps();
+		ItemWithCountStore.AttachIdMaps();
+	}
+
+	Ar.UsingCustomVersion(FGameDataCustomVersion::GUID);
+	HasLegacyDocumentMaps = Ar.IsLoading() && Ar.CustomVer(FGameDataCustomVersion::GUID) < FGameDataCustomVersion::DocumentStores;
+	if (HasLegacyDocumentMaps)
+	{
+		return;
+	}
+
+	RpgGameDataProjectSettingsStore.Serialize(Ar);
+	StartingSetStore.Serialize(Ar);
+	ParameterStore.Serialize(Ar);
+	ParameterValueStore.Serialize(Ar);
+	ProvisionStore.Serialize(Ar);
+	HeroStore.Serialize(Ar);
+	ItemStore.Serialize(Ar);
+	LocationStore.Serialize(Ar);
+	TrinketStore.Serialize(Ar);
+	MonsterStore.Serialize(Ar);
+	LootStore.Serialize(Ar);
+	CombatEffectStore.Serialize(Ar);
+	CurioCleansingOptionStore.Serialize(Ar);
+	CurioStore.Serialize(Ar);
+	DiseaseStore.Serialize(Ar);
+	QuirkStore.Serialize(Ar);
+	ConditionStore.Serialize(Ar);
+	WeaponStore.Serialize(Ar);
+	ArmorStore.Serialize(Ar);
+	ItemWithCountStore.Serialize(Ar);
+}
+
 UGameDataDocument* URpgGameData::FindGameDataDocumentById(const FString& SchemaNameOrId, const FString& DocumentId)
 {
 	if (SchemaNameOrId.IsEmpty() || DocumentId.IsEmpty())
 	{
 		return nullptr;
 	}
-	else if (SchemaNameOrId == TEXT("ProjectSettings") || SchemaNameOrId == TEXT("55a4f32faca22e191098f3d9"))
+
+	return FindGameDataDocumentByIndex(URpgGameData_FindSchemaIndex(SchemaNameOrId), DocumentId);
+}
+
+void URpgGameData::FindGameDataDocumentsById(const TArrayView<const TPair<FString, FString>> SchemaNameAndDocumentIds, TArray<UGameDataDocument*>& OutDocuments)
+{
+	OutDocuments.Reset(SchemaNameAndDocumentIds.Num());
+
+	const FString* LastSchemaNameOrId = nullptr;
+	int32 SchemaIndex = INDEX_NONE;
+	for (const TPair<FString, FString>& SchemaNameAndDocumentId : SchemaNameAndDocumentIds)
 	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllProjectSettingsList.Find(Id);
-		if (FoundDocument != nullptr)
+		if (LastSchemaNameOrId == nullptr || !LastSchemaNameOrId->Equals(SchemaNameAndDocumentId.Key, ESearchCase::CaseSensitive))
 		{
-			return *FoundDocument;
+			LastSchemaNameOrId = &SchemaNameAndDocumentId.Key;
+			SchemaIndex = URpgGameData_FindSchemaIndex(SchemaNameAndDocumentId.Key);
 		}
+		OutDocuments.Add(SchemaNameAndDocumentId.Value.IsEmpty() ? nullptr : FindGameDataDocumentByIndex(SchemaIndex, SchemaNameAndDocumentId.Value));
 	}
-	else if (SchemaNameOrId == TEXT("Parameter") || SchemaNameOrId == TEXT("59f5b0a730bb84165c06b547"))
+}
+
+UGameDataDocument* URpgGameData::FindGameDataDocumentByIndex(const int32 SchemaIndex, const FString& DocumentId)
+{
+	switch (SchemaIndex)
 	{
-		EParameterId Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllParameters.Find(Id);
-		if (FoundDocument != nullptr)
+	case 0: // ProjectSettings
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllProjectSettingsList.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("ParameterValue") || SchemaNameOrId == TEXT("59f5b11030bb84165c06b54e"))
-	{
-		int32 Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllParameterValues.Find(Id);
-		if (FoundDocument != nullptr)
+	case 1: // Parameter
 		{
-			return *FoundDocument;
+			EParameterId Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			UParameter* FoundDocument = this->DenseAllParameters.FindRef(Id);
+			if (FoundDocument != nullptr)
+			{
+				return FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Parameter"), Id, this->ParameterStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Provision") || SchemaNameOrId == TEXT("59f5b1c830bb84165c06b556"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllProvisions.Find(Id);
-		if (FoundDocument != nullptr)
+	case 2: // ParameterValue
 		{
-			return *FoundDocument;
+			int32 Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllParameterValues.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("ParameterValue"), Id, this->ParameterValueStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Hero") || SchemaNameOrId == TEXT("59f5b29330bb84165c06b55c"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllHeros.Find(Id);
-		if (FoundDocument != nullptr)
+	case 3: // Provision
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllProvisions.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Provision"), Id, this->ProvisionStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Item") || SchemaNameOrId == TEXT("59f5b3f130bb84165c06b56b"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllItems.Find(Id);
-		if (FoundDocument != nullptr)
+	case 4: // Hero
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllHeros.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Hero"), Id, this->HeroStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Location") || SchemaNameOrId == TEXT("59f5b57530bb84165c06b579"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllLocations.Find(Id);
-		if (FoundDocument != nullptr)
+	case 5: // Item
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllItems.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Item"), Id, this->ItemStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Trinket") || SchemaNameOrId == TEXT("59f5b61630bb84165c06b57f"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllTrinkets.Find(Id);
-		if (FoundDocument != nullptr)
+	case 6: // Location
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllLocations.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Location"), Id, this->LocationStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Monster") || SchemaNameOrId == TEXT("59f5b7f330bb84165c06b58a"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllMonsters.Find(Id);
-		if (FoundDocument != nullptr)
+	case 7: // Trinket
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllTrinkets.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Trinket"), Id, this->TrinketStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Loot") || SchemaNameOrId == TEXT("59f5b9dd30bb84165c06b59a"))
-	{
-		int32 Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllLoots.Find(Id);
-		if (FoundDocument != nullptr)
+	case 8: // Monster
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllMonsters.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Monster"), Id, this->MonsterStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("CombatEffect") || SchemaNameOrId == TEXT("59f5baaa30bb84165c06b5a0"))
-	{
-		int32 Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllCombatEffects.Find(Id);
-		if (FoundDocument != nullptr)
+	case 9: // Loot
 		{
-			return *FoundDocument;
+			int32 Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllLoots.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Loot"), Id, this->LootStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("CurioCleansingOption") || SchemaNameOrId == TEXT("59f5bac130bb84165c06b5a4"))
-	{
-		int32 Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllCurioCleansingOptions.Find(Id);
-		if (FoundDocument != nullptr)
+	case 10: // CombatEffect
 		{
-			return *FoundDocument;
+			int32 Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllCombatEffects.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("CombatEffect"), Id, this->CombatEffectStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Curio") || SchemaNameOrId == TEXT("59f5bbc230bb84165c06b5ae"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllCurios.Find(Id);
-		if (FoundDocument != nullptr)
+	case 11: // CurioCleansingOption
 		{
-			return *FoundDocument;
+			int32 Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllCurioCleansingOptions.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("CurioCleansingOption"), Id, this->CurioCleansingOptionStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Disease") || SchemaNameOrId == TEXT("59f5d3a7983a361970003662"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllDiseases.Find(Id);
-		if (FoundDocument != nullptr)
+	case 12: // Curio
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllCurios.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Curio"), Id, this->CurioStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Quirk") || SchemaNameOrId == TEXT("59f5d728983a361970003684"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllQuirks.Find(Id);
-		if (FoundDocument != nullptr)
+	case 13: // Disease
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllDiseases.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Disease"), Id, this->DiseaseStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Conditions") || SchemaNameOrId == TEXT("59f5dedf983a361970003697"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllConditionsList.Find(Id);
-		if (FoundDocument != nullptr)
+	case 14: // Quirk
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllQuirks.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Quirk"), Id, this->QuirkStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Weapon") || SchemaNameOrId == TEXT("59f9e745983a364298db5e22"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllWeapons.Find(Id);
-		if (FoundDocument != nullptr)
+	case 15: // Conditions
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllConditionsList.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Conditions"), Id, this->ConditionStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Armor") || SchemaNameOrId == TEXT("59f9e7b6983a364298db5e2c"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllArmors.Find(Id);
-		if (FoundDocument != nullptr)
+	case 16: // Weapon
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllWeapons.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Weapon"), Id, this->WeaponStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("ItemWithCount") || SchemaNameOrId == TEXT("5a1d78d107ff9a7b889cba7d"))
-	{
-		int32 Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllItemWithCounts.Find(Id);
-		if (FoundDocument != nullptr)
+	case 17: // Armor
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllArmors.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("Armor"), Id, this->ArmorStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("StartingSet") || SchemaNameOrId == TEXT("5a1d78de07ff9a7b889cba83"))
-	{
-		int32 Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllStartingSets.Find(Id);
-		if (FoundDocument != nullptr)
+	case 18: // ItemWithCount
+		{
+			int32 Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllItemWithCounts.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("ItemWithCount"), Id, this->ItemWithCountStore);
+			}
+			break;
+		}
+	case 19: // StartingSet
 		{
-			return *FoundDocument;
+			int32 Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllStartingSets.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			break;
 		}
+	default:
+		break;
 	}
 	return nullptr;
 }
@@ -729,85 +996,51 @@ UClass* URpgGameData::FindDocumentSchemaClass(const FString& SchemaNameOrId)
 	{
 		return nullptr;
 	}
-	else if (SchemaNameOrId == TEXT("ProjectSettings") || SchemaNameOrId == TEXT("55a4f32faca22e191098f3d9"))
+
+	switch (URpgGameData_FindSchemaIndex(SchemaNameOrId))
 	{
+	case 0: // ProjectSettings
 		return URpgGameDataProjectSettings::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Parameter") || SchemaNameOrId == TEXT("59f5b0a730bb84165c06b547"))
-	{
+	case 1: // Parameter
 		return UParameter::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("ParameterValue") || SchemaNameOrId == TEXT("59f5b11030bb84165c06b54e"))
-	{
+	case 2: // ParameterValue
 		return UParameterValue::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Provision") || SchemaNameOrId == TEXT("59f5b1c830bb84165c06b556"))
-	{
+	case 3: // Provision
 		return UProvision::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Hero") || SchemaNameOrId == TEXT("59f5b29330bb84165c06b55c"))
-	{
+	case 4: // Hero
 		return UHero::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Item") || SchemaNameOrId == TEXT("59f5b3f130bb84165c06b56b"))
-	{
+	case 5: // Item
 		return UItem::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Location") || SchemaNameOrId == TEXT("59f5b57530bb84165c06b579"))
-	{
+	case 6: // Location
 		return ULocation::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Trinket") || SchemaNameOrId == TEXT("59f5b61630bb84165c06b57f"))
-	{
+	case 7: // Trinket
 		return UTrinket::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Monster") || SchemaNameOrId == TEXT("59f5b7f330bb84165c06b58a"))
-	{
+	case 8: // Monster
 		return UMonster::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Loot") || SchemaNameOrId == TEXT("59f5b9dd30bb84165c06b59a"))
-	{
+	case 9: // Loot
 		return ULoot::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("CombatEffect") || SchemaNameOrId == TEXT("59f5baaa30bb84165c06b5a0"))
-	{
+	case 10: // CombatEffect
 		return UCombatEffect::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("CurioCleansingOption") || SchemaNameOrId == TEXT("59f5bac130bb84165c06b5a4"))
-	{
+	case 11: // CurioCleansingOption
 		return UCurioCleansingOption::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Curio") || SchemaNameOrId == TEXT("59f5bbc230bb84165c06b5ae"))
-	{
+	case 12: // Curio
 		return UCurio::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Disease") || SchemaNameOrId == TEXT("59f5d3a7983a361970003662"))
-	{
+	case 13: // Disease
 		return UDisease::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Quirk") || SchemaNameOrId == TEXT("59f5d728983a361970003684"))
-	{
+	case 14: // Quirk
 		return UQuirk::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Conditions") || SchemaNameOrId == TEXT("59f5dedf983a361970003697"))
-	{
+	case 15: // Conditions
 		return UCondition::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Weapon") || SchemaNameOrId == TEXT("59f9e745983a364298db5e22"))
-	{
+	case 16: // Weapon
 		return UWeapon::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("Armor") || SchemaNameOrId == TEXT("59f9e7b6983a364298db5e2c"))
-	{
+	case 17: // Armor
 		return UArmor::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("ItemWithCount") || SchemaNameOrId == TEXT("5a1d78d107ff9a7b889cba7d"))
-	{
+	case 18: // ItemWithCount
 		return UItemWithCount::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("StartingSet") || SchemaNameOrId == TEXT("5a1d78de07ff9a7b889cba83"))
-	{
+	case 19: // StartingSet
 		return UStartingSet::StaticClass();
+	default:
+		break;
 	}
 	return nullptr;
 }
@@ -818,185 +1051,283 @@ void URpgGameData::GetDocumentIds(const FString& SchemaNameOrId, TArray<FString>
 	{
 		return;
 	}
-	else if (SchemaNameOrId == TEXT("ProjectSettings") || SchemaNameOrId == TEXT("55a4f32faca22e191098f3d9"))
+
+	switch (URpgGameData_FindSchemaIndex(SchemaNameOrId))
 	{
-		for (auto DocumentById : AllProjectSettingsList)
+	case 0: // ProjectSettings
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllProjectSettingsList)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Parameter") || SchemaNameOrId == TEXT("59f5b0a730bb84165c06b547"))
-	{
-		for (auto DocumentById : AllParameters)
+	case 1: // Parameter
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllParameters)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Parameter"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("ParameterValue") || SchemaNameOrId == TEXT("59f5b11030bb84165c06b54e"))
-	{
-		for (auto DocumentById : AllParameterValues)
+	case 2: // ParameterValue
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllParameterValues)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("ParameterValue"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Provision") || SchemaNameOrId == TEXT("59f5b1c830bb84165c06b556"))
-	{
-		for (auto DocumentById : AllProvisions)
+	case 3: // Provision
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllProvisions)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Provision"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Hero") || SchemaNameOrId == TEXT("59f5b29330bb84165c06b55c"))
-	{
-		for (auto DocumentById : AllHeros)
+	case 4: // Hero
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllHeros)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Hero"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Item") || SchemaNameOrId == TEXT("59f5b3f130bb84165c06b56b"))
-	{
-		for (auto DocumentById : AllItems)
+	case 5: // Item
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllItems)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Item"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Location") || SchemaNameOrId == TEXT("59f5b57530bb84165c06b579"))
-	{
-		for (auto DocumentById : AllLocations)
+	case 6: // Location
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllLocations)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Location"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Trinket") || SchemaNameOrId == TEXT("59f5b61630bb84165c06b57f"))
-	{
-		for (auto DocumentById : AllTrinkets)
+	case 7: // Trinket
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllTrinkets)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Trinket"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Monster") || SchemaNameOrId == TEXT("59f5b7f330bb84165c06b58a"))
-	{
-		for (auto DocumentById : AllMonsters)
+	case 8: // Monster
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllMonsters)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Monster"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Loot") || SchemaNameOrId == TEXT("59f5b9dd30bb84165c06b59a"))
-	{
-		for (auto DocumentById : AllLoots)
+	case 9: // Loot
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllLoots)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Loot"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("CombatEffect") || SchemaNameOrId == TEXT("59f5baaa30bb84165c06b5a0"))
-	{
-		for (auto DocumentById : AllCombatEffects)
+	case 10: // CombatEffect
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllCombatEffects)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("CombatEffect"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("CurioCleansingOption") || SchemaNameOrId == TEXT("59f5bac130bb84165c06b5a4"))
-	{
-		for (auto DocumentById : AllCurioCleansingOptions)
+	case 11: // CurioCleansingOption
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllCurioCleansingOptions)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("CurioCleansingOption"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Curio") || SchemaNameOrId == TEXT("59f5bbc230bb84165c06b5ae"))
-	{
-		for (auto DocumentById : AllCurios)
+	case 12: // Curio
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllCurios)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Curio"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Disease") || SchemaNameOrId == TEXT("59f5d3a7983a361970003662"))
-	{
-		for (auto DocumentById : AllDiseases)
+	case 13: // Disease
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllDiseases)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Disease"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Quirk") || SchemaNameOrId == TEXT("59f5d728983a361970003684"))
-	{
-		for (auto DocumentById : AllQuirks)
+	case 14: // Quirk
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllQuirks)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Quirk"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Conditions") || SchemaNameOrId == TEXT("59f5dedf983a361970003697"))
-	{
-		for (auto DocumentById : AllConditionsList)
+	case 15: // Conditions
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllConditionsList)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Conditions"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Weapon") || SchemaNameOrId == TEXT("59f9e745983a364298db5e22"))
-	{
-		for (auto DocumentById : AllWeapons)
+	case 16: // Weapon
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllWeapons)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Weapon"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("Armor") || SchemaNameOrId == TEXT("59f9e7b6983a364298db5e2c"))
-	{
-		for (auto DocumentById : AllArmors)
+	case 17: // Armor
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllArmors)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("Armor"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("ItemWithCount") || SchemaNameOrId == TEXT("5a1d78d107ff9a7b889cba7d"))
-	{
-		for (auto DocumentById : AllItemWithCounts)
+	case 18: // ItemWithCount
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllItemWithCounts)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("ItemWithCount"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("StartingSet") || SchemaNameOrId == TEXT("5a1d78de07ff9a7b889cba83"))
-	{
-		for (auto DocumentById : AllStartingSets)
+	case 19: // StartingSet
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllStartingSets)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			break;
 		}
+	default:
+		break;
 	}
 }
 
@@ -1026,8 +1357,19 @@ void URpgGameData::GetDocumentSchemaNames(TArray<FString>& AllSchemaNames)
 
 void URpgGameData::SetSupportedLanguages(const TArray<FString>& LanguageIds)
 {
+	LoadAllDocuments(); // documents created later would keep removed languages
+
 	auto LanguagesUpdateVisitor = URpgGameData::FLanguagesUpdateVisitor(LanguageIds);
 	ApplyVisitor(LanguagesUpdateVisitor);
+
+	if (LocalizedStringPool.IsValid())
+	{
+		LocalizedStringPool->RemoveLanguagesExcept(LanguageIds);
+	}
+	if (LanguageSwitcher != nullptr)
+	{
+		LanguageSwitcher->MarkLanguageChanged(); // cached texts could be of removed language
+	}
 }
 
 
@@ -1039,6 +1381,8 @@ TSharedRef<IGameDataReader> URpgGameData::CreateReader(FArchive* const GameDataS
 		return FGameDataReaderFactory::CreateJsonReader(GameDataStream);
 	case EGameDataFormat::MessagePack:
 		return FGameDataReaderFactory::CreateMessagePackReader(GameDataStream);
+	case EGameDataFormat::Compiled:
+		return FGameDataReaderFactory::CreateCompiledReader(GameDataStream);
 	default:
 		UE_LOG(LogURpgGameData, Error, TEXT("Unknown game data format specified in FGameDataLoadOptions. Fallback to JSON formatter."));
 		return FGameDataReaderFactory::CreateJsonReader(GameDataStream);
@@ -1250,8 +1594,18 @@ static void URpgGameData_SweepMarkedChildDocuments(UObject* Document)
 	}
 }
 
-bool URpgGameData::ReadGameData(const TSharedRef<IGameDataReader>& Reader)
+static void URpgGameData_SetGameDataPathTail(TArray<FString>& GameDataPath, const FStringView& PropertyName)
+{
+	// overwrite last path segment in-place to avoid string allocation per property
+	FString& PathTail = GameDataPath.Last();
+	PathTail.Reset();
+	PathTail.AppendChars(PropertyName.GetData(), PropertyName.Len());
+}
+
+bool URpgGameData::ReadGameData(const TSharedRef<IGameDataReader>& Reader, FGameDataLoadStats& LoadStats)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(URpgGameData_ReadGameData, CharonChannel);
+
 	auto GameDataPath = TArray<FString>();
 	GameDataPath.Add(TEXT(""));
 
@@ -1272,7 +1626,7 @@ bool URpgGameData::ReadGameData(const TSharedRef<IGameDataReader>& Reader)
 			return false;
 		}
 
-		auto MemberName = Reader->ReadMember();
+		const FStringView MemberName = Reader->ReadMemberView();
 		if (MemberName == TEXT("ChangeNumber"))
 		{
 			Reader->ReadValue(ChangeNumber);
@@ -1286,355 +1640,32 @@ bool URpgGameData::ReadGameData(const TSharedRef<IGameDataReader>& Reader)
 		else if (MemberName == TEXT("Collections"))
 		{
 			GameDataPath.Add(TEXT("Collections"));
-			Reader->ReadObjectBegin();
-			while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
-			{
-				if (Reader->IsError())
-				{
-					UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-					return false;
-				}
-
-				auto CollectionName = Reader->ReadMember();
-				GameDataPath.Add(CollectionName);
-				switch (CollectionName.Len())
-				{
-					case 4:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("59f5b29330bb84165c06b55c") || CollectionName == TEXT("Hero"))
-						{
-							GameDataPath.Add(TEXT("Hero"));
-							if (!ReadDocumentCollection(Reader, this->Heros, 3, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Hero"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else if (CollectionName == TEXT("59f5b3f130bb84165c06b56b") || CollectionName == TEXT("Item"))
-						{
-							GameDataPath.Add(TEXT("Item"));
-							if (!ReadDocumentCollection(Reader, this->Items, 23, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Item"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else if (CollectionName == TEXT("59f5b9dd30bb84165c06b59a") || CollectionName == TEXT("Loot"))
-						{
-							GameDataPath.Add(TEXT("Loot"));
-							if (!ReadDocumentCollection(Reader, this->Loots, 100, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Loot"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 5:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("59f5bbc230bb84165c06b5ae") || CollectionName == TEXT("Curio"))
-						{
-							GameDataPath.Add(TEXT("Curio"));
-							if (!ReadDocumentCollection(Reader, this->Curios, 5, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Curio"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else if (CollectionName == TEXT("59f5d728983a361970003684") || CollectionName == TEXT("Quirk"))
-						{
-							GameDataPath.Add(TEXT("Quirk"));
-							if (!ReadDocumentCollection(Reader, this->Quirks, 8, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Quirk"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else if (CollectionName == TEXT("59f9e7b6983a364298db5e2c") || CollectionName == TEXT("Armor"))
-						{
-							GameDataPath.Add(TEXT("Armor"));
-							if (!ReadDocumentCollection(Reader, this->Armors, 100, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Armor"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 6:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("59f9e745983a364298db5e22") || CollectionName == TEXT("Weapon"))
-						{
-							GameDataPath.Add(TEXT("Weapon"));
-							if (!ReadDocumentCollection(Reader, this->Weapons, 100, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Weapon"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 7:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("59f5b61630bb84165c06b57f") || CollectionName == TEXT("Trinket"))
-						{
-							GameDataPath.Add(TEXT("Trinket"));
-							if (!ReadDocumentCollection(Reader, this->Trinkets, 6, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Trinket"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else if (CollectionName == TEXT("59f5b7f330bb84165c06b58a") || CollectionName == TEXT("Monster"))
-						{
-							GameDataPath.Add(TEXT("Monster"));
-							if (!ReadDocumentCollection(Reader, this->Monsters, 6, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Monster"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else if (CollectionName == TEXT("59f5d3a7983a361970003662") || CollectionName == TEXT("Disease"))
-						{
-							GameDataPath.Add(TEXT("Disease"));
-							if (!ReadDocumentCollection(Reader, this->Diseases, 6, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Disease"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 8:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("59f5b57530bb84165c06b579") || CollectionName == TEXT("Location"))
-						{
-							GameDataPath.Add(TEXT("Location"));
-							if (!ReadDocumentCollection(Reader, this->Locations, 7, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Location"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 9:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("59f5b0a730bb84165c06b547") || CollectionName == TEXT("Parameter"))
-						{
-							GameDataPath.Add(TEXT("Parameter"));
-							if (!ReadDocumentCollection(Reader, this->Parameters, 39, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Parameter"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else if (CollectionName == TEXT("59f5b1c830bb84165c06b556") || CollectionName == TEXT("Provision"))
-						{
-							GameDataPath.Add(TEXT("Provision"));
-							if (!ReadDocumentCollection(Reader, this->Provisions, 10, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Provision"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 10:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("59f5dedf983a361970003697") || CollectionName == TEXT("Conditions"))
-						{
-							GameDataPath.Add(TEXT("Conditions"));
-							if (!ReadDocumentCollection(Reader, this->ConditionsList, 18, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Conditions"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 11:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("5a1d78de07ff9a7b889cba83") || CollectionName == TEXT("StartingSet"))
-						{
-							GameDataPath.Add(TEXT("StartingSet"));
-							if (!ReadDocumentCollection(Reader, this->StartingSets, 1, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("StartingSet"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 12:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("59f5baaa30bb84165c06b5a0") || CollectionName == TEXT("CombatEffect"))
-						{
-							GameDataPath.Add(TEXT("CombatEffect"));
-							if (!ReadDocumentCollection(Reader, this->CombatEffects, 100, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("CombatEffect"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 13:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("5a1d78d107ff9a7b889cba7d") || CollectionName == TEXT("ItemWithCount"))
-						{
-							GameDataPath.Add(TEXT("ItemWithCount"));
-							if (!ReadDocumentCollection(Reader, this->ItemWithCounts, 100, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("ItemWithCount"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 14:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("59f5b11030bb84165c06b54e") || CollectionName == TEXT("ParameterValue"))
-						{
-							GameDataPath.Add(TEXT("ParameterValue"));
-							if (!ReadDocumentCollection(Reader, this->ParameterValues, 100, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("ParameterValue"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 15:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("55a4f32faca22e191098f3d9") || CollectionName == TEXT("ProjectSettings"))
-						{
-							GameDataPath.Add(TEXT("ProjectSettings"));
-							if (!ReadDocumentCollection(Reader, this->ProjectSettingsList, 1, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("ProjectSettings"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 20:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("59f5bac130bb84165c06b5a4") || CollectionName == TEXT("CurioCleansingOption"))
-						{
-							GameDataPath.Add(TEXT("CurioCleansingOption"));
-							if (!ReadDocumentCollection(Reader, this->CurioCleansingOptions, 100, this, GameDataPath))
-							{
-								UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("CurioCleansingOption"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					default:
-						Reader->SkipAny();
-						break;
-				}
-			}
-			Reader->ReadObjectEnd();
+			// collections are decoded in parallel when reader is backed by in-memory buffer, see FGameDataCollectionsReader
+			// lazily loaded collections are only scanned for document ids, so they are never decoded
+			FGameDataCollectionsReader CollectionsReader(Reader, LazyDocuments.IsValid() ? MAX_int64 : FGameDataCollectionsReader::DEFAULT_MIN_PARALLEL_SIZE);
+			CollectionsReader.ReadBegin();
+			FStringView CollectionName;
+			while (CollectionsReader.ReadNextCollection(CollectionName))
+			{
+				GameDataPath.Emplace(CollectionName);
+				LoadStats.BeginCollection(CollectionName, CollectionsReader.GetCollectionSize(), ReadDocumentCount, ReadReferenceCount);
+				bool bReadSuccess;
+				{
+					TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*GameDataPath.Last(), CharonChannel);
+					bReadSuccess = ReadCollection(CollectionsReader.GetCollectionReader(), CollectionName, GameDataPath);
+				}
+				LoadStats.EndCollection(ReadDocumentCount, ReadReferenceCount);
+				if (!bReadSuccess)
+				{
+					return false;
+				}
+				GameDataPath.Pop();
+			}
+			if (CollectionsReader.IsError())
+			{
+				UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *CollectionsReader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+				return false;
+			}
 			GameDataPath.Pop();
 			break;
 		}
@@ -1643,6 +1674,12 @@ bool URpgGameData::ReadGameData(const TSharedRef<IGameDataReader>& Reader)
 			Reader->SkipAny();
 		}
 	}
+
+	if (PatchIndex.IsValid() && !ReadPatchedCollections(GameDataPath))
+	{
+		return false;
+	}
+
 	Reader->ReadObjectEnd();
 	GameDataPath.Pop();
 
@@ -1658,589 +1695,655 @@ bool URpgGameData::ReadGameData(const TSharedRef<IGameDataReader>& Reader)
 	return true;
 }
 
-bool URpgGameData::ReadDocument
-(
-	const TSharedRef<IGameDataReader>& Reader,
-	URpgGameDataProjectSettings*& Document,
-	UObject* Outer,
-	TArray<FString>& GameDataPath,
-	bool NextToken
-)
+bool URpgGameData::ReadPatchedCollections(TArray<FString>& GameDataPath)
 {
-	Document = NewObject<URpgGameDataProjectSettings>(Outer, URpgGameDataProjectSettings::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
-	Outer = Document;
+	if (PatchIndex->GetChangeNumber().IsSet())
+	{
+		ChangeNumber = PatchIndex->GetChangeNumber().GetValue();
+	}
+	if (PatchIndex->GetRevisionHash().IsSet())
+	{
+		RevisionHash = PatchIndex->GetRevisionHash().GetValue();
+	}
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	// collections which are only in patches are read as empty ones, patched documents are added by ReadPatchedDocumentCollection
+	TArray<FString> SchemaNames;
+	PatchIndex->GetSchemaNames(SchemaNames);
+	GameDataPath.Add(TEXT("Collections"));
+	for (const FString& SchemaName : SchemaNames)
 	{
-		if (Reader->IsError())
+		const auto EmptyCollections = MakeShared<FJsonObject>();
+		EmptyCollections->SetArrayField(SchemaName, TArray<TSharedPtr<FJsonValue>>());
+		const TSharedRef<IGameDataReader> CollectionReader = FGameDataReaderFactory::CreateJsonObjectReader(EmptyCollections);
+		CollectionReader->ReadNext(); // initialize reader and move to first token
+		CollectionReader->ReadObjectBegin();
+
+		GameDataPath.Add(SchemaName);
+		if (!ReadCollection(CollectionReader, SchemaName, GameDataPath))
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
+		GameDataPath.Pop();
+	}
+	GameDataPath.Pop();
 
-		auto PropertyName = Reader->ReadMember();
-		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
+	return true;
+}
+
+bool URpgGameData::ReadCollection(const TSharedRef<IGameDataReader>& Reader, const FStringView CollectionName, TArray<FString>& GameDataPath)
+{
+	// documents are read with statically bound reader when its type is known, see TGameDataReader
+	return FGameDataReaderDispatch::Visit(*Reader, [&](auto& TypedReader)
+	{
+		return ReadCollection(TypedReader, CollectionName, GameDataPath);
+	});
+}
+
+template <typename ReaderType>
+bool URpgGameData::ReadCollection(ReaderType& Reader, const FStringView CollectionName, TArray<FString>& GameDataPath)
+{
+	switch (CollectionName.Len())
+	{
+		case 4:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("59f5b29330bb84165c06b55c") || CollectionName == TEXT("Hero"))
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("Hero"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Hero"), this->HeroStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->HeroStore, 3, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Hero"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			URpgGameDataProjectSettings* ExistingDocument = Cast<URpgGameDataProjectSettings>(ExistingObject);
-			if (ExistingDocument)
+			else if (CollectionName == TEXT("59f5b3f130bb84165c06b56b") || CollectionName == TEXT("Item"))
 			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->Name = Document->Name;
-				ExistingDocument->PrimaryLanguage = Document->PrimaryLanguage;
-				ExistingDocument->Languages = Document->Languages;
-				ExistingDocument->Copyright = Document->Copyright;
-				ExistingDocument->Version = Document->Version;
-				ExistingDocument->Extensions = Document->Extensions;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				GameDataPath.Add(TEXT("Item"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Item"), this->ItemStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->ItemStore, 23, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Item"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			else if (ExistingObject)
+			else if (CollectionName == TEXT("59f5b9dd30bb84165c06b59a") || CollectionName == TEXT("Loot"))
 			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				GameDataPath.Add(TEXT("Loot"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Loot"), this->LootStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->LootStore, 100, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Loot"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
 			else
 			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("Name"))
-		{
-			if (Reader->IsNull())
+			break;
+		case 5:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Name) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("59f5bbc230bb84165c06b5ae") || CollectionName == TEXT("Curio"))
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("Curio"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Curio"), this->CurioStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->CurioStore, 5, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Curio"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-		}
-		else if (PropertyName == TEXT("PrimaryLanguage"))
-		{
-			if (Reader->IsNull())
+			else if (CollectionName == TEXT("59f5d728983a361970003684") || CollectionName == TEXT("Quirk"))
 			{
-				Reader->ReadNext();
-				continue;
+				GameDataPath.Add(TEXT("Quirk"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Quirk"), this->QuirkStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->QuirkStore, 8, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Quirk"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			bReadSuccess = Reader->ReadValue(Document->PrimaryLanguage) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("59f9e7b6983a364298db5e2c") || CollectionName == TEXT("Armor"))
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.PrimaryLanguage"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("Armor"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Armor"), this->ArmorStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->ArmorStore, 100, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Armor"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-		}
-		else if (PropertyName == TEXT("Languages"))
-		{
-			if (Reader->IsNull())
+			else
 			{
-				Reader->ReadNext();
-				continue;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Languages) && Reader->ReadNext();
-			if (!bReadSuccess)
+			break;
+		case 6:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Languages"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("Copyright"))
-		{
-			if (Reader->IsNull())
+			else if (CollectionName == TEXT("59f9e745983a364298db5e22") || CollectionName == TEXT("Weapon"))
 			{
-				Reader->ReadNext();
-				continue;
+				GameDataPath.Add(TEXT("Weapon"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Weapon"), this->WeaponStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->WeaponStore, 100, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Weapon"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Copyright) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Copyright"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("Version"))
-		{
-			if (Reader->IsNull())
+			break;
+		case 7:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Version"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Version) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("59f5b61630bb84165c06b57f") || CollectionName == TEXT("Trinket"))
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Version"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("Trinket"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Trinket"), this->TrinketStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->TrinketStore, 6, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Trinket"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-		}
-		else if (PropertyName == TEXT("Extensions"))
-		{
-			if (Reader->IsNull())
+			else if (CollectionName == TEXT("59f5b7f330bb84165c06b58a") || CollectionName == TEXT("Monster"))
 			{
-				Reader->ReadNext();
-				continue;
+				GameDataPath.Add(TEXT("Monster"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Monster"), this->MonsterStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->MonsterStore, 6, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Monster"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Extensions) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("59f5d3a7983a361970003662") || CollectionName == TEXT("Disease"))
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Extensions"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("Disease"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Disease"), this->DiseaseStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->DiseaseStore, 6, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Disease"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
-	}
-	Reader->ReadObjectEnd(NextToken);
-
-	if (Reader->IsError())
-	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-		return false;
-	}
-
-
-	URpgGameData_SweepMarkedChildDocuments(Document);
-
-	return true;
-}
-bool URpgGameData::ReadDocument
-(
-	const TSharedRef<IGameDataReader>& Reader,
-	UParameter*& Document,
-	UObject* Outer,
-	TArray<FString>& GameDataPath,
-	bool NextToken
-)
-{
-	Document = NewObject<UParameter>(Outer, UParameter::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
-	Outer = Document;
-
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
-	{
-		if (Reader->IsError())
-		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-			return false;
-		}
-
-		auto PropertyName = Reader->ReadMember();
-		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
+			else
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Parameter.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+			break;
+		case 8:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Parameter.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UParameter* ExistingDocument = Cast<UParameter>(ExistingObject);
-			if (ExistingDocument)
+			else if (CollectionName == TEXT("59f5b57530bb84165c06b579") || CollectionName == TEXT("Location"))
 			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->MinValue = Document->MinValue;
-				ExistingDocument->MaxValue = Document->MaxValue;
-				ExistingDocument->MinValueParameterRaw = Document->MinValueParameterRaw;
-				ExistingDocument->MaxValueParameterRaw = Document->MaxValueParameterRaw;
-				ExistingDocument->ValueKind = Document->ValueKind;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				GameDataPath.Add(TEXT("Location"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Location"), this->LocationStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->LocationStore, 7, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Location"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			else if (ExistingObject)
+			else
 			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				Reader.SkipAny();
 			}
-			else
+			break;
+		case 9:
+			if (CollectionName.IsEmpty())
 			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("MinValue"))
-		{
-			if (Reader->IsNull())
+			else if (CollectionName == TEXT("59f5b0a730bb84165c06b547") || CollectionName == TEXT("Parameter"))
 			{
-				Reader->ReadNext();
-				continue;
+				GameDataPath.Add(TEXT("Parameter"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Parameter"), this->ParameterStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->ParameterStore, 39, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Parameter"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			bReadSuccess = Reader->ReadValue(Document->MinValue) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("59f5b1c830bb84165c06b556") || CollectionName == TEXT("Provision"))
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Parameter.MinValue"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("Provision"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Provision"), this->ProvisionStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->ProvisionStore, 10, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Provision"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-		}
-		else if (PropertyName == TEXT("MaxValue"))
-		{
-			if (Reader->IsNull())
+			else
 			{
-				Reader->ReadNext();
-				continue;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->MaxValue) && Reader->ReadNext();
-			if (!bReadSuccess)
+			break;
+		case 10:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Parameter.MaxValue"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("MinValueParameter"))
-		{
-			if (Reader->IsNull())
+			else if (CollectionName == TEXT("59f5dedf983a361970003697") || CollectionName == TEXT("Conditions"))
 			{
-				Reader->ReadNext();
-				continue;
+				GameDataPath.Add(TEXT("Conditions"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("Conditions"), this->ConditionStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->ConditionStore, 18, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("Conditions"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			bReadSuccess = ReadDocumentReference(Reader, Document->MinValueParameterRaw, TEXT("Parameter"), GameDataPath);
-			if (!bReadSuccess)
+			else
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Parameter.MinValueParameter"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("MaxValueParameter"))
-		{
-			if (Reader->IsNull())
+			break;
+		case 11:
+			if (CollectionName.IsEmpty())
 			{
-				Reader->ReadNext();
-				continue;
+				Reader.SkipAny();
 			}
-			bReadSuccess = ReadDocumentReference(Reader, Document->MaxValueParameterRaw, TEXT("Parameter"), GameDataPath);
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("5a1d78de07ff9a7b889cba83") || CollectionName == TEXT("StartingSet"))
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Parameter.MaxValueParameter"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("StartingSet"));
+				if (!ReadDocumentCollection(Reader, this->StartingSetStore, 1, GameDataPath))
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("StartingSet"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-		}
-		else if (PropertyName == TEXT("ValueKind"))
-		{
-			if (Reader->IsNull())
+			else
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Parameter.ValueKind"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->ValueKind) && Reader->ReadNext();
-			if (!bReadSuccess)
+			break;
+		case 12:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Parameter.ValueKind"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
-	}
-	Reader->ReadObjectEnd(NextToken);
-
-	if (Reader->IsError())
-	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-		return false;
-	}
-
-
-	URpgGameData_SweepMarkedChildDocuments(Document);
-
-	return true;
-}
-bool URpgGameData::ReadDocument
-(
-	const TSharedRef<IGameDataReader>& Reader,
-	UParameterValue*& Document,
-	UObject* Outer,
-	TArray<FString>& GameDataPath,
-	bool NextToken
-)
-{
-	Document = NewObject<UParameterValue>(Outer, UParameterValue::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
-	Outer = Document;
-
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
-	{
-		if (Reader->IsError())
-		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-			return false;
-		}
-
-		auto PropertyName = Reader->ReadMember();
-		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
+			else if (CollectionName == TEXT("59f5baaa30bb84165c06b5a0") || CollectionName == TEXT("CombatEffect"))
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("CombatEffect"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("CombatEffect"), this->CombatEffectStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->CombatEffectStore, 100, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("CombatEffect"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UParameterValue* ExistingDocument = Cast<UParameterValue>(ExistingObject);
-			if (ExistingDocument)
+			break;
+		case 13:
+			if (CollectionName.IsEmpty())
 			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->ParameterRaw = Document->ParameterRaw;
-				ExistingDocument->Value = Document->Value;
-				ExistingDocument->ConditionRaw = Document->ConditionRaw;
-				ExistingDocument->EffectTags = Document->EffectTags;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				Reader.SkipAny();
 			}
-			else if (ExistingObject)
+			else if (CollectionName == TEXT("5a1d78d107ff9a7b889cba7d") || CollectionName == TEXT("ItemWithCount"))
 			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				GameDataPath.Add(TEXT("ItemWithCount"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("ItemWithCount"), this->ItemWithCountStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->ItemWithCountStore, 100, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("ItemWithCount"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
 			else
 			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("Parameter"))
-		{
-			if (Reader->IsNull())
+			break;
+		case 14:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Parameter"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-			bReadSuccess = ReadDocumentReference(Reader, Document->ParameterRaw, TEXT("Parameter"), GameDataPath);
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("59f5b11030bb84165c06b54e") || CollectionName == TEXT("ParameterValue"))
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Parameter"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("ParameterValue"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("ParameterValue"), this->ParameterValueStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->ParameterValueStore, 100, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("ParameterValue"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-		}
-		else if (PropertyName == TEXT("Value"))
-		{
-			if (Reader->IsNull())
+			else
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Value"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Value) && Reader->ReadNext();
-			if (!bReadSuccess)
+			break;
+		case 15:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Value"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("Condition"))
-		{
-			if (Reader->IsNull())
+			else if (CollectionName == TEXT("55a4f32faca22e191098f3d9") || CollectionName == TEXT("ProjectSettings"))
 			{
-				Reader->ReadNext();
-				continue;
+				GameDataPath.Add(TEXT("ProjectSettings"));
+				if (!ReadDocumentCollection(Reader, this->RpgGameDataProjectSettingsStore, 1, GameDataPath))
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("ProjectSettings"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			bReadSuccess = ReadDocumentReference(Reader, Document->ConditionRaw, TEXT("Conditions"), GameDataPath);
-			if (!bReadSuccess)
+			else
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Condition"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("EffectTags"))
-		{
-			if (Reader->IsNull())
+			break;
+		case 20:
+			if (CollectionName.IsEmpty())
 			{
-				Reader->ReadNext();
-				continue;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->EffectTags) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("59f5bac130bb84165c06b5a4") || CollectionName == TEXT("CurioCleansingOption"))
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ParameterValue.EffectTags"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("CurioCleansingOption"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("CurioCleansingOption"), this->CurioCleansingOptionStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->CurioCleansingOptionStore, 100, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("CurioCleansingOption"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
-	}
-	Reader->ReadObjectEnd(NextToken);
-
-	if (Reader->IsError())
-	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-		return false;
+			else
+			{
+				Reader.SkipAny();
+			}
+			break;
+		default:
+			Reader.SkipAny();
+			break;
 	}
-
-
-	URpgGameData_SweepMarkedChildDocuments(Document);
-
 	return true;
 }
+
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UProvision*& Document,
+	ReaderType& Reader,
+	URpgGameDataProjectSettings*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UProvision>(Outer, UProvision::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<URpgGameDataProjectSettings>(Outer, URpgGameDataProjectSettings::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Provision.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Provision.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UProvision* ExistingDocument = Cast<UProvision>(ExistingObject);
-			if (ExistingDocument)
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->Cost = Document->Cost;
-				ExistingDocument->Item = Document->Item;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				URpgGameDataProjectSettings* ExistingDocument = Cast<URpgGameDataProjectSettings>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->Name = Document->Name;
+					ExistingDocument->PrimaryLanguage = Document->PrimaryLanguage;
+					ExistingDocument->Languages = Document->Languages;
+					ExistingDocument->Copyright = Document->Copyright;
+					ExistingDocument->Version = Document->Version;
+					ExistingDocument->Extensions = Document->Extensions;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			else if (ExistingObject)
+		case FGameDataMemberNameHash::Of(TEXT("Name")):
 			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Name) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else
+		case FGameDataMemberNameHash::Of(TEXT("PrimaryLanguage")):
 			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("PrimaryLanguage"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->PrimaryLanguage) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.PrimaryLanguage"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Cost"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Languages")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Provision.Cost"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Languages"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Languages) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Languages"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Cost) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Copyright")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Provision.Cost"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Copyright"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Copyright) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Copyright"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Item"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Version")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Provision.Item"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Version"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Version"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Version) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Version"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocument(Reader, Document->Item, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Extensions")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Provision.Item"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Extensions"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Extensions) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Extensions"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -2249,412 +2352,502 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UHero*& Document,
+	ReaderType& Reader,
+	UParameter*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UHero>(Outer, UHero::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<UParameter>(Outer, UParameter::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UHero* ExistingDocument = Cast<UHero>(ExistingObject);
-			if (ExistingDocument)
-			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->NameRaw = Document->NameRaw;
-				ExistingDocument->BioRaw = Document->BioRaw;
-				ExistingDocument->Religious = Document->Religious;
-				ExistingDocument->DislikeHeroesRaw = Document->DislikeHeroesRaw;
-				ExistingDocument->ProvisionsRaw = Document->ProvisionsRaw;
-				ExistingDocument->ProvisionsCount = Document->ProvisionsCount;
-				ExistingDocument->MovementForward = Document->MovementForward;
-				ExistingDocument->MovementBackward = Document->MovementBackward;
-				ExistingDocument->Protection = Document->Protection;
-				ExistingDocument->AccuracyModifier = Document->AccuracyModifier;
-				ExistingDocument->StunResistance = Document->StunResistance;
-				ExistingDocument->BlightResistance = Document->BlightResistance;
-				ExistingDocument->DiseaseResistance = Document->DiseaseResistance;
-				ExistingDocument->DeathBlowResistance = Document->DeathBlowResistance;
-				ExistingDocument->MoveResistance = Document->MoveResistance;
-				ExistingDocument->BleedResistance = Document->BleedResistance;
-				ExistingDocument->DebuffResistance = Document->DebuffResistance;
-				ExistingDocument->TrapResistance = Document->TrapResistance;
-				ExistingDocument->Armors = Document->Armors;
-				ExistingDocument->Weapons = Document->Weapons;
-				ExistingDocument->Picture = Document->Picture;
-				ExistingDocument->PictureBounds = Document->PictureBounds;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Parameter.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Parameter.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UParameter* ExistingDocument = Cast<UParameter>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->MinValue = Document->MinValue;
+					ExistingDocument->MaxValue = Document->MaxValue;
+					ExistingDocument->MinValueParameterRaw = Document->MinValueParameterRaw;
+					ExistingDocument->MaxValueParameterRaw = Document->MaxValueParameterRaw;
+					ExistingDocument->ValueKind = Document->ValueKind;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			else
+		case FGameDataMemberNameHash::Of(TEXT("MinValue")):
 			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("MinValue"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->MinValue) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Parameter.MinValue"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Name"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("MaxValue")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("MaxValue"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->MaxValue) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Parameter.MaxValue"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("MinValueParameter")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("MinValueParameter"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocumentReference(Reader, Document->MinValueParameterRaw, TEXT("Parameter"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Parameter.MinValueParameter"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Bio"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("MaxValueParameter")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Bio"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("MaxValueParameter"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocumentReference(Reader, Document->MaxValueParameterRaw, TEXT("Parameter"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Parameter.MaxValueParameter"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->BioRaw, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("ValueKind")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Bio"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("ValueKind"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Parameter.ValueKind"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->ValueKind) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Parameter.ValueKind"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else if (PropertyName == TEXT("Religious"))
+	}
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		return false;
+	}
+
+
+	URpgGameData_SweepMarkedChildDocuments(Document);
+
+	return true;
+}
+template <typename ReaderType>
+bool URpgGameData::ReadDocument
+(
+	ReaderType& Reader,
+	UParameterValue*& Document,
+	UObject* Outer,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	Document = NewObject<UParameterValue>(Outer, UParameterValue::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
+	Outer = Document;
+
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
+	{
+		if (Reader.IsError())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Religious"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Religious) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Religious"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			return false;
 		}
-		else if (PropertyName == TEXT("DislikeHeroes"))
+
+		const FStringView PropertyName = Reader.ReadMemberView();
+		bool bReadSuccess;
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.DislikeHeroes"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UParameterValue* ExistingDocument = Cast<UParameterValue>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->ParameterRaw = Document->ParameterRaw;
+					ExistingDocument->Value = Document->Value;
+					ExistingDocument->ConditionRaw = Document->ConditionRaw;
+					ExistingDocument->EffectTags = Document->EffectTags;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentReferenceCollection(Reader, Document->DislikeHeroesRaw, TEXT("Hero"), GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Parameter")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.DislikeHeroes"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Parameter"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Parameter"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentReference(Reader, Document->ParameterRaw, TEXT("Parameter"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Parameter"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Provisions"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = ReadDocumentReference(Reader, Document->ProvisionsRaw, TEXT("Provision"), GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Provisions"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("ProvisionsCount"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.ProvisionsCount"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->ProvisionsCount) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.ProvisionsCount"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("MovementForward"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.MovementForward"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->MovementForward) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.MovementForward"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("MovementBackward"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.MovementBackward"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->MovementBackward) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.MovementBackward"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Protection"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Protection"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Protection) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Protection"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("AccuracyModifier"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.AccuracyModifier"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->AccuracyModifier) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.AccuracyModifier"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("StunResistance"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.StunResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->StunResistance) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.StunResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("BlightResistance"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.BlightResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->BlightResistance) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.BlightResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("DiseaseResistance"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.DiseaseResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->DiseaseResistance) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.DiseaseResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("DeathBlowResistance"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.DeathBlowResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->DeathBlowResistance) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.DeathBlowResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("MoveResistance"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.MoveResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->MoveResistance) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.MoveResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("BleedResistance"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.BleedResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->BleedResistance) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.BleedResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("DebuffResistance"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.DebuffResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->DebuffResistance) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.DebuffResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("TrapResistance"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.TrapResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->TrapResistance) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Value")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.TrapResistance"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Value"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Value"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Value) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Value"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Armors"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Condition")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Armors"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Condition"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocumentReference(Reader, Document->ConditionRaw, TEXT("Conditions"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ParameterValue.Condition"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->Armors, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("EffectTags")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Armors"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("EffectTags"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->EffectTags) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ParameterValue.EffectTags"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else if (PropertyName == TEXT("Weapons"))
+	}
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		return false;
+	}
+
+
+	URpgGameData_SweepMarkedChildDocuments(Document);
+
+	return true;
+}
+template <typename ReaderType>
+bool URpgGameData::ReadDocument
+(
+	ReaderType& Reader,
+	UProvision*& Document,
+	UObject* Outer,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	Document = NewObject<UProvision>(Outer, UProvision::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
+	Outer = Document;
+
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
+	{
+		if (Reader.IsError())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Weapons"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->Weapons, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Weapons"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			return false;
 		}
-		else if (PropertyName == TEXT("Picture"))
+
+		const FStringView PropertyName = Reader.ReadMemberView();
+		bool bReadSuccess;
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Picture) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Picture"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Provision.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Provision.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UProvision* ExistingDocument = Cast<UProvision>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->Cost = Document->Cost;
+					ExistingDocument->Item = Document->Item;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("PictureBounds"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Cost")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.PictureBounds"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Cost"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Provision.Cost"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Cost) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Provision.Cost"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->PictureBounds) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Item")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.PictureBounds"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Item"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Provision.Item"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocument(Reader, Document->Item, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Provision.Item"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -2663,271 +2856,551 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UItem*& Document,
+	ReaderType& Reader,
+	UHero*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UItem>(Outer, UItem::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<UHero>(Outer, UHero::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Item.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UHero* ExistingDocument = Cast<UHero>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->NameRaw = Document->NameRaw;
+					ExistingDocument->BioRaw = Document->BioRaw;
+					ExistingDocument->Religious = Document->Religious;
+					ExistingDocument->DislikeHeroesRaw = Document->DislikeHeroesRaw;
+					ExistingDocument->ProvisionsRaw = Document->ProvisionsRaw;
+					ExistingDocument->ProvisionsCount = Document->ProvisionsCount;
+					ExistingDocument->MovementForward = Document->MovementForward;
+					ExistingDocument->MovementBackward = Document->MovementBackward;
+					ExistingDocument->Protection = Document->Protection;
+					ExistingDocument->AccuracyModifier = Document->AccuracyModifier;
+					ExistingDocument->StunResistance = Document->StunResistance;
+					ExistingDocument->BlightResistance = Document->BlightResistance;
+					ExistingDocument->DiseaseResistance = Document->DiseaseResistance;
+					ExistingDocument->DeathBlowResistance = Document->DeathBlowResistance;
+					ExistingDocument->MoveResistance = Document->MoveResistance;
+					ExistingDocument->BleedResistance = Document->BleedResistance;
+					ExistingDocument->DebuffResistance = Document->DebuffResistance;
+					ExistingDocument->TrapResistance = Document->TrapResistance;
+					ExistingDocument->Armors = Document->Armors;
+					ExistingDocument->Weapons = Document->Weapons;
+					ExistingDocument->Picture = Document->Picture;
+					ExistingDocument->PictureBounds = Document->PictureBounds;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Name")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Item.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UItem* ExistingDocument = Cast<UItem>(ExistingObject);
-			if (ExistingDocument)
+		case FGameDataMemberNameHash::Of(TEXT("Bio")):
 			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->NameRaw = Document->NameRaw;
-				ExistingDocument->DescriptionRaw = Document->DescriptionRaw;
-				ExistingDocument->StackSize = Document->StackSize;
-				ExistingDocument->GoldValue = Document->GoldValue;
-				ExistingDocument->ActivationEffects = Document->ActivationEffects;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Bio"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Bio"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->BioRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Bio"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else
+		case FGameDataMemberNameHash::Of(TEXT("Religious")):
 			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Religious"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Religious"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Religious) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Religious"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Name"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("DislikeHeroes")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Item.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("DislikeHeroes"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.DislikeHeroes"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentReferenceCollection(Reader, Document->DislikeHeroesRaw, TEXT("Hero"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.DislikeHeroes"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Provisions")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Item.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Provisions"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocumentReference(Reader, Document->ProvisionsRaw, TEXT("Provision"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Provisions"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Description"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("ProvisionsCount")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("ProvisionsCount"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.ProvisionsCount"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->ProvisionsCount) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.ProvisionsCount"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->DescriptionRaw, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("MovementForward")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Item.Description"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("MovementForward"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.MovementForward"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->MovementForward) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.MovementForward"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("StackSize"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("MovementBackward")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Item.StackSize"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("MovementBackward"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.MovementBackward"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->MovementBackward) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.MovementBackward"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->StackSize) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Protection")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Item.StackSize"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Protection"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Protection"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Protection) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Protection"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("GoldValue"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("AccuracyModifier")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Item.GoldValue"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("AccuracyModifier"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.AccuracyModifier"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->AccuracyModifier) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.AccuracyModifier"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->GoldValue) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("StunResistance")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Item.GoldValue"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("StunResistance"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.StunResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->StunResistance) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.StunResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("ActivationEffects"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("BlightResistance")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Item.ActivationEffects"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("BlightResistance"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.BlightResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->BlightResistance) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.BlightResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->ActivationEffects, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("DiseaseResistance")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Item.ActivationEffects"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("DiseaseResistance"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.DiseaseResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->DiseaseResistance) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.DiseaseResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
-	}
-	Reader->ReadObjectEnd(NextToken);
-
-	if (Reader->IsError())
-	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-		return false;
-	}
-
-
-	URpgGameData_SweepMarkedChildDocuments(Document);
-
-	return true;
-}
-bool URpgGameData::ReadDocument
-(
-	const TSharedRef<IGameDataReader>& Reader,
-	ULocation*& Document,
-	UObject* Outer,
-	TArray<FString>& GameDataPath,
-	bool NextToken
-)
-{
-	Document = NewObject<ULocation>(Outer, ULocation::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
-	Outer = Document;
-
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
-	{
-		if (Reader->IsError())
-		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-			return false;
-		}
-
-		auto PropertyName = Reader->ReadMember();
-		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("DeathBlowResistance")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Location.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("DeathBlowResistance"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.DeathBlowResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->DeathBlowResistance) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.DeathBlowResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("MoveResistance")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Location.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("MoveResistance"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.MoveResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->MoveResistance) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.MoveResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			ULocation* ExistingDocument = Cast<ULocation>(ExistingObject);
-			if (ExistingDocument)
+		case FGameDataMemberNameHash::Of(TEXT("BleedResistance")):
 			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->NameRaw = Document->NameRaw;
-				ExistingDocument->Flags = Document->Flags;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				if (!PropertyName.Equals(TEXT("BleedResistance"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.BleedResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->BleedResistance) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.BleedResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else if (ExistingObject)
+		case FGameDataMemberNameHash::Of(TEXT("DebuffResistance")):
 			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("DebuffResistance"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.DebuffResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->DebuffResistance) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.DebuffResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else
+		case FGameDataMemberNameHash::Of(TEXT("TrapResistance")):
 			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("TrapResistance"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.TrapResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->TrapResistance) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.TrapResistance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Name"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Armors")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Location.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Armors"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Armors"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->Armors, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Armors"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Weapons")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Location.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Weapons"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.Weapons"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->Weapons, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Weapons"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Flags"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Picture")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("Picture"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Picture) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.Picture"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Flags) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("PictureBounds")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Location.Flags"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("PictureBounds"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Hero.PictureBounds"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->PictureBounds) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Hero.PictureBounds"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -2936,157 +3409,194 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UTrinket*& Document,
+	ReaderType& Reader,
+	UItem*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UTrinket>(Outer, UTrinket::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<UItem>(Outer, UItem::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Trinket.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Trinket.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UTrinket* ExistingDocument = Cast<UTrinket>(ExistingObject);
-			if (ExistingDocument)
-			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->Rarity = Document->Rarity;
-				ExistingDocument->OriginDungeonRaw = Document->OriginDungeonRaw;
-				ExistingDocument->HeroRestrictionRaw = Document->HeroRestrictionRaw;
-				ExistingDocument->Item = Document->Item;
-				ExistingDocument->Effects = Document->Effects;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("Rarity"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Trinket.Rarity"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Rarity) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Trinket.Rarity"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("OriginDungeon"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = ReadDocumentReference(Reader, Document->OriginDungeonRaw, TEXT("Location"), GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Trinket.OriginDungeon"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("HeroRestriction"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Item.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Item.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UItem* ExistingDocument = Cast<UItem>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->NameRaw = Document->NameRaw;
+					ExistingDocument->DescriptionRaw = Document->DescriptionRaw;
+					ExistingDocument->StackSize = Document->StackSize;
+					ExistingDocument->GoldValue = Document->GoldValue;
+					ExistingDocument->ActivationEffects = Document->ActivationEffects;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentReference(Reader, Document->HeroRestrictionRaw, TEXT("Hero"), GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Name")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Trinket.HeroRestriction"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Item.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Item.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Item"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Description")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Trinket.Item"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Description"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->DescriptionRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Item.Description"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocument(Reader, Document->Item, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("StackSize")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Trinket.Item"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("StackSize"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Item.StackSize"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->StackSize) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Item.StackSize"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Effects"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("GoldValue")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Trinket.Effects"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("GoldValue"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Item.GoldValue"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->GoldValue) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Item.GoldValue"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->Effects, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("ActivationEffects")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Trinket.Effects"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("ActivationEffects"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Item.ActivationEffects"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->ActivationEffects, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Item.ActivationEffects"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -3095,157 +3605,131 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UMonster*& Document,
+	ReaderType& Reader,
+	ULocation*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UMonster>(Outer, UMonster::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<ULocation>(Outer, ULocation::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Monster.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Monster.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UMonster* ExistingDocument = Cast<UMonster>(ExistingObject);
-			if (ExistingDocument)
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->NameRaw = Document->NameRaw;
-				ExistingDocument->Type = Document->Type;
-				ExistingDocument->SecondType = Document->SecondType;
-				ExistingDocument->Parameters = Document->Parameters;
-				ExistingDocument->LocationsRaw = Document->LocationsRaw;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Location.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Location.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				ULocation* ExistingDocument = Cast<ULocation>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->NameRaw = Document->NameRaw;
+					ExistingDocument->Flags = Document->Flags;
 
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
 
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("Name"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Monster.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Monster.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Type"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Monster.Type"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Type) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Monster.Type"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("SecondType"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->SecondType) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Monster.SecondType"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Parameters"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Monster.Parameters"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->Parameters, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Monster.Parameters"), *CombineGameDataPath(GameDataPath));
-				return false;
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Locations"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Name")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Monster.Locations"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Location.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Location.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentReferenceCollection(Reader, Document->LocationsRaw, TEXT("Location"), GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Flags")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Monster.Locations"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Flags"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Flags) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Location.Flags"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -3254,112 +3738,194 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	ULoot*& Document,
+	ReaderType& Reader,
+	UTrinket*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<ULoot>(Outer, ULoot::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<UTrinket>(Outer, UTrinket::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Loot.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Trinket.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Trinket.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UTrinket* ExistingDocument = Cast<UTrinket>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->Rarity = Document->Rarity;
+					ExistingDocument->OriginDungeonRaw = Document->OriginDungeonRaw;
+					ExistingDocument->HeroRestrictionRaw = Document->HeroRestrictionRaw;
+					ExistingDocument->Item = Document->Item;
+					ExistingDocument->Effects = Document->Effects;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Rarity")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Loot.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Rarity"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Trinket.Rarity"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Rarity) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Trinket.Rarity"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			ULoot* ExistingDocument = Cast<ULoot>(ExistingObject);
-			if (ExistingDocument)
+		case FGameDataMemberNameHash::Of(TEXT("OriginDungeon")):
 			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->Type = Document->Type;
-				ExistingDocument->Amount = Document->Amount;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				if (!PropertyName.Equals(TEXT("OriginDungeon"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocumentReference(Reader, Document->OriginDungeonRaw, TEXT("Location"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Trinket.OriginDungeon"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else if (ExistingObject)
+		case FGameDataMemberNameHash::Of(TEXT("HeroRestriction")):
 			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("Type"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Loot.Type"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Type) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Loot.Type"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("HeroRestriction"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocumentReference(Reader, Document->HeroRestrictionRaw, TEXT("Hero"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Trinket.HeroRestriction"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Amount"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Item")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("Item"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Trinket.Item"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocument(Reader, Document->Item, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Trinket.Item"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Amount) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Effects")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Loot.Amount"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Effects"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Trinket.Effects"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->Effects, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Trinket.Effects"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -3368,127 +3934,194 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UCombatEffect*& Document,
+	ReaderType& Reader,
+	UMonster*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UCombatEffect>(Outer, UCombatEffect::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<UMonster>(Outer, UMonster::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CombatEffect.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CombatEffect.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UCombatEffect* ExistingDocument = Cast<UCombatEffect>(ExistingObject);
-			if (ExistingDocument)
-			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->Changes = Document->Changes;
-				ExistingDocument->Duration = Document->Duration;
-				ExistingDocument->DurationUnit = Document->DurationUnit;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("Changes"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CombatEffect.Changes"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Monster.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Monster.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UMonster* ExistingDocument = Cast<UMonster>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->NameRaw = Document->NameRaw;
+					ExistingDocument->Type = Document->Type;
+					ExistingDocument->SecondType = Document->SecondType;
+					ExistingDocument->Parameters = Document->Parameters;
+					ExistingDocument->LocationsRaw = Document->LocationsRaw;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->Changes, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Name")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CombatEffect.Changes"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Monster.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Monster.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Duration"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Type")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("Type"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Monster.Type"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Type) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Monster.Type"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Duration) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("SecondType")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CombatEffect.Duration"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("SecondType"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->SecondType) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Monster.SecondType"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("DurationUnit"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Parameters")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CombatEffect.DurationUnit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Parameters"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Monster.Parameters"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->Parameters, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Monster.Parameters"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->DurationUnit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Locations")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CombatEffect.DurationUnit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Locations"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Monster.Locations"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentReferenceCollection(Reader, Document->LocationsRaw, TEXT("Location"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Monster.Locations"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -3497,187 +4130,285 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UCurioCleansingOption*& Document,
+	ReaderType& Reader,
+	ULoot*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UCurioCleansingOption>(Outer, UCurioCleansingOption::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<ULoot>(Outer, ULoot::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UCurioCleansingOption* ExistingDocument = Cast<UCurioCleansingOption>(ExistingObject);
-			if (ExistingDocument)
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->Chance = Document->Chance;
-				ExistingDocument->ItemRaw = Document->ItemRaw;
-				ExistingDocument->Loot = Document->Loot;
-				ExistingDocument->QuirkChance = Document->QuirkChance;
-				ExistingDocument->DiseaseChance = Document->DiseaseChance;
-				ExistingDocument->Effects = Document->Effects;
-				ExistingDocument->ItemIsConsumed = Document->ItemIsConsumed;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Loot.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Loot.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				ULoot* ExistingDocument = Cast<ULoot>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->Type = Document->Type;
+					ExistingDocument->Amount = Document->Amount;
 
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
 
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			else if (ExistingObject)
+		case FGameDataMemberNameHash::Of(TEXT("Type")):
 			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Type"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Loot.Type"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Type) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Loot.Type"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else
+		case FGameDataMemberNameHash::Of(TEXT("Amount")):
 			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Amount"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Amount) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Loot.Amount"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else if (PropertyName == TEXT("Chance"))
+	}
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		return false;
+	}
+
+
+	URpgGameData_SweepMarkedChildDocuments(Document);
+
+	return true;
+}
+template <typename ReaderType>
+bool URpgGameData::ReadDocument
+(
+	ReaderType& Reader,
+	UCombatEffect*& Document,
+	UObject* Outer,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	Document = NewObject<UCombatEffect>(Outer, UCombatEffect::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
+	Outer = Document;
+
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
+	{
+		if (Reader.IsError())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Chance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Chance) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Chance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			return false;
 		}
-		else if (PropertyName == TEXT("Item"))
+
+		const FStringView PropertyName = Reader.ReadMemberView();
+		bool bReadSuccess;
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CombatEffect.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CombatEffect.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UCombatEffect* ExistingDocument = Cast<UCombatEffect>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->Changes = Document->Changes;
+					ExistingDocument->Duration = Document->Duration;
+					ExistingDocument->DurationUnit = Document->DurationUnit;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentReference(Reader, Document->ItemRaw, TEXT("Item"), GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Changes")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Item"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Changes"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CombatEffect.Changes"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->Changes, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CombatEffect.Changes"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Loot"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Duration")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Loot"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->Loot, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Loot"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("QuirkChance"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->QuirkChance) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.QuirkChance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("DiseaseChance"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->DiseaseChance) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.DiseaseChance"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Effects"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Effects"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->Effects, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Effects"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("ItemIsConsumed"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.ItemIsConsumed"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Duration"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Duration) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CombatEffect.Duration"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->ItemIsConsumed) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("DurationUnit")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.ItemIsConsumed"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("DurationUnit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CombatEffect.DurationUnit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->DurationUnit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CombatEffect.DurationUnit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -3686,172 +4417,236 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UCurio*& Document,
+	ReaderType& Reader,
+	UCurioCleansingOption*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UCurio>(Outer, UCurio::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<UCurioCleansingOption>(Outer, UCurioCleansingOption::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UCurio* ExistingDocument = Cast<UCurio>(ExistingObject);
-			if (ExistingDocument)
-			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->Type = Document->Type;
-				ExistingDocument->NameRaw = Document->NameRaw;
-				ExistingDocument->DescriptionRaw = Document->DescriptionRaw;
-				ExistingDocument->CleansingOptions = Document->CleansingOptions;
-				ExistingDocument->PlacementRestictions = Document->PlacementRestictions;
-				ExistingDocument->LocationsRaw = Document->LocationsRaw;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("Type"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.Type"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Type) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.Type"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Name"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Description"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.Description"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UCurioCleansingOption* ExistingDocument = Cast<UCurioCleansingOption>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->Chance = Document->Chance;
+					ExistingDocument->ItemRaw = Document->ItemRaw;
+					ExistingDocument->Loot = Document->Loot;
+					ExistingDocument->QuirkChance = Document->QuirkChance;
+					ExistingDocument->DiseaseChance = Document->DiseaseChance;
+					ExistingDocument->Effects = Document->Effects;
+					ExistingDocument->ItemIsConsumed = Document->ItemIsConsumed;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->DescriptionRaw, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Chance")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.Description"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Chance"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Chance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Chance) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Chance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("CleansingOptions"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Item")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.CleansingOptions"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Item"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocumentReference(Reader, Document->ItemRaw, TEXT("Item"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Item"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->CleansingOptions, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Loot")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.CleansingOptions"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Loot"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Loot"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->Loot, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Loot"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("PlacementRestictions"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("QuirkChance")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.PlacementRestictions"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("QuirkChance"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->QuirkChance) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.QuirkChance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->PlacementRestictions) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("DiseaseChance")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.PlacementRestictions"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("DiseaseChance"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->DiseaseChance) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.DiseaseChance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Locations"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Effects")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.Locations"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Effects"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Effects"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->Effects, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.Effects"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentReferenceCollection(Reader, Document->LocationsRaw, TEXT("Location"), GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("ItemIsConsumed")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.Locations"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("ItemIsConsumed"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.ItemIsConsumed"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->ItemIsConsumed) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("CurioCleansingOption.ItemIsConsumed"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -3860,112 +4655,215 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UDisease*& Document,
+	ReaderType& Reader,
+	UCurio*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UDisease>(Outer, UDisease::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<UCurio>(Outer, UCurio::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Disease.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UCurio* ExistingDocument = Cast<UCurio>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->Type = Document->Type;
+					ExistingDocument->NameRaw = Document->NameRaw;
+					ExistingDocument->DescriptionRaw = Document->DescriptionRaw;
+					ExistingDocument->CleansingOptions = Document->CleansingOptions;
+					ExistingDocument->PlacementRestictions = Document->PlacementRestictions;
+					ExistingDocument->LocationsRaw = Document->LocationsRaw;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Type")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Disease.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Type"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.Type"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Type) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.Type"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UDisease* ExistingDocument = Cast<UDisease>(ExistingObject);
-			if (ExistingDocument)
+		case FGameDataMemberNameHash::Of(TEXT("Name")):
 			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->NameRaw = Document->NameRaw;
-				ExistingDocument->Effects = Document->Effects;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				if (!PropertyName.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else if (ExistingObject)
+		case FGameDataMemberNameHash::Of(TEXT("Description")):
 			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Description"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.Description"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->DescriptionRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.Description"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else
+		case FGameDataMemberNameHash::Of(TEXT("CleansingOptions")):
 			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("CleansingOptions"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.CleansingOptions"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->CleansingOptions, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.CleansingOptions"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Name"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("PlacementRestictions")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Disease.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Disease.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Effects"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Disease.Effects"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("PlacementRestictions"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.PlacementRestictions"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->PlacementRestictions) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.PlacementRestictions"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->Effects, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Locations")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Disease.Effects"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Locations"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Curio.Locations"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentReferenceCollection(Reader, Document->LocationsRaw, TEXT("Location"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Curio.Locations"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -3974,127 +4872,285 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UQuirk*& Document,
+	ReaderType& Reader,
+	UDisease*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UQuirk>(Outer, UQuirk::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<UDisease>(Outer, UDisease::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Quirk.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Quirk.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UQuirk* ExistingDocument = Cast<UQuirk>(ExistingObject);
-			if (ExistingDocument)
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->NameRaw = Document->NameRaw;
-				ExistingDocument->IsPositive = Document->IsPositive;
-				ExistingDocument->Effects = Document->Effects;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Disease.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Disease.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UDisease* ExistingDocument = Cast<UDisease>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->NameRaw = Document->NameRaw;
+					ExistingDocument->Effects = Document->Effects;
 
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
 
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			else if (ExistingObject)
+		case FGameDataMemberNameHash::Of(TEXT("Name")):
 			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Disease.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Disease.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else
+		case FGameDataMemberNameHash::Of(TEXT("Effects")):
 			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Effects"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Disease.Effects"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->Effects, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Disease.Effects"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else if (PropertyName == TEXT("Name"))
+	}
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		return false;
+	}
+
+
+	URpgGameData_SweepMarkedChildDocuments(Document);
+
+	return true;
+}
+template <typename ReaderType>
+bool URpgGameData::ReadDocument
+(
+	ReaderType& Reader,
+	UQuirk*& Document,
+	UObject* Outer,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	Document = NewObject<UQuirk>(Outer, UQuirk::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
+	Outer = Document;
+
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
+	{
+		if (Reader.IsError())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Quirk.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Quirk.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			return false;
 		}
-		else if (PropertyName == TEXT("IsPositive"))
+
+		const FStringView PropertyName = Reader.ReadMemberView();
+		bool bReadSuccess;
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Quirk.IsPositive"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Quirk.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Quirk.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UQuirk* ExistingDocument = Cast<UQuirk>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->NameRaw = Document->NameRaw;
+					ExistingDocument->IsPositive = Document->IsPositive;
+					ExistingDocument->Effects = Document->Effects;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->IsPositive) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Name")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Quirk.IsPositive"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Quirk.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Quirk.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Effects"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("IsPositive")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Quirk.Effects"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("IsPositive"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Quirk.IsPositive"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->IsPositive) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Quirk.IsPositive"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->Effects, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Effects")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Quirk.Effects"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Effects"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Quirk.Effects"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->Effects, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Quirk.Effects"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -4103,9 +5159,10 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
+	ReaderType& Reader,
 	UCondition*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
@@ -4113,119 +5170,143 @@ bool URpgGameData::ReadDocument
 )
 {
 	Document = NewObject<UCondition>(Outer, UCondition::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Conditions.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Conditions.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UCondition* ExistingDocument = Cast<UCondition>(ExistingObject);
-			if (ExistingDocument)
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->DescriptionRaw = Document->DescriptionRaw;
-				ExistingDocument->Check = Document->Check;
-				ExistingDocument->UnboundCheck = Document->UnboundCheck;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Conditions.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Conditions.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UCondition* ExistingDocument = Cast<UCondition>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->DescriptionRaw = Document->DescriptionRaw;
+					ExistingDocument->Check = Document->Check;
+					ExistingDocument->UnboundCheck = Document->UnboundCheck;
 
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
 
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("Description"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Conditions.Description"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->DescriptionRaw, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Conditions.Description"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Check"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Conditions.Check"), *CombineGameDataPath(GameDataPath));
-				return false;
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = ReadFormula(Reader, Document->Check, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Description")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Conditions.Check"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Description"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Conditions.Description"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->DescriptionRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Conditions.Description"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("UnboundCheck"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Check")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("Check"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Conditions.Check"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadFormula(Reader, Document->Check, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Conditions.Check"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			TSharedPtr<FJsonObject> FormulaObject;
-			bReadSuccess = Reader->ReadObject(FormulaObject);
-			Document->UnboundCheck.JsonObject = FormulaObject;
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("UnboundCheck")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Conditions.UnboundCheck"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("UnboundCheck"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				TSharedPtr<FJsonObject> FormulaObject;
+				bReadSuccess = Reader.ReadObject(FormulaObject);
+				Document->UnboundCheck.JsonObject = FormulaObject;
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Conditions.UnboundCheck"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -4234,9 +5315,10 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
+	ReaderType& Reader,
 	UWeapon*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
@@ -4244,147 +5326,183 @@ bool URpgGameData::ReadDocument
 )
 {
 	Document = NewObject<UWeapon>(Outer, UWeapon::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Weapon.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Weapon.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UWeapon* ExistingDocument = Cast<UWeapon>(ExistingObject);
-			if (ExistingDocument)
-			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->NameRaw = Document->NameRaw;
-				ExistingDocument->DamageFrom = Document->DamageFrom;
-				ExistingDocument->DamageTo = Document->DamageTo;
-				ExistingDocument->CriticalStrikeChance = Document->CriticalStrikeChance;
-				ExistingDocument->Speed = Document->Speed;
-
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("Name"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Weapon.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Weapon.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("DamageFrom"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Weapon.DamageFrom"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->DamageFrom) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Weapon.DamageFrom"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("DamageTo"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Weapon.DamageTo"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Weapon.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Weapon.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UWeapon* ExistingDocument = Cast<UWeapon>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->NameRaw = Document->NameRaw;
+					ExistingDocument->DamageFrom = Document->DamageFrom;
+					ExistingDocument->DamageTo = Document->DamageTo;
+					ExistingDocument->CriticalStrikeChance = Document->CriticalStrikeChance;
+					ExistingDocument->Speed = Document->Speed;
+
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->DamageTo) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Name")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Weapon.DamageTo"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Weapon.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Weapon.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("CriticalStrikeChance"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("DamageFrom")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Weapon.CriticalStrikeChance"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("DamageFrom"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Weapon.DamageFrom"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->DamageFrom) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Weapon.DamageFrom"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->CriticalStrikeChance) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("DamageTo")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Weapon.CriticalStrikeChance"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("DamageTo"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Weapon.DamageTo"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->DamageTo) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Weapon.DamageTo"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Speed"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("CriticalStrikeChance")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Weapon.Speed"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("CriticalStrikeChance"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Weapon.CriticalStrikeChance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->CriticalStrikeChance) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Weapon.CriticalStrikeChance"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Speed) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Speed")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Weapon.Speed"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Speed"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Weapon.Speed"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Speed) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Weapon.Speed"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -4393,9 +5511,10 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
+	ReaderType& Reader,
 	UArmor*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
@@ -4403,117 +5522,141 @@ bool URpgGameData::ReadDocument
 )
 {
 	Document = NewObject<UArmor>(Outer, UArmor::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Armor.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Armor.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UArmor* ExistingDocument = Cast<UArmor>(ExistingObject);
-			if (ExistingDocument)
-			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->NameRaw = Document->NameRaw;
-				ExistingDocument->Dodge = Document->Dodge;
-				ExistingDocument->HitPoints = Document->HitPoints;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Armor.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Armor.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UArmor* ExistingDocument = Cast<UArmor>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->NameRaw = Document->NameRaw;
+					ExistingDocument->Dodge = Document->Dodge;
+					ExistingDocument->HitPoints = Document->HitPoints;
 
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
 
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("Name"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Armor.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Armor.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Dodge"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Armor.Dodge"), *CombineGameDataPath(GameDataPath));
-				return false;
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Dodge) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Name")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Armor.Dodge"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Armor.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->NameRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Armor.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("HitPoints"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Dodge")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Armor.HitPoints"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Dodge"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Armor.Dodge"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Dodge) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Armor.Dodge"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->HitPoints) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("HitPoints")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Armor.HitPoints"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("HitPoints"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("Armor.HitPoints"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->HitPoints) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("Armor.HitPoints"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -4522,9 +5665,10 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
+	ReaderType& Reader,
 	UItemWithCount*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
@@ -4532,102 +5676,120 @@ bool URpgGameData::ReadDocument
 )
 {
 	Document = NewObject<UItemWithCount>(Outer, UItemWithCount::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ItemWithCount.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ItemWithCount.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UItemWithCount* ExistingDocument = Cast<UItemWithCount>(ExistingObject);
-			if (ExistingDocument)
-			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->ItemRaw = Document->ItemRaw;
-				ExistingDocument->Count = Document->Count;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ItemWithCount.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ItemWithCount.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UItemWithCount* ExistingDocument = Cast<UItemWithCount>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->ItemRaw = Document->ItemRaw;
+					ExistingDocument->Count = Document->Count;
 
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
 
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("Item"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ItemWithCount.Item"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadDocumentReference(Reader, Document->ItemRaw, TEXT("Item"), GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ItemWithCount.Item"), *CombineGameDataPath(GameDataPath));
-				return false;
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Count"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Item")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ItemWithCount.Count"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Item"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ItemWithCount.Item"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentReference(Reader, Document->ItemRaw, TEXT("Item"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ItemWithCount.Item"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Count) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Count")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ItemWithCount.Count"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Count"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ItemWithCount.Count"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Count) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ItemWithCount.Count"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -4636,9 +5798,10 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool URpgGameData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
+	ReaderType& Reader,
 	UStartingSet*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
@@ -4646,117 +5809,141 @@ bool URpgGameData::ReadDocument
 )
 {
 	Document = NewObject<UStartingSet>(Outer, UStartingSet::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
+		URpgGameData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("StartingSet.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("StartingSet.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UStartingSet* ExistingDocument = Cast<UStartingSet>(ExistingObject);
-			if (ExistingDocument)
-			{
-				URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->Items = Document->Items;
-				ExistingDocument->HeroesRaw = Document->HeroesRaw;
-				ExistingDocument->LocationRaw = Document->LocationRaw;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("StartingSet.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("StartingSet.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = URpgGameData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = URpgGameData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UStartingSet* ExistingDocument = Cast<UStartingSet>(ExistingObject);
+				if (ExistingDocument)
+				{
+					URpgGameData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->Items = Document->Items;
+					ExistingDocument->HeroesRaw = Document->HeroesRaw;
+					ExistingDocument->LocationRaw = Document->LocationRaw;
 
-				URpgGameData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
+					URpgGameData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
 
-				URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				URpgGameData_TryDeleteDocument(ExistingObject);
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				URpgGameData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("Items"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("StartingSet.Items"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->Items, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("StartingSet.Items"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Heroes"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("StartingSet.Heroes"), *CombineGameDataPath(GameDataPath));
-				return false;
+					URpgGameData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					URpgGameData_TryDeleteDocument(ExistingObject);
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					URpgGameData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentReferenceCollection(Reader, Document->HeroesRaw, TEXT("Hero"), GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Items")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("StartingSet.Heroes"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Items"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("StartingSet.Items"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->Items, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("StartingSet.Items"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Location"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Heroes")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("StartingSet.Location"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Heroes"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("StartingSet.Heroes"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentReferenceCollection(Reader, Document->HeroesRaw, TEXT("Hero"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("StartingSet.Heroes"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentReference(Reader, Document->LocationRaw, TEXT("Location"), GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Location")):
 			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("StartingSet.Location"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Location"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("StartingSet.Location"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentReference(Reader, Document->LocationRaw, TEXT("Location"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("StartingSet.Location"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -4765,10 +5952,10 @@ bool URpgGameData::ReadDocument
 
 	return true;
 }
-template <typename IdType, typename DocumentType>
+template <typename ReaderType, typename IdType, typename DocumentType>
 bool URpgGameData::ReadDocumentCollection
 (
-	const TSharedRef<IGameDataReader>& Reader,
+	ReaderType& Reader,
 	TMap<IdType,DocumentType*>& Collection,
 	int32 Capacity,
 	UObject* Outer,
@@ -4777,13 +5964,59 @@ bool URpgGameData::ReadDocumentCollection
 )
 {
 	Collection.Empty();
-	if (Reader->IsNull())
+	auto Documents = TArray<DocumentType*>();
+	if (!ReadDocumentList(Reader, Documents, Capacity, Outer, GameDataPath, NextToken))
 	{
-		return true;
+		return false;
 	}
 
-	const bool IsByIdCollection = Reader->GetNotation() == EJsonNotation::ObjectStart;
+	ToMapById(Collection, Documents);
+
+	return true;
+}
+template <typename ReaderType, typename IdType, typename DocumentType>
+bool URpgGameData::ReadDocumentCollection
+(
+	ReaderType& Reader,
+	TGameDataDocumentStore<IdType,DocumentType>& Store,
+	int32 Capacity,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	// root documents are added to schema's store, embedded documents are added to it by FindAllDocuments()
 	auto Documents = TArray<DocumentType*>();
+	if (!ReadDocumentList(Reader, Documents, Capacity, this, GameDataPath, NextToken))
+	{
+		return false;
+	}
+
+	Store.Append(Documents, /* bIsRoot */ true);
+
+	return true;
+}
+template <typename ReaderType, typename DocumentType>
+bool URpgGameData::ReadDocumentList
+(
+	ReaderType& Reader,
+	TArray<DocumentType*>& Documents,
+	int32 Capacity,
+	UObject* Outer,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	// root documents of patched schemas are merged with their patches while read
+	if (PatchIndex.IsValid() && Outer == this && PatchIndex->HasPatches(DocumentType::StaticClass()))
+	{
+		return ReadPatchedDocumentCollection(Reader, Documents, Capacity, GameDataPath, NextToken);
+	}
+	if (Reader.IsNull())
+	{
+		return true;
+	}
+
+	const bool IsByIdCollection = Reader.GetNotation() == EJsonNotation::ObjectStart;
 
 	if (Capacity > 0)
 	{
@@ -4792,34 +6025,34 @@ bool URpgGameData::ReadDocumentCollection
 
 	if (IsByIdCollection)
 	{
-		Reader->ReadObjectBegin();
+		Reader.ReadObjectBegin();
 	}
 	else
 	{
-		Reader->ReadArrayBegin();
+		Reader.ReadArrayBegin();
 	}
 
 	int32 Count = -1;
-	while (Reader->GetNotation() != EJsonNotation::ArrayEnd &&
-			Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	while (Reader.GetNotation() != EJsonNotation::ArrayEnd &&
+			Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
 		Count++;
 
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
-		if (Reader->IsNull())
+		if (Reader.IsNull())
 		{
-			Reader->ReadNext();
+			Reader.ReadNext();
 			continue;
 		}
 
-		auto DocumentId = Reader->GetIdentifier();
+		const FStringView DocumentId = Reader.GetIdentifierView();
 		if (!DocumentId.IsEmpty())
 		{
-			GameDataPath.Add(DocumentId);
+			GameDataPath.Emplace(DocumentId);
 		}
 		else
 		{
@@ -4841,923 +6074,571 @@ bool URpgGameData::ReadDocumentCollection
 	}
 	if (IsByIdCollection)
 	{
-		Reader->ReadObjectEnd(NextToken);
+		Reader.ReadObjectEnd(NextToken);
 	}
 	else
 	{
-		Reader->ReadArrayEnd(NextToken);
+		Reader.ReadArrayEnd(NextToken);
 	}
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
-	ToMapById(Collection, Documents);
-
 	return true;
 }
-bool URpgGameData::ReadLocalizedText
+template <typename ReaderType, typename DocumentType>
+bool URpgGameData::ReadPatchedDocumentCollection
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	FLocalizedText& LocalizedText,
+	ReaderType& Reader,
+	TArray<DocumentType*>& Documents,
+	int32 Capacity,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	auto LocStringMap = TMap<FString, FText>();
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	if (Capacity > 0)
 	{
-		if (Reader->IsError())
+		Documents.Reserve(Capacity);
+	}
+
+	if (!Reader.IsNull())
+	{
+		const bool IsByIdCollection = Reader.GetNotation() == EJsonNotation::ObjectStart;
+		if (IsByIdCollection)
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-			return false;
+			Reader.ReadObjectBegin();
+		}
+		else
+		{
+			Reader.ReadArrayBegin();
 		}
 
-		FString LanguageId = Reader->ReadMember();
-		if (LanguageId == TEXT("notes")) {
-			Reader->SkipAny();
-			continue;
+		TArray<TSharedPtr<FJsonValue>> DocumentPatches;
+		int32 Count = -1;
+		while (Reader.GetNotation() != EJsonNotation::ArrayEnd &&
+				Reader.GetNotation() != EJsonNotation::ObjectEnd)
+		{
+			Count++;
+
+			if (Reader.IsError())
+			{
+				UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+				return false;
+			}
+
+			// in by-id collection id is known before document is read, so only patched documents are read as FJsonValue
+			FString DocumentId = FString(Reader.GetIdentifierView());
+			if (IsByIdCollection && !PatchIndex->Take(DocumentType::StaticClass(), DocumentId, DocumentPatches))
+			{
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+
+				GameDataPath.Add(DocumentId);
+				DocumentType* StreamedDocument = nullptr;
+				if (!ReadDocument(Reader, StreamedDocument, this, GameDataPath) || StreamedDocument == nullptr)
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read document. Path: %s."), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				Documents.Add(StreamedDocument);
+				GameDataPath.Pop();
+				continue;
+			}
+
+			// in list collection id is inside of document, so document is captured as raw bytes and only its id is read
+			// to look up patches, then document is read from raw bytes as FJsonValue only if it is patched
+			TArrayView<const uint8> RawDocument;
+			if (!IsByIdCollection && !Reader.IsNull() && Reader.ReadRawValue(RawDocument))
+			{
+				const TSharedPtr<IGameDataReader> IdReader = Reader.CreateRawValueReader(RawDocument);
+				const TSharedPtr<IGameDataReader> DocumentReader = Reader.CreateRawValueReader(RawDocument);
+				DocumentId.Reset();
+				if (IdReader.IsValid() && IdReader->ReadNext())
+				{
+					FGameDataPatchIndex::ReadDocumentId(*IdReader, DocumentId);
+				}
+				GameDataPath.Add(DocumentId.IsEmpty() ? FString::FromInt(Count) : DocumentId);
+				if (!DocumentReader.IsValid() || !DocumentReader->ReadNext())
+				{
+					UE_LOG(LogURpgGameData, Error, TEXT("Failed to read document. Path: %s."), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+
+				if (!DocumentId.IsEmpty() && PatchIndex->Take(DocumentType::StaticClass(), DocumentId, DocumentPatches))
+				{
+					TSharedPtr<FJsonValue> PatchedDocument;
+					if (!DocumentReader->ReadAny(PatchedDocument) || !PatchedDocument.IsValid())
+					{
+						UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *DocumentReader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+						return false;
+					}
+					if (!ReadPatchedDocument(ApplyDocumentPatches<DocumentType>(PatchedDocument, DocumentPatches), Documents, GameDataPath))
+					{
+						return false;
+					}
+				}
+				else
+				{
+					DocumentType* StreamedDocument = nullptr;
+					const bool bReadSuccess = FGameDataReaderDispatch::Visit(*DocumentReader, [&](auto& TypedReader)
+					{
+						return ReadDocument(TypedReader, StreamedDocument, this, GameDataPath);
+					});
+					if (!bReadSuccess || StreamedDocument == nullptr)
+					{
+						UE_LOG(LogURpgGameData, Error, TEXT("Failed to read document. Path: %s."), *CombineGameDataPath(GameDataPath));
+						return false;
+					}
+					Documents.Add(StreamedDocument);
+				}
+				GameDataPath.Pop();
+				continue;
+			}
+
+			// patched document of by-id collection or document of reader which doesn't keep raw bytes is read as FJsonValue
+			TSharedPtr<FJsonValue> Document;
+			if (!Reader.ReadAny(Document) || !Document.IsValid())
+			{
+				UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+				return false;
+			}
+
+			const TSharedPtr<FJsonObject>* DocumentObjectPtr;
+			if (!IsByIdCollection && Document->TryGetObject(DocumentObjectPtr) && DocumentObjectPtr->IsValid())
+			{
+				FGameDataPatchIndex::GetDocumentId(*DocumentObjectPtr->Get(), DocumentId);
+			}
+			if (IsByIdCollection || (!DocumentId.IsEmpty() && PatchIndex->Take(DocumentType::StaticClass(), DocumentId, DocumentPatches)))
+			{
+				Document = ApplyDocumentPatches<DocumentType>(Document, DocumentPatches);
+			}
+
+			GameDataPath.Add(DocumentId.IsEmpty() ? FString::FromInt(Count) : DocumentId);
+			if (!ReadPatchedDocument(Document, Documents, GameDataPath))
+			{
+				return false;
+			}
+			GameDataPath.Pop();
+		}
+		if (IsByIdCollection)
+		{
+			Reader.ReadObjectEnd(NextToken);
+		}
+		else
+		{
+			Reader.ReadArrayEnd(NextToken);
 		}
 
-		FText Text;
-		GameDataPath.Add(LanguageId);
-		if (!Reader->ReadValue(Text))
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("Failed to read localized text for language '%s'. Path: %s."), *LanguageId, *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
-		Reader->ReadNext();
-		GameDataPath.Pop();
+	}
 
-		if (LanguageId.IsEmpty() || Text.IsEmpty())
+	// documents which are only in patches are added after documents of game data
+	TArray<TPair<FString, TArray<TSharedPtr<FJsonValue>>>> PatchesByDocumentId;
+	PatchIndex->TakeAll(DocumentType::StaticClass(), PatchesByDocumentId);
+	for (const auto& DocumentPatchesById : PatchesByDocumentId)
+	{
+		GameDataPath.Add(DocumentPatchesById.Key);
+		if (!ReadPatchedDocument(ApplyDocumentPatches<DocumentType>(nullptr, DocumentPatchesById.Value), Documents, GameDataPath))
 		{
-			continue;
+			return false;
 		}
-		LocStringMap.Add(LanguageId, Text);
+		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
 
-	LocalizedText = FLocalizedText(LocStringMap, LanguageSwitcher);
 	return true;
 }
+template <typename DocumentType>
+bool URpgGameData::ReadPatchedDocument(const TSharedPtr<FJsonValue>& PatchedDocument, TArray<DocumentType*>& Documents, TArray<FString>& GameDataPath)
+{
+	const TSharedPtr<FJsonObject>* DocumentObjectPtr;
+	if (!PatchedDocument.IsValid() || !PatchedDocument->TryGetObject(DocumentObjectPtr) || !DocumentObjectPtr->IsValid())
+	{
+		return true; // deleted by game data or patch
+	}
 
-template <typename DocumentReferenceType>
-bool URpgGameData::ReadDocumentReferenceCollection
+	const TSharedRef<IGameDataReader> DocumentReader = FGameDataReaderFactory::CreateJsonObjectReader(*DocumentObjectPtr);
+	DocumentReader->ReadNext(); // initialize reader and move to first token
+
+	DocumentType* Document = nullptr;
+	const bool bReadSuccess = FGameDataReaderDispatch::Visit(*DocumentReader, [&](auto& TypedReader)
+	{
+		return ReadDocument(TypedReader, Document, this, GameDataPath);
+	});
+	if (!bReadSuccess || Document == nullptr)
+	{
+		UE_LOG(LogURpgGameData, Error, TEXT("Failed to read document. Path: %s."), *CombineGameDataPath(GameDataPath));
+		return false;
+	}
+
+	Documents.Add(Document);
+	return true;
+}
+template <typename ReaderType, typename IdType, typename DocumentType>
+bool URpgGameData::ReadLazyDocumentCollection
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	TArray<DocumentReferenceType>& Collection,
-	const FString& SchemaIdOrName,
+	ReaderType& Reader,
+	const FString& SchemaName,
+	TGameDataDocumentStore<IdType,DocumentType>& Store,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Collection.Empty();
-	if (Reader->IsNull())
+	if (Reader.IsNull())
 	{
 		return true;
 	}
 
-	const bool IsByIdCollection = Reader->GetNotation() == EJsonNotation::ObjectStart;
+	const bool IsByIdCollection = Reader.GetNotation() == EJsonNotation::ObjectStart;
 
 	if (IsByIdCollection)
 	{
-		Reader->ReadObjectBegin();
+		Reader.ReadObjectBegin();
 	}
 	else
 	{
-		Reader->ReadArrayBegin();
+		Reader.ReadArrayBegin();
 	}
-	while (Reader->GetNotation() != EJsonNotation::ArrayEnd &&
-			Reader->GetNotation() != EJsonNotation::ObjectEnd)
+
+	int32 Count = -1;
+	while (Reader.GetNotation() != EJsonNotation::ArrayEnd &&
+			Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		Count++;
+
+		if (Reader.IsError())
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
-		if (Reader->IsNull())
+		if (Reader.IsNull())
 		{
-			Reader->ReadNext();
+			Reader.ReadNext();
 			continue;
 		}
 
-		DocumentReferenceType DocumentReference;
-		if (!ReadDocumentReference(Reader, DocumentReference, SchemaIdOrName, GameDataPath))
+		// document is kept as raw bytes until first access, see FindLazyDocument
+		IdType DocumentId = IdType();
+		if (!LazyDocuments->ReadDocument(Reader, SchemaName, DocumentId))
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("Failed to read document reference. Path: %s."), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogURpgGameData, Error, TEXT("Failed to read document's id. Path: %s/%d."), *CombineGameDataPath(GameDataPath), Count);
 			return false;
 		}
-		Collection.Add(DocumentReference);
+		ReadDocumentCount++;
 	}
 	if (IsByIdCollection)
 	{
-		Reader->ReadObjectEnd(NextToken);
+		Reader.ReadObjectEnd(NextToken);
 	}
 	else
 	{
-		Reader->ReadArrayEnd(NextToken);
+		Reader.ReadArrayEnd(NextToken);
 	}
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
 	return true;
 }
-
-bool URpgGameData::ReadDocumentReference
-(
-	const TSharedRef<IGameDataReader>& Reader,
-	FGameDataDocumentReference& DocumentReference,
-	const FString& SchemaIdOrName,
-	TArray<FString>& GameDataPath,
-	bool NextToken
-)
+template <typename IdType, typename DocumentType>
+DocumentType* URpgGameData::FindLazyDocument(const FString& SchemaName, const IdType& Id, TGameDataDocumentStore<IdType, DocumentType>& Store)
 {
-	FString Id;
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	FString IdString;
+	FGameDataDocumentIdConvert::ConvertToString(Id, IdString);
+	if (!LazyDocuments->Contains(SchemaName, IdString))
 	{
-		if (Reader->IsError())
+		// not a root document, only root documents which embed document with this id are created to find it
+		TArray<TPair<FString, FString>> Owners;
+		LazyDocuments->GetEmbeddedDocumentOwners(IdString, Owners);
+		for (const TPair<FString, FString>& Owner : Owners)
 		{
-			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-			return false;
+			FindGameDataDocumentById(Owner.Key, Owner.Value);
 		}
 
-		auto MemberName = Reader->ReadMember();
-		if (MemberName == TEXT("Id"))
+		DocumentType* Document = Store.FindRef(Id);
+		if (Document == nullptr)
 		{
-			if (!Reader->ReadValue(Id))
-			{
-				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read 'Id' value for document reference. Path: %s."), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			Reader->ReadNext();
-		}
-		else
-		{
-			Reader->SkipAny();
+			UE_LOG(LogURpgGameData, Verbose, TEXT("Document '%s' of '%s' is not found among root and embedded documents."), *IdString, *SchemaName);
 		}
+		return Document;
 	}
 
-	Reader->ReadObjectEnd(NextToken);
-
-	if (Id.IsEmpty())
-	{
-		UE_LOG(LogURpgGameData, Error, TEXT("Document reference 'Id' is null or empty. Path: %s."), *CombineGameDataPath(GameDataPath));
-		return false;
-	}
-
-	DocumentReference.Id = Id;
-	DocumentReference.SchemaIdOrName = SchemaIdOrName;
-	DocumentReference.GameData = this;
-
-	return true;
-}
-
-template <typename FormulaType>
-bool URpgGameData::ReadFormula
-(
-		const TSharedRef<IGameDataReader>& Reader,
-		FormulaType*& Formula,
-		UObject* Outer,
-		TArray<FString>& GameDataPath,
-		bool NextToken
-)
-{
-	if (Reader->IsError())
+	TSharedPtr<IGameDataReader> DocumentReader = LazyDocuments->Take(SchemaName, IdString);
+	auto GameDataPath = TArray<FString>({ TEXT(""), TEXT("Collections"), SchemaName, IdString });
+	DocumentType* Document = nullptr;
+	const bool bReadSuccess = DocumentReader.IsValid() && FGameDataReaderDispatch::Visit(*DocumentReader, [&](auto& TypedReader)
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-		return false;
-	}
+		return ReadDocument(TypedReader, Document, this, GameDataPath);
+	});
+	DocumentReader.Reset();
 
-	TSharedPtr<FJsonObject> FormulaObject;
-	if (!Reader->ReadObject(FormulaObject, NextToken) || FormulaObject == nullptr)
+	if (LazyDocuments->IsEmpty())
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("Failed to read JsonObject for Formula data type. Path: %s."), *CombineGameDataPath(GameDataPath));
-		return false;
+		LazyDocuments.Reset();
 	}
 
-	if (Reader->IsError())
+	if (!bReadSuccess || Document == nullptr)
 	{
-		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-		return false;
+		UE_LOG(LogURpgGameData, Error, TEXT("Failed to read document. Path: %s."), *CombineGameDataPath(GameDataPath));
+		return nullptr;
 	}
 
-	Formula = NewObject<FormulaType>(Outer);
-	Formula->ExpressionTree.JsonObject = FormulaObject;
-#if defined(CHARON_FEATURE_FORMULAS_V2) && CHARON_FEATURE_FORMULAS_V2
-	UFormulaExpressionDefaultGlobal* GlobalObject = NewObject<UFormulaExpressionDefaultGlobal>(Outer, UFormulaExpressionDefaultGlobal::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
-	GlobalObject->This = Outer; // Document
-	GlobalObject->GameData = this;
-	Formula->Global = GlobalObject;
-#endif
+	Store.Add(Document, /* bIsRoot */ true);
+	auto FindingVisitor = URpgGameData::FFindingVisitor();
+	FindingVisitor.Visit(Document);
+	AddFoundDocuments(FindingVisitor);
 
-	return true;
-}
+	RootDocuments = nullptr;
+	AllDocuments = nullptr;
 
-FString URpgGameData::CombineGameDataPath(const TArray<FString>& GameDataPath)
-{
-	return FString::Join(GameDataPath, TEXT("/"));
+	return Document;
 }
-TSharedPtr<FJsonObject> URpgGameData::MergeGameData(const TSharedPtr<FJsonObject>& GameDataDocument, const TSharedPtr<FJsonObject>& PatchDocument)
+template <typename ReaderType>
+bool URpgGameData::ReadLocalizedText
+(
+	ReaderType& Reader,
+	FLocalizedText& LocalizedText,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
 {
-	const TSharedPtr<FJsonObject>* GameDataCollections;
-	if (!GameDataDocument->TryGetObjectField(TEXT("Collections"), GameDataCollections)) {
-		GameDataCollections = nullptr;
-	}
-
-	const TSharedPtr<FJsonObject>* PatchCollections;
-	if (!PatchDocument->TryGetObjectField(TEXT("Collections"), PatchCollections)) {
-		PatchCollections = nullptr;
-	}
-
-	auto MergedCollections = MakeShared<FJsonObject>();
-	if (GameDataCollections != nullptr && GameDataCollections->IsValid() &&
-		PatchCollections != nullptr && PatchCollections->IsValid())
+	auto LocStringMap = TMap<FString, FText>();
+	const int32 StringPoolIndex = LocalizedStringPool.IsValid() ? LocalizedStringPool->AddText() : INDEX_NONE;
+	Reader.ReadObjectBegin();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		auto& GameDataCollectionsMap = GameDataCollections->Get()->Values;
-		auto& PatchCollectionsMap = PatchCollections->Get()->Values;
-
-#if UE_VERSION_NEWER_THAN(5, 8, -1)
-		TSet<UE::FSharedString> VisitedSchemas;
-#else
-		TSet<FString> VisitedSchemas;
-#endif
-		auto SchemaNames = MergeKeys(GameDataCollectionsMap, PatchCollectionsMap);
-
-		for (auto SchemaName : SchemaNames.Get())
+		if (Reader.IsError())
 		{
-			if (VisitedSchemas.Contains(SchemaName))
-			{
-				continue;
-			}
-			if (SchemaName == TEXT("55a4f32faca22e191098f3d9") || SchemaName == TEXT("ProjectSettings"))
-			{
-				VisitedSchemas.Add(TEXT("55a4f32faca22e191098f3d9"));
-				VisitedSchemas.Add(TEXT("ProjectSettings"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("55a4f32faca22e191098f3d9"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("ProjectSettings"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("55a4f32faca22e191098f3d9"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("ProjectSettings"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<URpgGameDataProjectSettings>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("ProjectSettings"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("ProjectSettings"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("ProjectSettings"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5b0a730bb84165c06b547") || SchemaName == TEXT("Parameter"))
-			{
-				VisitedSchemas.Add(TEXT("59f5b0a730bb84165c06b547"));
-				VisitedSchemas.Add(TEXT("Parameter"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5b0a730bb84165c06b547"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Parameter"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5b0a730bb84165c06b547"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Parameter"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UParameter>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Parameter"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Parameter"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Parameter"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5b11030bb84165c06b54e") || SchemaName == TEXT("ParameterValue"))
-			{
-				VisitedSchemas.Add(TEXT("59f5b11030bb84165c06b54e"));
-				VisitedSchemas.Add(TEXT("ParameterValue"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5b11030bb84165c06b54e"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("ParameterValue"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5b11030bb84165c06b54e"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("ParameterValue"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UParameterValue>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("ParameterValue"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("ParameterValue"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("ParameterValue"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5b1c830bb84165c06b556") || SchemaName == TEXT("Provision"))
-			{
-				VisitedSchemas.Add(TEXT("59f5b1c830bb84165c06b556"));
-				VisitedSchemas.Add(TEXT("Provision"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5b1c830bb84165c06b556"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Provision"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5b1c830bb84165c06b556"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Provision"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UProvision>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Provision"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Provision"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Provision"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5b29330bb84165c06b55c") || SchemaName == TEXT("Hero"))
-			{
-				VisitedSchemas.Add(TEXT("59f5b29330bb84165c06b55c"));
-				VisitedSchemas.Add(TEXT("Hero"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5b29330bb84165c06b55c"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Hero"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5b29330bb84165c06b55c"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Hero"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UHero>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Hero"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Hero"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Hero"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5b3f130bb84165c06b56b") || SchemaName == TEXT("Item"))
-			{
-				VisitedSchemas.Add(TEXT("59f5b3f130bb84165c06b56b"));
-				VisitedSchemas.Add(TEXT("Item"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5b3f130bb84165c06b56b"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Item"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5b3f130bb84165c06b56b"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Item"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UItem>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Item"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Item"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Item"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5b57530bb84165c06b579") || SchemaName == TEXT("Location"))
-			{
-				VisitedSchemas.Add(TEXT("59f5b57530bb84165c06b579"));
-				VisitedSchemas.Add(TEXT("Location"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5b57530bb84165c06b579"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Location"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5b57530bb84165c06b579"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Location"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<ULocation>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Location"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Location"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Location"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5b61630bb84165c06b57f") || SchemaName == TEXT("Trinket"))
-			{
-				VisitedSchemas.Add(TEXT("59f5b61630bb84165c06b57f"));
-				VisitedSchemas.Add(TEXT("Trinket"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5b61630bb84165c06b57f"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Trinket"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5b61630bb84165c06b57f"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Trinket"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UTrinket>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Trinket"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Trinket"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Trinket"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5b7f330bb84165c06b58a") || SchemaName == TEXT("Monster"))
-			{
-				VisitedSchemas.Add(TEXT("59f5b7f330bb84165c06b58a"));
-				VisitedSchemas.Add(TEXT("Monster"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5b7f330bb84165c06b58a"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Monster"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5b7f330bb84165c06b58a"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Monster"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UMonster>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Monster"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Monster"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Monster"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5b9dd30bb84165c06b59a") || SchemaName == TEXT("Loot"))
-			{
-				VisitedSchemas.Add(TEXT("59f5b9dd30bb84165c06b59a"));
-				VisitedSchemas.Add(TEXT("Loot"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5b9dd30bb84165c06b59a"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Loot"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5b9dd30bb84165c06b59a"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Loot"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<ULoot>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Loot"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Loot"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Loot"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5baaa30bb84165c06b5a0") || SchemaName == TEXT("CombatEffect"))
-			{
-				VisitedSchemas.Add(TEXT("59f5baaa30bb84165c06b5a0"));
-				VisitedSchemas.Add(TEXT("CombatEffect"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5baaa30bb84165c06b5a0"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("CombatEffect"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5baaa30bb84165c06b5a0"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("CombatEffect"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UCombatEffect>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("CombatEffect"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("CombatEffect"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("CombatEffect"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5bac130bb84165c06b5a4") || SchemaName == TEXT("CurioCleansingOption"))
-			{
-				VisitedSchemas.Add(TEXT("59f5bac130bb84165c06b5a4"));
-				VisitedSchemas.Add(TEXT("CurioCleansingOption"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5bac130bb84165c06b5a4"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("CurioCleansingOption"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5bac130bb84165c06b5a4"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("CurioCleansingOption"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UCurioCleansingOption>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("CurioCleansingOption"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("CurioCleansingOption"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("CurioCleansingOption"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5bbc230bb84165c06b5ae") || SchemaName == TEXT("Curio"))
-			{
-				VisitedSchemas.Add(TEXT("59f5bbc230bb84165c06b5ae"));
-				VisitedSchemas.Add(TEXT("Curio"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5bbc230bb84165c06b5ae"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Curio"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5bbc230bb84165c06b5ae"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Curio"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UCurio>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Curio"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Curio"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Curio"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5d3a7983a361970003662") || SchemaName == TEXT("Disease"))
-			{
-				VisitedSchemas.Add(TEXT("59f5d3a7983a361970003662"));
-				VisitedSchemas.Add(TEXT("Disease"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5d3a7983a361970003662"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Disease"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5d3a7983a361970003662"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Disease"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UDisease>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Disease"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Disease"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Disease"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5d728983a361970003684") || SchemaName == TEXT("Quirk"))
-			{
-				VisitedSchemas.Add(TEXT("59f5d728983a361970003684"));
-				VisitedSchemas.Add(TEXT("Quirk"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5d728983a361970003684"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Quirk"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5d728983a361970003684"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Quirk"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UQuirk>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Quirk"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Quirk"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Quirk"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f5dedf983a361970003697") || SchemaName == TEXT("Conditions"))
-			{
-				VisitedSchemas.Add(TEXT("59f5dedf983a361970003697"));
-				VisitedSchemas.Add(TEXT("Conditions"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f5dedf983a361970003697"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Conditions"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f5dedf983a361970003697"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Conditions"));
-				}
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			return false;
+		}
 
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UCondition>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Conditions"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Conditions"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Conditions"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f9e745983a364298db5e22") || SchemaName == TEXT("Weapon"))
-			{
-				VisitedSchemas.Add(TEXT("59f9e745983a364298db5e22"));
-				VisitedSchemas.Add(TEXT("Weapon"));
+		FString LanguageId = Reader.ReadMember();
+		if (LanguageId == TEXT("notes")) {
+			Reader.SkipAny();
+			continue;
+		}
+		if (LanguageFilter.Num() > 0 && !LanguageFilter.Contains(LanguageId))
+		{
+			Reader.SkipAny(); // text is not decoded for filtered out languages
+			continue;
+		}
 
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f9e745983a364298db5e22"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Weapon"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f9e745983a364298db5e22"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Weapon"));
-				}
+		if (StringPoolIndex != INDEX_NONE && Reader.GetNotation() == EJsonNotation::String)
+		{
+			// pooled text is kept as UTF-8 and FText is created only for displayed language
+			LocalizedStringPool->SetText(StringPoolIndex, LanguageId, Reader.GetValueAsStringView());
+			Reader.ReadNext();
+			continue;
+		}
 
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UWeapon>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Weapon"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Weapon"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Weapon"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("59f9e7b6983a364298db5e2c") || SchemaName == TEXT("Armor"))
-			{
-				VisitedSchemas.Add(TEXT("59f9e7b6983a364298db5e2c"));
-				VisitedSchemas.Add(TEXT("Armor"));
+		FText Text;
+		GameDataPath.Add(LanguageId);
+		if (!Reader.ReadValue(Text))
+		{
+			UE_LOG(LogURpgGameData, Error, TEXT("Failed to read localized text for language '%s'. Path: %s."), *LanguageId, *CombineGameDataPath(GameDataPath));
+			return false;
+		}
+		Reader.ReadNext();
+		GameDataPath.Pop();
 
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("59f9e7b6983a364298db5e2c"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("Armor"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("59f9e7b6983a364298db5e2c"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("Armor"));
-				}
+		if (LanguageId.IsEmpty() || Text.IsEmpty())
+		{
+			continue;
+		}
+		LocStringMap.Add(LanguageId, Text);
+	}
+	Reader.ReadObjectEnd(NextToken);
 
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UArmor>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("Armor"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Armor"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("Armor"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("5a1d78d107ff9a7b889cba7d") || SchemaName == TEXT("ItemWithCount"))
-			{
-				VisitedSchemas.Add(TEXT("5a1d78d107ff9a7b889cba7d"));
-				VisitedSchemas.Add(TEXT("ItemWithCount"));
+	if (StringPoolIndex != INDEX_NONE)
+	{
+		for (const auto& TextByLanguageId : LocStringMap)
+		{
+			LocalizedStringPool->SetText(StringPoolIndex, TextByLanguageId.Key, TextByLanguageId.Value.ToString());
+		}
+		LocalizedText = FLocalizedText(LocalizedStringPool, StringPoolIndex, LanguageSwitcher);
+		return true;
+	}
 
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("5a1d78d107ff9a7b889cba7d"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("ItemWithCount"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("5a1d78d107ff9a7b889cba7d"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("ItemWithCount"));
-				}
+	LocalizedText = FLocalizedText(LocStringMap, LanguageSwitcher);
+	return true;
+}
 
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UItemWithCount>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("ItemWithCount"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("ItemWithCount"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("ItemWithCount"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("5a1d78de07ff9a7b889cba83") || SchemaName == TEXT("StartingSet"))
-			{
-				VisitedSchemas.Add(TEXT("5a1d78de07ff9a7b889cba83"));
-				VisitedSchemas.Add(TEXT("StartingSet"));
+template <typename ReaderType, typename DocumentReferenceType>
+bool URpgGameData::ReadDocumentReferenceCollection
+(
+	ReaderType& Reader,
+	TArray<DocumentReferenceType>& Collection,
+	const FString& SchemaIdOrName,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	Collection.Empty();
+	if (Reader.IsNull())
+	{
+		return true;
+	}
 
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("5a1d78de07ff9a7b889cba83"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("StartingSet"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("5a1d78de07ff9a7b889cba83"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("StartingSet"));
-				}
+	const bool IsByIdCollection = Reader.GetNotation() == EJsonNotation::ObjectStart;
 
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UStartingSet>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("StartingSet"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("StartingSet"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("StartingSet"), *PatchDocumentCollection);
-				}
-			}
-			else
-			{
-				/* ignore schema */
-			}
+	if (IsByIdCollection)
+	{
+		Reader.ReadObjectBegin();
+	}
+	else
+	{
+		Reader.ReadArrayBegin();
+	}
+	while (Reader.GetNotation() != EJsonNotation::ArrayEnd &&
+			Reader.GetNotation() != EJsonNotation::ObjectEnd)
+	{
+		if (Reader.IsError())
+		{
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			return false;
+		}
+		if (Reader.IsNull())
+		{
+			Reader.ReadNext();
+			continue;
+		}
+
+		DocumentReferenceType DocumentReference;
+		if (!ReadDocumentReference(Reader, DocumentReference, SchemaIdOrName, GameDataPath))
+		{
+			UE_LOG(LogURpgGameData, Error, TEXT("Failed to read document reference. Path: %s."), *CombineGameDataPath(GameDataPath));
+			return false;
 		}
+		Collection.Add(DocumentReference);
+	}
+	if (IsByIdCollection)
+	{
+		Reader.ReadObjectEnd(NextToken);
 	}
-	else if (GameDataCollections != nullptr && GameDataCollections->IsValid())
+	else
+	{
+		Reader.ReadArrayEnd(NextToken);
+	}
+
+	if (Reader.IsError())
 	{
-		MergedCollections = GameDataCollections->ToSharedRef();
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		return false;
 	}
-	else if (PatchCollections != nullptr && PatchCollections->IsValid())
+
+	return true;
+}
+
+template <typename ReaderType>
+bool URpgGameData::ReadDocumentReference
+(
+	ReaderType& Reader,
+	FGameDataDocumentReference& DocumentReference,
+	const FString& SchemaIdOrName,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	FString Id;
+	Reader.ReadObjectBegin();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		MergedCollections = PatchCollections->ToSharedRef();
+		if (Reader.IsError())
+		{
+			UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			return false;
+		}
+
+		const FStringView MemberName = Reader.ReadMemberView();
+		if (MemberName == TEXT("Id"))
+		{
+			if (!Reader.ReadValue(Id))
+			{
+				UE_LOG(LogURpgGameData, Error, TEXT("Failed to read 'Id' value for document reference. Path: %s."), *CombineGameDataPath(GameDataPath));
+				return false;
+			}
+			Reader.ReadNext();
+		}
+		else
+		{
+			Reader.SkipAny();
+		}
 	}
 
-	int MergedChangeNumber;
-	if (GameDataDocument->HasTypedField<EJson::Number>(TEXT("ChangeNumber")))
+	Reader.ReadObjectEnd(NextToken);
+
+	if (Id.IsEmpty())
 	{
-		GameDataDocument->GetField<EJson::Number>(TEXT("ChangeNumber"))->TryGetNumber(MergedChangeNumber);
+		UE_LOG(LogURpgGameData, Error, TEXT("Document reference 'Id' is null or empty. Path: %s."), *CombineGameDataPath(GameDataPath));
+		return false;
 	}
-	if (PatchDocument->HasTypedField<EJson::Number>(TEXT("ChangeNumber")))
+
+	DocumentReference.Id = Id;
+	DocumentReference.SchemaIdOrName = SchemaIdOrName;
+	DocumentReference.GameData = this;
+	ReadReferenceCount++;
+
+	return true;
+}
+
+template <typename ReaderType, typename FormulaType>
+bool URpgGameData::ReadFormula
+(
+		ReaderType& Reader,
+		FormulaType*& Formula,
+		UObject* Outer,
+		TArray<FString>& GameDataPath,
+		bool NextToken
+)
+{
+	if (Reader.IsError())
 	{
-		PatchDocument->GetField<EJson::Number>(TEXT("ChangeNumber"))->TryGetNumber(MergedChangeNumber);
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		return false;
 	}
 
-	FString MergedRevisionHash;
-	if (GameDataDocument->HasTypedField<EJson::String>(TEXT("RevisionHash")))
+	TSharedPtr<FJsonObject> FormulaObject;
+	if (!Reader.ReadObject(FormulaObject, NextToken) || FormulaObject == nullptr)
 	{
-		GameDataDocument->GetField<EJson::String>(TEXT("RevisionHash"))->TryGetString(MergedRevisionHash);
+		UE_LOG(LogURpgGameData, Error, TEXT("Failed to read JsonObject for Formula data type. Path: %s."), *CombineGameDataPath(GameDataPath));
+		return false;
 	}
-	if (PatchDocument->HasTypedField<EJson::String>(TEXT("RevisionHash")))
+
+	if (Reader.IsError())
 	{
-		PatchDocument->GetField<EJson::String>(TEXT("RevisionHash"))->TryGetString(MergedRevisionHash);
+		UE_LOG(LogURpgGameData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		return false;
 	}
 
-	auto MergedGameData = MakeShared<FJsonObject>();
-	MergedGameData->SetField(TEXT("ChangeNumber"), MakeShared<FJsonValueNumber>(MergedChangeNumber));
-	MergedGameData->SetField(TEXT("RevisionHash"), MakeShared<FJsonValueString>(MergedRevisionHash));
-	MergedGameData->SetField(TEXT("Collections"), MakeShared<FJsonValueObject>(MergedCollections));
-	return MergedGameData;
+	Formula = NewObject<FormulaType>(Outer);
+	Formula->ExpressionTree.JsonObject = FormulaObject;
+#if defined(CHARON_FEATURE_FORMULAS_V2) && CHARON_FEATURE_FORMULAS_V2
+	UFormulaExpressionDefaultGlobal* GlobalObject = NewObject<UFormulaExpressionDefaultGlobal>(Outer, UFormulaExpressionDefaultGlobal::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	GlobalObject->This = Outer; // Document
+	GlobalObject->GameData = this;
+	Formula->Global = GlobalObject;
+#endif
+
+	return true;
 }
 
+FString URpgGameData::CombineGameDataPath(const TArray<FString>& GameDataPath)
+{
+	return FString::Join(GameDataPath, TEXT("/"));
+}
 struct URpgGameData_ToIdMapper
 {
 	static TSharedPtr<FJsonObject> ToDocumentById(TSharedRef<FJsonValue> Collection)
@@ -5862,6 +6743,36 @@ TSharedPtr<FJsonValue> URpgGameData::MergeDocumentCollection(TSharedRef<FJsonVal
 	return MakeShared<FJsonValueObject>(MergedCollectionById);
 }
 
+template <typename DocumentType>
+TSharedPtr<FJsonValue> URpgGameData::ApplyDocumentPatches(TSharedPtr<FJsonValue> Document, const TArray<TSharedPtr<FJsonValue>>& DocumentPatches)
+{
+	// same rules as MergeDocumentCollection, applied once per patch
+	for (const TSharedPtr<FJsonValue>& DocumentPatch : DocumentPatches)
+	{
+		if (!Document.IsValid())
+		{
+			// added
+			Document = DocumentPatch;
+		}
+		else if (Document->IsNull())
+		{
+			// keep deleted documents as deleted
+			break;
+		}
+		else if (Document->Type == EJson::Object && DocumentPatch->Type == EJson::Object)
+		{
+			// merged
+			Document = MergeDocument<DocumentType>(Document.ToSharedRef(), DocumentPatch.ToSharedRef());
+		}
+		else
+		{
+			// modified
+			Document = DocumentPatch;
+		}
+	}
+	return Document;
+}
+
 template <typename DocumentType>
 TSharedPtr<FJsonValue> URpgGameData::MergeDocument(TSharedRef<FJsonValue> OriginalDocument, TSharedRef<FJsonValue> ModifiedDocument)
 {
@@ -6323,38 +7234,119 @@ void URpgGameData::ApplyVisitor(FVisitor& Visitor) const
 	}
 }
 
-void URpgGameData::ResolveAllReferences()
+int32 URpgGameData::ResolveAllReferences(const bool bBuildReferrersIndex)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(URpgGameData_ResolveAllReferences, CharonChannel);
+
+	ReferrersIndex.Reset();
+
 	auto DereferencingVisitor = URpgGameData::FDereferencingVisitor();
+	DereferencingVisitor.ReferrersIndex = bBuildReferrersIndex ? &ReferrersIndex : nullptr;
 	ApplyVisitor(DereferencingVisitor);
+
+	if (bBuildReferrersIndex)
+	{
+		ReferrersIndex.Finalize();
+	}
+	return DereferencingVisitor.UnresolvedReferenceCount;
+}
+
+void URpgGameData::FDereferencingVisitor::ResolveReference(UGameDataDocument& Document, const FName& PropertyName, const FGameDataDocumentReference& Reference)
+{
+	if (!Reference.IsValid())
+	{
+		return;
+	}
+
+	UGameDataDocument* ReferencedDocument = Reference.GetReferencedDocument();
+	if (ReferencedDocument == nullptr)
+	{
+		UnresolvedReferenceCount++;
+		UE_LOG(LogURpgGameData, Warning, TEXT("Referenced document '%s' of '%s' is not found."), *Reference.Id, *Reference.SchemaIdOrName);
+		return;
+	}
+
+	if (ReferrersIndex != nullptr)
+	{
+		ReferrersIndex->Add(ReferencedDocument, &Document, PropertyName);
+	}
 }
 
 void URpgGameData::FindAllDocuments()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(URpgGameData_FindAllDocuments, CharonChannel);
+
 	auto FindingVisitor = URpgGameData::FFindingVisitor();
 	ApplyVisitor(FindingVisitor);
 
+	AddFoundDocuments(FindingVisitor);
+}
+
+void URpgGameData::AddFoundDocuments(FFindingVisitor& FindingVisitor)
+{
+	this->RpgGameDataProjectSettingsStore.Append(FindingVisitor.ProjectSettings, /* bIsRoot */ false);
+	this->ParameterStore.Append(FindingVisitor.Parameter, /* bIsRoot */ false);
+	this->ParameterValueStore.Append(FindingVisitor.ParameterValue, /* bIsRoot */ false);
+	this->ProvisionStore.Append(FindingVisitor.Provision, /* bIsRoot */ false);
+	this->HeroStore.Append(FindingVisitor.Hero, /* bIsRoot */ false);
+	this->ItemStore.Append(FindingVisitor.Item, /* bIsRoot */ false);
+	this->LocationStore.Append(FindingVisitor.Location, /* bIsRoot */ false);
+	this->TrinketStore.Append(FindingVisitor.Trinket, /* bIsRoot */ false);
+	this->MonsterStore.Append(FindingVisitor.Monster, /* bIsRoot */ false);
+	this->LootStore.Append(FindingVisitor.Loot, /* bIsRoot */ false);
+	this->CombatEffectStore.Append(FindingVisitor.CombatEffect, /* bIsRoot */ false);
+	this->CurioCleansingOptionStore.Append(FindingVisitor.CurioCleansingOption, /* bIsRoot */ false);
+	this->CurioStore.Append(FindingVisitor.Curio, /* bIsRoot */ false);
+	this->DiseaseStore.Append(FindingVisitor.Disease, /* bIsRoot */ false);
+	this->QuirkStore.Append(FindingVisitor.Quirk, /* bIsRoot */ false);
+	this->ConditionStore.Append(FindingVisitor.Conditions, /* bIsRoot */ false);
+	this->WeaponStore.Append(FindingVisitor.Weapon, /* bIsRoot */ false);
+	this->ArmorStore.Append(FindingVisitor.Armor, /* bIsRoot */ false);
+	this->ItemWithCountStore.Append(FindingVisitor.ItemWithCount, /* bIsRoot */ false);
+	this->StartingSetStore.Append(FindingVisitor.StartingSet, /* bIsRoot */ false);
+
+	// only found documents are added, so documents created lazily one at a time don't rebuild whole dense views
+	for (UParameter* Document : FindingVisitor.Parameter)
+	{
+		if (AllParameters.FindRef(Document->Id) == Document)
+		{
+			DenseAllParameters.Add(Document->Id, Document);
+		}
+		if (Parameters.FindRef(Document->Id) == Document)
+		{
+			DenseParameters.Add(Document->Id, Document);
+		}
+	}
+}
+
+void URpgGameData::UpdateDenseCollections()
+{
+	DenseAllParameters.Build(AllParameters);
+	DenseParameters.Build(Parameters);
+}
+
+void URpgGameData::LoadAllDocuments()
+{
+	if (!LazyDocuments.IsValid())
+	{
+		return;
+	}
 
-	ToMapById(this->AllProjectSettingsList, FindingVisitor.ProjectSettings);
-	ToMapById(this->AllParameters, FindingVisitor.Parameter);
-	ToMapById(this->AllParameterValues, FindingVisitor.ParameterValue);
-	ToMapById(this->AllProvisions, FindingVisitor.Provision);
-	ToMapById(this->AllHeros, FindingVisitor.Hero);
-	ToMapById(this->AllItems, FindingVisitor.Item);
-	ToMapById(this->AllLocations, FindingVisitor.Location);
-	ToMapById(this->AllTrinkets, FindingVisitor.Trinket);
-	ToMapById(this->AllMonsters, FindingVisitor.Monster);
-	ToMapById(this->AllLoots, FindingVisitor.Loot);
-	ToMapById(this->AllCombatEffects, FindingVisitor.CombatEffect);
-	ToMapById(this->AllCurioCleansingOptions, FindingVisitor.CurioCleansingOption);
-	ToMapById(this->AllCurios, FindingVisitor.Curio);
-	ToMapById(this->AllDiseases, FindingVisitor.Disease);
-	ToMapById(this->AllQuirks, FindingVisitor.Quirk);
-	ToMapById(this->AllConditionsList, FindingVisitor.Conditions);
-	ToMapById(this->AllWeapons, FindingVisitor.Weapon);
-	ToMapById(this->AllArmors, FindingVisitor.Armor);
-	ToMapById(this->AllItemWithCounts, FindingVisitor.ItemWithCount);
-	ToMapById(this->AllStartingSets, FindingVisitor.StartingSet);
+	TArray<FString> SchemaNames;
+	LazyDocuments->GetSchemaNames(SchemaNames);
+	for (const FString& SchemaName : SchemaNames)
+	{
+		TArray<FString> DocumentIds;
+		if (LazyDocuments.IsValid())
+		{
+			LazyDocuments->GetDocumentIds(SchemaName, DocumentIds);
+		}
+		for (const FString& DocumentId : DocumentIds)
+		{
+			FindGameDataDocumentById(SchemaName, DocumentId);
+		}
+	}
+	LazyDocuments.Reset();
 }
 
 void URpgGameData::FVisitor::Visit(UGameDataDocument* Document)
@@ -6778,18 +7770,18 @@ void URpgGameData::FDereferencingVisitor::Visit(URpgGameDataProjectSettings& Doc
 }
 void URpgGameData::FDereferencingVisitor::Visit(UParameter& Document)
 {
-	if (Document.MinValueParameterRaw.IsValid())
-	{ auto _ = Document.MinValueParameterRaw.GetReferencedDocument(); }
-	if (Document.MaxValueParameterRaw.IsValid())
-	{ auto _ = Document.MaxValueParameterRaw.GetReferencedDocument(); }
+	static const FName MinValueParameterPropertyName(TEXT("MinValueParameter"));
+	static const FName MaxValueParameterPropertyName(TEXT("MaxValueParameter"));
+	ResolveReference(Document, MinValueParameterPropertyName, Document.MinValueParameterRaw);
+	ResolveReference(Document, MaxValueParameterPropertyName, Document.MaxValueParameterRaw);
 	FVisitor::Visit(Document);
 }
 void URpgGameData::FDereferencingVisitor::Visit(UParameterValue& Document)
 {
-	if (Document.ParameterRaw.IsValid())
-	{ auto _ = Document.ParameterRaw.GetReferencedDocument(); }
-	if (Document.ConditionRaw.IsValid())
-	{ auto _ = Document.ConditionRaw.GetReferencedDocument(); }
+	static const FName ParameterPropertyName(TEXT("Parameter"));
+	static const FName ConditionPropertyName(TEXT("Condition"));
+	ResolveReference(Document, ParameterPropertyName, Document.ParameterRaw);
+	ResolveReference(Document, ConditionPropertyName, Document.ConditionRaw);
 	FVisitor::Visit(Document);
 }
 void URpgGameData::FDereferencingVisitor::Visit(UProvision& Document)
@@ -6798,10 +7790,13 @@ void URpgGameData::FDereferencingVisitor::Visit(UProvision& Document)
 }
 void URpgGameData::FDereferencingVisitor::Visit(UHero& Document)
 {
-	for (auto Reference : Document.DislikeHeroesRaw)
-	{ auto _ = Reference.IsValid() ? Reference.GetReferencedDocument() : nullptr; }
-	if (Document.ProvisionsRaw.IsValid())
-	{ auto _ = Document.ProvisionsRaw.GetReferencedDocument(); }
+	static const FName DislikeHeroesPropertyName(TEXT("DislikeHeroes"));
+	static const FName ProvisionsPropertyName(TEXT("Provisions"));
+	for (const auto& Reference : Document.DislikeHeroesRaw)
+	{
+		ResolveReference(Document, DislikeHeroesPropertyName, Reference);
+	}
+	ResolveReference(Document, ProvisionsPropertyName, Document.ProvisionsRaw);
 	FVisitor::Visit(Document);
 }
 void URpgGameData::FDereferencingVisitor::Visit(UItem& Document)
@@ -6814,16 +7809,19 @@ void URpgGameData::FDereferencingVisitor::Visit(ULocation& Document)
 }
 void URpgGameData::FDereferencingVisitor::Visit(UTrinket& Document)
 {
-	if (Document.OriginDungeonRaw.IsValid())
-	{ auto _ = Document.OriginDungeonRaw.GetReferencedDocument(); }
-	if (Document.HeroRestrictionRaw.IsValid())
-	{ auto _ = Document.HeroRestrictionRaw.GetReferencedDocument(); }
+	static const FName OriginDungeonPropertyName(TEXT("OriginDungeon"));
+	static const FName HeroRestrictionPropertyName(TEXT("HeroRestriction"));
+	ResolveReference(Document, OriginDungeonPropertyName, Document.OriginDungeonRaw);
+	ResolveReference(Document, HeroRestrictionPropertyName, Document.HeroRestrictionRaw);
 	FVisitor::Visit(Document);
 }
 void URpgGameData::FDereferencingVisitor::Visit(UMonster& Document)
 {
-	for (auto Reference : Document.LocationsRaw)
-	{ auto _ = Reference.IsValid() ? Reference.GetReferencedDocument() : nullptr; }
+	static const FName LocationsPropertyName(TEXT("Locations"));
+	for (const auto& Reference : Document.LocationsRaw)
+	{
+		ResolveReference(Document, LocationsPropertyName, Reference);
+	}
 	FVisitor::Visit(Document);
 }
 void URpgGameData::FDereferencingVisitor::Visit(ULoot& Document)
@@ -6836,14 +7834,17 @@ void URpgGameData::FDereferencingVisitor::Visit(UCombatEffect& Document)
 }
 void URpgGameData::FDereferencingVisitor::Visit(UCurioCleansingOption& Document)
 {
-	if (Document.ItemRaw.IsValid())
-	{ auto _ = Document.ItemRaw.GetReferencedDocument(); }
+	static const FName ItemPropertyName(TEXT("Item"));
+	ResolveReference(Document, ItemPropertyName, Document.ItemRaw);
 	FVisitor::Visit(Document);
 }
 void URpgGameData::FDereferencingVisitor::Visit(UCurio& Document)
 {
-	for (auto Reference : Document.LocationsRaw)
-	{ auto _ = Reference.IsValid() ? Reference.GetReferencedDocument() : nullptr; }
+	static const FName LocationsPropertyName(TEXT("Locations"));
+	for (const auto& Reference : Document.LocationsRaw)
+	{
+		ResolveReference(Document, LocationsPropertyName, Reference);
+	}
 	FVisitor::Visit(Document);
 }
 void URpgGameData::FDereferencingVisitor::Visit(UDisease& Document)
@@ -6868,16 +7869,19 @@ void URpgGameData::FDereferencingVisitor::Visit(UArmor& Document)
 }
 void URpgGameData::FDereferencingVisitor::Visit(UItemWithCount& Document)
 {
-	if (Document.ItemRaw.IsValid())
-	{ auto _ = Document.ItemRaw.GetReferencedDocument(); }
+	static const FName ItemPropertyName(TEXT("Item"));
+	ResolveReference(Document, ItemPropertyName, Document.ItemRaw);
 	FVisitor::Visit(Document);
 }
 void URpgGameData::FDereferencingVisitor::Visit(UStartingSet& Document)
 {
-	for (auto Reference : Document.HeroesRaw)
-	{ auto _ = Reference.IsValid() ? Reference.GetReferencedDocument() : nullptr; }
-	if (Document.LocationRaw.IsValid())
-	{ auto _ = Document.LocationRaw.GetReferencedDocument(); }
+	static const FName HeroesPropertyName(TEXT("Heroes"));
+	static const FName LocationPropertyName(TEXT("Location"));
+	for (const auto& Reference : Document.HeroesRaw)
+	{
+		ResolveReference(Document, HeroesPropertyName, Reference);
+	}
+	ResolveReference(Document, LocationPropertyName, Document.LocationRaw);
 	FVisitor::Visit(Document);
 }
 void URpgGameData::FLanguagesUpdateVisitor::Visit(URpgGameDataProjectSettings& Document)
@@ -21,8 +21,10 @@ const FString UStartingSet::SchemaId = TEXT("5a1d78de07ff9a7b889cba83");
 const FString UStartingSet::SchemaName = TEXT("StartingSet");
 
 TMap<FString,UHero*> UStartingSet::GetHeroes() const {
-	FGameDataDocumentReference::GetReferencedDocuments(HeroesRaw, _HeroesDocuments);
-	return _HeroesDocuments;
+	return GetHeroesView();
+}
+const TMap<FString,UHero*>& UStartingSet::GetHeroesView() const {
+	return FGameDataDocumentReference::GetReferencedDocumentsCached(HeroesRaw, _HeroesDocuments, _HeroesDocumentsLoadGeneration);
 }
 ULocation* UStartingSet::GetLocation() const {
 	FGameDataDocumentReference::GetReferencedDocument(LocationRaw, _LocationDocument);
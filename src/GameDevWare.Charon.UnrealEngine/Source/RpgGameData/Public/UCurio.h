@@ -44,6 +44,7 @@ public:
 	  */
 	UPROPERTY()
 	mutable TMap<FString,ULocation*> _LocationsDocuments;
+	mutable uint32 _LocationsDocumentsLoadGeneration = 0;
 public:
 	/**
 	  * Id property of Text type. Not Empty, Unique.
@@ -90,6 +91,18 @@ public:
 	  */
 	UFUNCTION(BlueprintCallable)
 	TMap<FString,ULocation*> GetLocations() const;
+	/**
+	  * Same as GetLocations() without copying collection. Collection is built once per load of game data.
+	  */
+	const TMap<FString,ULocation*>& GetLocationsView() const;
+	/**
+	  * Call Func with each document of Locations without building collection.
+	  */
+	template <typename FuncType>
+	void ForEachLocations(FuncType&& Func) const
+	{
+		FGameDataDocumentReference::ForEachReferencedDocument<ULocation>(LocationsRaw, Forward<FuncType>(Func));
+	}
 	/**
 	  * Raw value of Locations.
 	  */
@@ -43,6 +43,7 @@ public:
 	  */
 	UPROPERTY()
 	mutable TMap<FString,UHero*> _DislikeHeroesDocuments;
+	mutable uint32 _DislikeHeroesDocumentsLoadGeneration = 0;
 	/**
 	  * De-referenced document of Provisions. Should not be directly used.
 	  */
@@ -84,6 +85,18 @@ public:
 	  */
 	UFUNCTION(BlueprintCallable)
 	TMap<FString,UHero*> GetDislikeHeroes() const;
+	/**
+	  * Same as GetDislikeHeroes() without copying collection. Collection is built once per load of game data.
+	  */
+	const TMap<FString,UHero*>& GetDislikeHeroesView() const;
+	/**
+	  * Call Func with each document of DislikeHeroes without building collection.
+	  */
+	template <typename FuncType>
+	void ForEachDislikeHeroes(FuncType&& Func) const
+	{
+		FGameDataDocumentReference::ForEachReferencedDocument<UHero>(DislikeHeroesRaw, Forward<FuncType>(Func));
+	}
 	/**
 	  * Raw value of DislikeHeroes.
 	  */
@@ -22,8 +22,19 @@
 #include "GameData/UGameDataBase.h"
 #include "GameData/FGameDataLoadOptions.h"
 #include "GameData/FGameDataDocumentIdConvert.h"
+#include "GameData/FGameDataLazyDocuments.h"
+#include "GameData/FGameDataPatchIndex.h"
+#include "GameData/FGameDataLocalizedStringPool.h"
+#include "GameData/TGameDataDenseDocumentMap.h"
+#include "GameData/FGameDataLoadStats.h"
+#include "GameData/TGameDataDocumentStore.h"
+#include "Misc/ScopeExit.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "GameData/Formatters/FGameDataReaderFactory.h"
+#include "GameData/Formatters/FGameDataCollectionsReader.h"
 #include "GameData/Formatters/IGameDataReader.h"
+#include "GameData/Formatters/TGameDataReader.h"
+#include "GameData/Formatters/FGameDataMemberNameHash.h"
 #if defined(CHARON_FEATURE_FORMULAS_V2) && CHARON_FEATURE_FORMULAS_V2
 #include "GameData/Formulas/FFormulaTypeResolver.h"
 #include "GameData/Formulas/UFormulaExpressionDefaultGlobal.h"
@@ -35,6 +46,7 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonTypes.h"
 #include "Serialization/Archive.h"
+#include "Serialization/MemoryReader.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Misc/EngineVersionComparison.h"
 #include "URpgGameDataProjectSettings.h"
@@ -97,6 +109,30 @@ public:
 
 private:
 
+	/*
+	 * Documents of each schema. Stores are serialized with asset and fill AllXXX and XXX maps, see TGameDataDocumentStore.
+	 */
+	TGameDataDocumentStore<FString,URpgGameDataProjectSettings> RpgGameDataProjectSettingsStore { AllProjectSettingsList, ProjectSettingsList };
+	TGameDataDocumentStore<int32,UStartingSet> StartingSetStore { AllStartingSets, StartingSets };
+	TGameDataDocumentStore<EParameterId,UParameter> ParameterStore { AllParameters, Parameters };
+	TGameDataDocumentStore<int32,UParameterValue> ParameterValueStore { AllParameterValues, ParameterValues };
+	TGameDataDocumentStore<FString,UProvision> ProvisionStore { AllProvisions, Provisions };
+	TGameDataDocumentStore<FString,UHero> HeroStore { AllHeros, Heros };
+	TGameDataDocumentStore<FString,UItem> ItemStore { AllItems, Items };
+	TGameDataDocumentStore<FString,ULocation> LocationStore { AllLocations, Locations };
+	TGameDataDocumentStore<FString,UTrinket> TrinketStore { AllTrinkets, Trinkets };
+	TGameDataDocumentStore<FString,UMonster> MonsterStore { AllMonsters, Monsters };
+	TGameDataDocumentStore<int32,ULoot> LootStore { AllLoots, Loots };
+	TGameDataDocumentStore<int32,UCombatEffect> CombatEffectStore { AllCombatEffects, CombatEffects };
+	TGameDataDocumentStore<int32,UCurioCleansingOption> CurioCleansingOptionStore { AllCurioCleansingOptions, CurioCleansingOptions };
+	TGameDataDocumentStore<FString,UCurio> CurioStore { AllCurios, Curios };
+	TGameDataDocumentStore<FString,UDisease> DiseaseStore { AllDiseases, Diseases };
+	TGameDataDocumentStore<FString,UQuirk> QuirkStore { AllQuirks, Quirks };
+	TGameDataDocumentStore<FString,UCondition> ConditionStore { AllConditionsList, ConditionsList };
+	TGameDataDocumentStore<FString,UWeapon> WeaponStore { AllWeapons, Weapons };
+	TGameDataDocumentStore<FString,UArmor> ArmorStore { AllArmors, Armors };
+	TGameDataDocumentStore<int32,UItemWithCount> ItemWithCountStore { AllItemWithCounts, ItemWithCounts };
+
 	UPROPERTY()
 	TMap<FString,URpgGameDataProjectSettings*> AllProjectSettingsList;
 	UPROPERTY()
@@ -109,6 +145,17 @@ private:
 	TSharedPtr<TArray<UGameDataDocument*>> RootDocuments;
 	TSharedPtr<TArray<UGameDataDocument*>> AllDocuments;
 	TSharedPtr<TMap<FString, UObject*>> NameLookupDuringLoading;
+	TSharedPtr<FGameDataLazyDocuments> LazyDocuments;
+	// documents of FGameDataLoadOptions::Patches, only valid during patched load
+	TSharedPtr<FGameDataPatchIndex> PatchIndex;
+	TSharedPtr<FGameDataLocalizedStringPool> LocalizedStringPool;
+	// FGameDataLoadOptions::Languages of last load, also applied to lazily created documents
+	TArray<FString> LanguageFilter;
+	// asset is saved before FGameDataCustomVersion::DocumentStores, stores are rebuilt from loaded maps in PostLoad()
+	bool HasLegacyDocumentMaps = false;
+	// running totals for FGameDataLoadStats
+	int32 ReadDocumentCount = 0;
+	int32 ReadReferenceCount = 0;
 
 	UPROPERTY()
 	ULanguageSwitcher* LanguageSwitcher;
@@ -132,6 +179,11 @@ public:
 	TMap<EParameterId,UParameter*> AllParameters;
 	UPROPERTY(BlueprintReadOnly)
 	TMap<EParameterId,UParameter*> Parameters;
+	/*
+	 * Views of AllParameters and Parameters indexed by EParameterId value. Rebuilt when collections are filled, use FindRef() for hot lookups.
+	 */
+	TGameDataDenseDocumentMap<EParameterId, UParameter> DenseAllParameters;
+	TGameDataDenseDocumentMap<EParameterId, UParameter> DenseParameters;
 	UPROPERTY(BlueprintReadOnly, VisibleAnywhere)
 	TMap<int32,UParameterValue*> AllParameterValues;
 	UPROPERTY(BlueprintReadOnly)
@@ -209,15 +261,24 @@ public:
 
 	virtual bool TryLoad(FArchive* const GameDataStream, EGameDataFormat Format) override;
 	bool TryLoad(FArchive* const GameDataStream, FGameDataLoadOptions Options);
+	virtual bool TryLoad(const TArrayView<const uint8> GameDataBuffer, EGameDataFormat Format) override;
+	virtual bool TryLoad(const TArrayView<const uint8> GameDataBuffer, FGameDataLoadOptions Options) override;
 
 	const TArray<UGameDataDocument*>& GetAllDocuments() const;
 	const TArray<UGameDataDocument*>& GetRootDocuments() const;
 
+	virtual void PostLoad() override;
+	virtual void Serialize(FArchive& Ar) override;
 	virtual UGameDataDocument* FindGameDataDocumentById(const FString& SchemaNameOrId, const FString& DocumentId) override;
+	virtual void FindGameDataDocumentsById(const TArrayView<const TPair<FString, FString>> SchemaNameAndDocumentIds, TArray<UGameDataDocument*>& OutDocuments) override;
 	virtual UClass* FindDocumentSchemaClass(const FString& SchemaNameOrId) override;
 	virtual void GetDocumentIds(const FString& SchemaNameOrId, TArray<FString>& OutAllIds) override;
 	virtual void GetDocumentSchemaNames(TArray<FString>& OutAllSchemaNames) override;
 	virtual void SetSupportedLanguages(const TArray<FString>& LanguageIds) override;
+	/*
+	 * Create documents which are not created yet when game data is loaded with FGameDataLoadOptions::LazyDocuments.
+	 */
+	void LoadAllDocuments();
 
 #if defined(CHARON_PLUGIN_MAJOR_VERSION) && defined(CHARON_PLUGIN_MINOR_VERSION) && \
     (CHARON_PLUGIN_MAJOR_VERSION > 2025 || (CHARON_PLUGIN_MAJOR_VERSION == 2025 && CHARON_PLUGIN_MINOR_VERSION >= 3))
@@ -226,6 +287,10 @@ public:
 		return this->RevisionHash;
 	}
 #endif
+	virtual FStringView GetGeneratorVersion() const override
+	{
+		return GeneratorVersion;
+	}
 
 	UFUNCTION(BlueprintCallable)
 	void SetLanguage(
@@ -241,6 +306,7 @@ public:
 		LanguageSwitcher->CurrentLanguageId = LanguageId;
 		LanguageSwitcher->FallbackLanguageId = FallbackLanguageId;
 		LanguageSwitcher->FallbackOption = FallbackOption;
+		LanguageSwitcher->MarkLanguageChanged();
 	}
 
 private:
@@ -250,213 +316,282 @@ private:
 	void ParseLanguageList(const FString& InLanguages, TArray<FString>& OutLanguageList);
 
 	template <typename IdType, typename DocumentType>
-	DocumentType* GetOne(const TMap<IdType, DocumentType*>& Documents) const;
+	DocumentType* GetOne(const TGameDataDocumentStore<IdType, DocumentType>& Documents) const;
 	template <typename IdType, typename DocumentType>
 	void ToMapById(TMap<IdType, DocumentType*>& DocumentsById, TArray<DocumentType*>& Documents);
 	TSharedRef<IGameDataReader> CreateReader(FArchive* const GameDataStream, const FGameDataLoadOptions& Options);
+	virtual bool TryLoadFromReader(TSharedRef<IGameDataReader> GameDataReader, const FGameDataLoadOptions& Options) override;
 
-	bool ReadGameData(const TSharedRef<IGameDataReader>& Reader);
+	bool ReadGameData(const TSharedRef<IGameDataReader>& Reader, FGameDataLoadStats& LoadStats);
+	bool ReadCollection(const TSharedRef<IGameDataReader>& Reader, const FStringView CollectionName, TArray<FString>& GameDataPath);
+	template <typename ReaderType>
+	bool ReadCollection(ReaderType& Reader, const FStringView CollectionName, TArray<FString>& GameDataPath);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		URpgGameDataProjectSettings*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UParameter*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UParameterValue*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UProvision*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UHero*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UItem*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		ULocation*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UTrinket*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UMonster*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		ULoot*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UCombatEffect*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UCurioCleansingOption*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UCurio*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UDisease*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UQuirk*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UCondition*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UWeapon*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UArmor*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UItemWithCount*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType>
 	bool ReadDocument
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		UStartingSet*& Document,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
-	template <typename IdType, typename DocumentType>
+	template <typename ReaderType, typename IdType, typename DocumentType>
 	bool ReadDocumentCollection
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		TMap<IdType,DocumentType*>& Collection,
 		int32 Capacity,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
+	template <typename ReaderType, typename IdType, typename DocumentType>
+	bool ReadDocumentCollection
+	(
+		ReaderType& Reader,
+		TGameDataDocumentStore<IdType,DocumentType>& Store,
+		int32 Capacity,
+		TArray<FString>& GameDataPath,
+		bool NextToken = true
+	);
+	template <typename ReaderType, typename DocumentType>
+	bool ReadDocumentList
+	(
+		ReaderType& Reader,
+		TArray<DocumentType*>& Documents,
+		int32 Capacity,
+		UObject* Outer,
+		TArray<FString>& GameDataPath,
+		bool NextToken = true
+	);
+	template <typename ReaderType, typename DocumentType>
+	bool ReadPatchedDocumentCollection
+	(
+		ReaderType& Reader,
+		TArray<DocumentType*>& Documents,
+		int32 Capacity,
+		TArray<FString>& GameDataPath,
+		bool NextToken = true
+	);
+	template <typename DocumentType>
+	bool ReadPatchedDocument(const TSharedPtr<FJsonValue>& PatchedDocument, TArray<DocumentType*>& Documents, TArray<FString>& GameDataPath);
+	bool ReadPatchedCollections(TArray<FString>& GameDataPath);
+	template <typename ReaderType, typename IdType, typename DocumentType>
+	bool ReadLazyDocumentCollection
+	(
+		ReaderType& Reader,
+		const FString& SchemaName,
+		TGameDataDocumentStore<IdType,DocumentType>& Store,
+		TArray<FString>& GameDataPath,
+		bool NextToken = true
+	);
+	UGameDataDocument* FindGameDataDocumentByIndex(const int32 SchemaIndex, const FString& DocumentId);
+	template <typename IdType, typename DocumentType>
+	DocumentType* FindLazyDocument(const FString& SchemaName, const IdType& Id, TGameDataDocumentStore<IdType, DocumentType>& Store);
+	template <typename ReaderType>
 	bool ReadLocalizedText
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		FLocalizedText& LocalizedText,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
 
-	template <typename DocumentReferenceType>
+	template <typename ReaderType, typename DocumentReferenceType>
 	bool ReadDocumentReferenceCollection
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		TArray<DocumentReferenceType>& Collection,
 		const FString& SchemaIdOrName,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
 
+	template <typename ReaderType>
 	bool ReadDocumentReference
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		FGameDataDocumentReference& DocumentReference,
 		const FString& SchemaIdOrName,
 		TArray<FString>& GameDataPath,
 		bool NextToken = true
 	);
 
-	template <typename FormulaType>
+	template <typename ReaderType, typename FormulaType>
 	bool ReadFormula
 	(
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		FormulaType*& Formula,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
@@ -464,7 +599,8 @@ private:
 	);
 
 	FString CombineGameDataPath(const TArray<FString>& GameDataPath);
-	TSharedPtr<FJsonObject> MergeGameData(const TSharedPtr<FJsonObject>& GameDataDocument, const TSharedPtr<FJsonObject>& PatchDocument);
+	template <typename DocumentType>
+	TSharedPtr<FJsonValue> ApplyDocumentPatches(TSharedPtr<FJsonValue> Document, const TArray<TSharedPtr<FJsonValue>>& DocumentPatches);
 	template <typename DocumentType>
 	TSharedPtr<FJsonValue> MergeDocumentCollection(TSharedRef<FJsonValue> OriginalCollection, TSharedRef<FJsonValue> ModifiedCollection, bool PurgeRest);
 	template <typename DocumentType>
@@ -477,7 +613,11 @@ private:
 	template <typename KeyType>
 	TSharedRef<TArray<KeyType>> MergeKeys(const TMap<KeyType, TSharedPtr<FJsonValue>>& Collection1, const TMap<KeyType, TSharedPtr<FJsonValue>>& Collection2);
 public:
-	void ResolveAllReferences();
+	/*
+	 * Resolve all document references, returns number of references to missing documents. Called at end of load.
+	 * Also fills index of referencing documents (see UGameDataBase::GetReferrers()) if bBuildReferrersIndex is set.
+	 */
+	int32 ResolveAllReferences(const bool bBuildReferrersIndex = false);
 	void FindAllDocuments();
 
 	class FVisitor
@@ -564,8 +704,18 @@ public:
 	};
 
 private:
+	void AddFoundDocuments(FFindingVisitor& FindingVisitor);
+	void UpdateDenseCollections();
+
 	class FDereferencingVisitor : public FVisitor
 	{
+	public:
+		int32 UnresolvedReferenceCount = 0;
+		FGameDataReferrersIndex* ReferrersIndex = nullptr;
+
+	private:
+		void ResolveReference(UGameDataDocument& Document, const FName& PropertyName, const FGameDataDocumentReference& Reference);
+
 		// visit methods
 		virtual void Visit(URpgGameDataProjectSettings& Document) override;
 		virtual void Visit(UParameter& Document) override;
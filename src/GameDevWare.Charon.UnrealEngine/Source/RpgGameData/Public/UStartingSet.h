@@ -43,6 +43,7 @@ public:
 	  */
 	UPROPERTY()
 	mutable TMap<FString,UHero*> _HeroesDocuments;
+	mutable uint32 _HeroesDocumentsLoadGeneration = 0;
 	/**
 	  * De-referenced document of Location. Should not be directly used.
 	  */
@@ -64,6 +65,18 @@ public:
 	  */
 	UFUNCTION(BlueprintCallable)
 	TMap<FString,UHero*> GetHeroes() const;
+	/**
+	  * Same as GetHeroes() without copying collection. Collection is built once per load of game data.
+	  */
+	const TMap<FString,UHero*>& GetHeroesView() const;
+	/**
+	  * Call Func with each document of Heroes without building collection.
+	  */
+	template <typename FuncType>
+	void ForEachHeroes(FuncType&& Func) const
+	{
+		FGameDataDocumentReference::ForEachReferencedDocument<UHero>(HeroesRaw, Forward<FuncType>(Func));
+	}
 	/**
 	  * Raw value of Heroes.
 	  */
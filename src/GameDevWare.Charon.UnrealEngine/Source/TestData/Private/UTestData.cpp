@@ -14,6 +14,7 @@
 // ReSharper disable All
 
 #include "UTestData.h"
+#include "GameData/FGameDataCustomVersion.h"
 #include "UTestDataProjectSettings.h"
 #include "UTestEntity.h"
 #include "URecursiveEntity.h"
@@ -87,11 +88,15 @@ TSharedRef<FFormulaTypeResolver> UTestData::GetSharedFormulaTypeResolver()
 
 void UTestData::Empty()
 {
+	// documents cached by FGameDataDocumentReference, referrers and document indexes are about to be destroyed
+	IncrementLoadGeneration();
+
 	if (LanguageSwitcher)
 	{
 		LanguageSwitcher->CurrentLanguageId = TEXT("ru-RU");
 		LanguageSwitcher->FallbackLanguageId = TEXT("ru-RU");
 		LanguageSwitcher->PrimaryLanguageId = TEXT("ru-RU");
+		LanguageSwitcher->MarkLanguageChanged();
 	}
 
 	RootDocuments = nullptr;
@@ -101,20 +106,13 @@ void UTestData::Empty()
 	RevisionHash.Empty();
 
 	ProjectSettings = nullptr;
-	AllProjectSettingsList.Reset();
-	ProjectSettingsList.Reset();
-	AllTestEntities.Reset();
-	TestEntities.Reset();
-	AllRecursiveEntities.Reset();
-	RecursiveEntities.Reset();
-	AllNumberTestEntities.Reset();
-	NumberTestEntities.Reset();
-	AllUniqueAttributeEntities.Reset();
-	UniqueAttributeEntities.Reset();
-	AllUnionTypes.Reset();
-	UnionTypes.Reset();
-	AllAllTypesTests.Reset();
-	AllTypesTests.Reset();
+	TestDataProjectSettingsStore.Reset();
+	TestEntityStore.Reset();
+	RecursiveEntityStore.Reset();
+	NumberTestEntityStore.Reset();
+	UniqueAttributeEntityStore.Reset();
+	UnionTypeStore.Reset();
+	AllTypesTestStore.Reset();
 
 	SupportedLanguages.Reset();
 
@@ -151,8 +149,81 @@ bool UTestData::TryLoad(FArchive* const GameDataStream, EGameDataFormat Format)
 }
 bool UTestData::TryLoad(FArchive* const GameDataStream, FGameDataLoadOptions Options)
 {
+	return TryLoadFromReader(CreateReader(GameDataStream, Options), Options);
+}
+bool UTestData::TryLoad(const TArrayView<const uint8> GameDataBuffer, EGameDataFormat Format)
+{
+	auto Options = FGameDataLoadOptions();
+	Options.Format = Format;
+	return TryLoad(GameDataBuffer, Options);
+}
+bool UTestData::TryLoad(const TArrayView<const uint8> GameDataBuffer, FGameDataLoadOptions Options)
+{
+	if (Options.LazyDocuments && Options.Patches.Num() == 0)
+	{
+		// only document ids are read now, documents are created from game data's own copy of buffer on first access
+		LazyDocuments = MakeShared<FGameDataLazyDocuments>();
+		const TSharedPtr<IGameDataReader> LazyDocumentsReader = LazyDocuments->Open(GameDataBuffer, Options.Format);
+		if (LazyDocumentsReader.IsValid())
+		{
+			if (Options.BuildReferrersIndex || Options.DocumentIndexes.Num() > 0 || IndexDeclarations.Num() > 0)
+			{
+				UE_LOG(LogUTestData, Warning, TEXT("Referrers index and document indexes are not built for game data loaded with 'LazyDocuments' option. Load game data without 'LazyDocuments' to use them."));
+			}
+			return TryLoadFromReader(LazyDocumentsReader.ToSharedRef(), Options);
+		}
+		LazyDocuments.Reset();
+	}
+
+	// read directly from buffer without FArchive indirection
+	switch (Options.Format)
+	{
+	case EGameDataFormat::Json: return TryLoadFromReader(FGameDataReaderFactory::CreateJsonReader(GameDataBuffer), Options);
+	case EGameDataFormat::MessagePack: return TryLoadFromReader(FGameDataReaderFactory::CreateMessagePackReader(GameDataBuffer), Options);
+	case EGameDataFormat::Compiled: return TryLoadFromReader(FGameDataReaderFactory::CreateCompiledReader(GameDataBuffer), Options);
+	default: break;
+	}
+
+	FMemoryReaderView GameDataStream(GameDataBuffer);
+	return TryLoad(&GameDataStream, Options);
+}
+bool UTestData::TryLoadFromReader(TSharedRef<IGameDataReader> GameDataReader, const FGameDataLoadOptions& Options)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UTestData_TryLoad, CharonChannel);
+
+	// stats are per collection and phase, so they are always collected and kept for 'Charon.DumpLoadStats'
+	FGameDataLoadStats LoadStats;
+	LoadStats.GameDataName = GetName();
+	LoadStats.Format = Options.Format;
+	const double LoadStartTime = FPlatformTime::Seconds();
+	ON_SCOPE_EXIT
+	{
+		LoadStats.TotalSeconds = FPlatformTime::Seconds() - LoadStartTime;
+		FGameDataLoadStats::SetLastLoadStats(LoadStats);
+		if (Options.Stats != nullptr)
+		{
+			*Options.Stats = LoadStats;
+		}
+	};
+
 	Empty(); // Reset current state
 
+	if (LazyDocuments.IsValid() && !LazyDocuments->IsReader(*GameDataReader))
+	{
+		LazyDocuments.Reset(); // documents are created during load
+	}
+
+	LanguageFilter = Options.Languages;
+
+	if (Options.PoolLocalizedTexts)
+	{
+		LocalizedStringPool = MakeShared<FGameDataLocalizedStringPool>();
+	}
+	else
+	{
+		LocalizedStringPool.Reset();
+	}
+
 	SupportedLanguages.Add(TEXT("ru-RU"));
 
 	if (LanguageSwitcher == nullptr)
@@ -162,61 +233,87 @@ bool UTestData::TryLoad(FArchive* const GameDataStream, FGameDataLoadOptions Opt
 	LanguageSwitcher->CurrentLanguageId = TEXT("ru-RU");
 	LanguageSwitcher->FallbackLanguageId = TEXT("ru-RU");
 	LanguageSwitcher->PrimaryLanguageId = TEXT("ru-RU");
+	LanguageSwitcher->MarkLanguageChanged();
 
-	auto GameDataReader = CreateReader(GameDataStream, Options);
 	GameDataReader->ReadNext(); // initialize reader and move to first token
 
 	if (Options.Patches.Num() > 0)
 	{
-		TSharedPtr<FJsonObject> GameDataDocument = nullptr;
-		if (!GameDataReader->ReadObject(GameDataDocument, /* NextToken */  false))
-		{
-			GameDataDocument = nullptr;
-			UE_LOG(LogUTestData, Error, TEXT("Failed to read Game Data from file. Probably file format is wrong or file is broken."));
-			return false;
-		}
+		TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UTestData_MergePatches, CharonChannel);
+		const double PatchMergeStartTime = FPlatformTime::Seconds();
+
+		// patches are indexed by document and applied while game data is streamed, see ReadPatchedDocumentCollection
+		PatchIndex = MakeShared<FGameDataPatchIndex>();
 		for (const auto GameDataPatchStream : Options.Patches)
 		{
 			const auto GameDataPatchReader = CreateReader(GameDataPatchStream, Options);
 			GameDataPatchReader->ReadNext(); // initialize reader and move to first token
 
-			TSharedPtr<FJsonObject> GameDataPatchDocument;
-			if (!GameDataPatchReader->ReadObject(GameDataPatchDocument, /* NextToken */  false))
+			if (!PatchIndex->AddPatch(*GameDataPatchReader, *this))
 			{
-				GameDataPatchDocument = nullptr;
+				PatchIndex.Reset();
 				UE_LOG(LogUTestData, Error, TEXT("Failed to read Game Data patch from file. Probably file format is wrong or file is broken."));
 				return false;
 			}
-
-			GameDataDocument = MergeGameData(GameDataDocument, GameDataPatchDocument);
-		}
-
-		if (GameDataDocument == nullptr)
-		{
-			UE_LOG(LogUTestData, Error, TEXT("Failed to apply Game Data patch."));
-			return false;
 		}
 
-		GameDataReader = FGameDataReaderFactory::CreateJsonObjectReader(GameDataDocument);
-		GameDataReader->ReadNext(); // initialize reader and move to first token
+		LoadStats.PatchMergeSeconds = FPlatformTime::Seconds() - PatchMergeStartTime;
 	}
 
-	if (!ReadGameData(GameDataReader))
+	const double ParseStartTime = FPlatformTime::Seconds();
+	const bool bParsed = ReadGameData(GameDataReader, LoadStats);
+	LoadStats.ParseSeconds = FPlatformTime::Seconds() - ParseStartTime;
+	PatchIndex.Reset(); // all patches are applied by now
+	if (!bParsed)
 	{
 		UE_LOG(LogUTestData, Error, TEXT("Failed to parse Game Data from file."));
 		return false;
 	}
 
+	const double FindAllDocumentsStartTime = FPlatformTime::Seconds();
 	FindAllDocuments();
+	LoadStats.FindAllDocumentsSeconds = FPlatformTime::Seconds() - FindAllDocumentsStartTime;
+
+	const double UpdateSettingsStartTime = FPlatformTime::Seconds();
 	UpdateProjectSettings();
 	UpdateSettings();
+	if (LanguageFilter.Num() > 0)
+	{
+		SupportedLanguages.RemoveAll([this](const FString& LanguageId) { return !LanguageFilter.Contains(LanguageId); });
+	}
+	LoadStats.UpdateSettingsSeconds = FPlatformTime::Seconds() - UpdateSettingsStartTime;
 
+	// lazily created documents are resolved on access, resolving them here would create all documents
+	if (!LazyDocuments.IsValid())
+	{
+		const double ResolveReferencesStartTime = FPlatformTime::Seconds();
+		LoadStats.UnresolvedReferences = ResolveAllReferences(Options.BuildReferrersIndex);
+		LoadStats.ReferrersIndexBytes = ReferrersIndex.GetAllocatedSize();
+		LoadStats.ResolveReferencesSeconds = FPlatformTime::Seconds() - ResolveReferencesStartTime;
+
+		if (IndexDeclarations.Num() > 0 || Options.DocumentIndexes.Num() > 0)
+		{
+			const double BuildIndexesStartTime = FPlatformTime::Seconds();
+			BuildDocumentIndexes(GetAllDocuments(), Options.DocumentIndexes, LanguageSwitcher->PrimaryLanguageId);
+			LoadStats.DocumentIndexesBytes = DocumentIndexes.GetAllocatedSize();
+			LoadStats.BuildIndexesSeconds = FPlatformTime::Seconds() - BuildIndexesStartTime;
+		}
+	}
+
+	if (LazyDocuments.IsValid() && LazyDocuments->IsEmpty())
+	{
+		LazyDocuments.Reset();
+	}
+
+	LoadStats.IsSucceeded = true;
 	return true;
 }
 
 void UTestData::UpdateProjectSettings()
 {
-	const auto _ProjectSettings = GetOne(this->ProjectSettingsList);
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UTestData_UpdateProjectSettings, CharonChannel);
+
+	const auto _ProjectSettings = GetOne(this->TestDataProjectSettingsStore);
 	if (_ProjectSettings == nullptr)
 	{
 		return;
@@ -248,6 +345,7 @@ void UTestData::UpdateProjectSettings()
 	}
 
 	LanguageSwitcher->CurrentLanguageId = LanguageSwitcher->FallbackLanguageId = LanguageSwitcher->PrimaryLanguageId;
+	LanguageSwitcher->MarkLanguageChanged();
 	if (!SupportedLanguages.Contains(LanguageSwitcher->PrimaryLanguageId))
 	{
 		SupportedLanguages.Add(LanguageSwitcher->PrimaryLanguageId);
@@ -266,7 +364,9 @@ void UTestData::ParseLanguageList(const FString& InLanguages, TArray<FString>& O
 
 void UTestData::UpdateSettings()
 {
-	this->ProjectSettings = GetOne(this->ProjectSettingsList);
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UTestData_UpdateSettings, CharonChannel);
+
+	this->ProjectSettings = GetOne(this->TestDataProjectSettingsStore);
 }
 
 const TArray<UGameDataDocument*>& UTestData::GetAllDocuments() const
@@ -277,34 +377,13 @@ const TArray<UGameDataDocument*>& UTestData::GetAllDocuments() const
 	}
 
 	const auto FoundDocuments = MakeShared<TArray<UGameDataDocument*>>();
-	for (const auto DocumentById : AllProjectSettingsList)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllTestEntities)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllRecursiveEntities)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllNumberTestEntities)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllUniqueAttributeEntities)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllUnionTypes)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllAllTypesTests)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
+	TestDataProjectSettingsStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	TestEntityStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	RecursiveEntityStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	NumberTestEntityStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	UniqueAttributeEntityStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	UnionTypeStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
+	AllTypesTestStore.AppendTo(*FoundDocuments, /* bRootOnly */ false);
 	const_cast<UTestData*>(this)->AllDocuments = FoundDocuments;
 	return FoundDocuments.Get();
 }
@@ -317,45 +396,29 @@ const TArray<UGameDataDocument*>& UTestData::GetRootDocuments() const
 	}
 
 	const auto FoundDocuments = MakeShared<TArray<UGameDataDocument*>>();
-	for (const auto DocumentById : ProjectSettingsList)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : TestEntities)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : RecursiveEntities)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : NumberTestEntities)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : UniqueAttributeEntities)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : UnionTypes)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
-	for (const auto DocumentById : AllTypesTests)
-	{
-		FoundDocuments->Add(DocumentById.Value);
-	}
+	TestDataProjectSettingsStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	TestEntityStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	RecursiveEntityStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	NumberTestEntityStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	UniqueAttributeEntityStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	UnionTypeStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
+	AllTypesTestStore.AppendTo(*FoundDocuments, /* bRootOnly */ true);
 	const_cast<UTestData*>(this)->RootDocuments = FoundDocuments;
 	return FoundDocuments.Get();
 }
 
 template <typename IdType, typename DocumentType>
-DocumentType* UTestData::GetOne(const TMap<IdType, DocumentType*>& Documents) const
+DocumentType* UTestData::GetOne(const TGameDataDocumentStore<IdType, DocumentType>& Documents) const
 {
-	if (Documents.Num() == 1)
+	if (Documents.NumRoots() == 1)
 	{
-        auto Iterator = Documents.CreateConstIterator();
-        return Iterator->Value;
+		for (int32 Index = 0; Index < Documents.Num(); Index++)
+		{
+			if (Documents.IsRoot(Index))
+			{
+				return Documents.GetDocuments()[Index];
+			}
+		}
 	}
 	return nullptr;
 }
@@ -363,87 +426,240 @@ DocumentType* UTestData::GetOne(const TMap<IdType, DocumentType*>& Documents) co
 template <typename IdType, typename DocumentType>
 void UTestData::ToMapById(TMap<IdType, DocumentType*>& DocumentsById, TArray<DocumentType*>& Documents)
 {
+	DocumentsById.Reserve(DocumentsById.Num() + Documents.Num());
 	for (auto Document : Documents)
 	{
 		DocumentsById.FindOrAdd(Document->Id, Document);
 	}
 }
 
+static int32 UTestData_FindSchemaIndex(const FString& SchemaNameOrId)
+{
+	// schema name and schema id both map into schema index, FString keys are compared case-insensitively
+	static const TMap<FString, int32> SchemaIndexByNameOrId = {
+		{ TEXT("ProjectSettings"), 0 }, { TEXT("55a4f32faca22e191098f3d9"), 0 },
+		{ TEXT("TestEntity"), 1 }, { TEXT("592fc86c983a36266c0912a0"), 1 },
+		{ TEXT("RecursiveEntity"), 2 }, { TEXT("592fc894983a36266c0912a4"), 2 },
+		{ TEXT("NumberTestEntity"), 3 }, { TEXT("592fdb43983a3619c016b696"), 3 },
+		{ TEXT("UniqueAttributeEntity"), 4 }, { TEXT("65d3565e27363a98010000ec"), 4 },
+		{ TEXT("UnionType"), 5 }, { TEXT("691255870642d17fc832c712"), 5 },
+		{ TEXT("AllTypesTest"), 6 }, { TEXT("697fa0a4ecd20b7208b73d2d"), 6 },
+	};
+	const int32* FoundIndex = SchemaIndexByNameOrId.Find(SchemaNameOrId);
+	return FoundIndex != nullptr ? *FoundIndex : INDEX_NONE;
+}
+
+void UTestData::PostLoad()
+{
+	Super::PostLoad();
+
+	if (HasLegacyDocumentMaps)
+	{
+		// maps are loaded as tagged properties of older asset, documents are moved into stores
+		UE_LOG(LogUTestData, Log, TEXT("Game data asset '%s' is saved in older format, it should be re-saved."), *GetPathName());
+		HasLegacyDocumentMaps = false;
+		TestDataProjectSettingsStore.RebuildFromIdMaps();
+		TestEntityStore.RebuildFromIdMaps();
+		RecursiveEntityStore.RebuildFromIdMaps();
+		NumberTestEntityStore.RebuildFromIdMaps();
+		UniqueAttributeEntityStore.RebuildFromIdMaps();
+		UnionTypeStore.RebuildFromIdMaps();
+		AllTypesTestStore.RebuildFromIdMaps();
+	}
+	else
+	{
+		// ids are not serialized, documents are loaded by now
+		TestDataProjectSettingsStore.RebuildIdMaps();
+		TestEntityStore.RebuildIdMaps();
+		RecursiveEntityStore.RebuildIdMaps();
+		NumberTestEntityStore.RebuildIdMaps();
+		UniqueAttributeEntityStore.RebuildIdMaps();
+		UnionTypeStore.RebuildIdMaps();
+		AllTypesTestStore.RebuildIdMaps();
+	}
+
+	if (IndexDeclarations.Num() > 0)
+	{
+		BuildDocumentIndexes(GetAllDocuments(), TArrayView<const FGameDataDocumentIndexDeclaration>(), LanguageSwitcher != nullptr ? LanguageSwitcher->PrimaryLanguageId : FString());
+	}
+}
+
+void UTestData::Serialize(FArchive& Ar)
+{
+	// maps are filled from stores on load, empty maps equal class default and are not written with tagged properties
+	const bool IsSavingAsset = Ar.IsSaving() && Ar.IsPersistent() && !Ar.IsTransacting();
+	if (IsSavingAsset)
+	{
+		TestDataProjectSettingsStore.DetachIdMaps();
+		TestEntityStore.DetachIdMaps();
+		RecursiveEntityStore.DetachIdMaps();
+		NumberTestEntityStore.DetachIdMaps();
+		UniqueAttributeEntityStore.DetachIdMaps();
+		UnionTypeStore.DetachIdMaps();
+		AllTypesTestStore.DetachIdMaps();
+	}
+	Super::Serialize(Ar);
+	if (IsSavingAsset)
+	{
+		TestDataProjectSettingsStore.AttachIdMaps();
+		TestEntityStore.AttachIdMaps();
+		RecursiveEntityStore.AttachIdMaps();
+		NumberTestEntityStore.AttachIdMaps();
+		UniqueAttributeEntityStore.AttachIdMaps();
+		UnionTypeStore.AttachIdMaps();
+		AllTypesTestStore.AttachIdMaps();
+	}
+
+	Ar.UsingCustomVersion(FGameDataCustomVersion::GUID);
+	HasLegacyDocumentMaps = Ar.IsLoading() && Ar.CustomVer(FGameDataCustomVersion::GUID) < FGameDataCustomVersion::DocumentStores;
+	if (HasLegacyDocumentMaps)
+	{
+		return;
+	}
+
+	TestDataProjectSettingsStore.Serialize(Ar);
+	TestEntityStore.Serialize(Ar);
+	RecursiveEntityStore.Serialize(Ar);
+	NumberTestEntityStore.Serialize(Ar);
+	UniqueAttributeEntityStore.Serialize(Ar);
+	UnionTypeStore.Serialize(Ar);
+	AllTypesTestStore.Serialize(Ar);
+}
+
 UGameDataDocument* UTestData::FindGameDataDocumentById(const FString& SchemaNameOrId, const FString& DocumentId)
 {
 	if (SchemaNameOrId.IsEmpty() || DocumentId.IsEmpty())
 	{
 		return nullptr;
 	}
-	else if (SchemaNameOrId == TEXT("ProjectSettings") || SchemaNameOrId == TEXT("55a4f32faca22e191098f3d9"))
+
+	return FindGameDataDocumentByIndex(UTestData_FindSchemaIndex(SchemaNameOrId), DocumentId);
+}
+
+void UTestData::FindGameDataDocumentsById(const TArrayView<const TPair<FString, FString>> SchemaNameAndDocumentIds, TArray<UGameDataDocument*>& OutDocuments)
+{
+	OutDocuments.Reset(SchemaNameAndDocumentIds.Num());
+
+	const FString* LastSchemaNameOrId = nullptr;
+	int32 SchemaIndex = INDEX_NONE;
+	for (const TPair<FString, FString>& SchemaNameAndDocumentId : SchemaNameAndDocumentIds)
 	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllProjectSettingsList.Find(Id);
-		if (FoundDocument != nullptr)
+		if (LastSchemaNameOrId == nullptr || !LastSchemaNameOrId->Equals(SchemaNameAndDocumentId.Key, ESearchCase::CaseSensitive))
 		{
-			return *FoundDocument;
+			LastSchemaNameOrId = &SchemaNameAndDocumentId.Key;
+			SchemaIndex = UTestData_FindSchemaIndex(SchemaNameAndDocumentId.Key);
 		}
+		OutDocuments.Add(SchemaNameAndDocumentId.Value.IsEmpty() ? nullptr : FindGameDataDocumentByIndex(SchemaIndex, SchemaNameAndDocumentId.Value));
 	}
-	else if (SchemaNameOrId == TEXT("TestEntity") || SchemaNameOrId == TEXT("592fc86c983a36266c0912a0"))
+}
+
+UGameDataDocument* UTestData::FindGameDataDocumentByIndex(const int32 SchemaIndex, const FString& DocumentId)
+{
+	switch (SchemaIndex)
 	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllTestEntities.Find(Id);
-		if (FoundDocument != nullptr)
+	case 0: // ProjectSettings
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllProjectSettingsList.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("RecursiveEntity") || SchemaNameOrId == TEXT("592fc894983a36266c0912a4"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllRecursiveEntities.Find(Id);
-		if (FoundDocument != nullptr)
+	case 1: // TestEntity
+		{
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllTestEntities.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("TestEntity"), Id, this->TestEntityStore);
+			}
+			break;
+		}
+	case 2: // RecursiveEntity
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllRecursiveEntities.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("RecursiveEntity"), Id, this->RecursiveEntityStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("NumberTestEntity") || SchemaNameOrId == TEXT("592fdb43983a3619c016b696"))
-	{
-		int32 Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllNumberTestEntities.Find(Id);
-		if (FoundDocument != nullptr)
+	case 3: // NumberTestEntity
 		{
-			return *FoundDocument;
+			int32 Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllNumberTestEntities.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("NumberTestEntity"), Id, this->NumberTestEntityStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("UniqueAttributeEntity") || SchemaNameOrId == TEXT("65d3565e27363a98010000ec"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllUniqueAttributeEntities.Find(Id);
-		if (FoundDocument != nullptr)
+	case 4: // UniqueAttributeEntity
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllUniqueAttributeEntities.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("UniqueAttributeEntity"), Id, this->UniqueAttributeEntityStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("UnionType") || SchemaNameOrId == TEXT("691255870642d17fc832c712"))
-	{
-		int32 Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllUnionTypes.Find(Id);
-		if (FoundDocument != nullptr)
+	case 5: // UnionType
 		{
-			return *FoundDocument;
+			int32 Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllUnionTypes.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("UnionType"), Id, this->UnionTypeStore);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("AllTypesTest") || SchemaNameOrId == TEXT("697fa0a4ecd20b7208b73d2d"))
-	{
-		FString Id;
-		FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
-		const auto FoundDocument = this->AllAllTypesTests.Find(Id);
-		if (FoundDocument != nullptr)
+	case 6: // AllTypesTest
 		{
-			return *FoundDocument;
+			FString Id;
+			FGameDataDocumentIdConvert::ConvertToType(DocumentId, Id);
+			const auto FoundDocument = this->AllAllTypesTests.Find(Id);
+			if (FoundDocument != nullptr)
+			{
+				return *FoundDocument;
+			}
+			if (LazyDocuments.IsValid())
+			{
+				return FindLazyDocument(TEXT("AllTypesTest"), Id, this->AllTypesTestStore);
+			}
+			break;
 		}
+	default:
+		break;
 	}
 	return nullptr;
 }
@@ -454,33 +670,25 @@ UClass* UTestData::FindDocumentSchemaClass(const FString& SchemaNameOrId)
 	{
 		return nullptr;
 	}
-	else if (SchemaNameOrId == TEXT("ProjectSettings") || SchemaNameOrId == TEXT("55a4f32faca22e191098f3d9"))
+
+	switch (UTestData_FindSchemaIndex(SchemaNameOrId))
 	{
+	case 0: // ProjectSettings
 		return UTestDataProjectSettings::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("TestEntity") || SchemaNameOrId == TEXT("592fc86c983a36266c0912a0"))
-	{
+	case 1: // TestEntity
 		return UTestEntity::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("RecursiveEntity") || SchemaNameOrId == TEXT("592fc894983a36266c0912a4"))
-	{
+	case 2: // RecursiveEntity
 		return URecursiveEntity::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("NumberTestEntity") || SchemaNameOrId == TEXT("592fdb43983a3619c016b696"))
-	{
+	case 3: // NumberTestEntity
 		return UNumberTestEntity::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("UniqueAttributeEntity") || SchemaNameOrId == TEXT("65d3565e27363a98010000ec"))
-	{
+	case 4: // UniqueAttributeEntity
 		return UUniqueAttributeEntity::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("UnionType") || SchemaNameOrId == TEXT("691255870642d17fc832c712"))
-	{
+	case 5: // UnionType
 		return UUnionType::StaticClass();
-	}
-	else if (SchemaNameOrId == TEXT("AllTypesTest") || SchemaNameOrId == TEXT("697fa0a4ecd20b7208b73d2d"))
-	{
+	case 6: // AllTypesTest
 		return UAllTypesTest::StaticClass();
+	default:
+		break;
 	}
 	return nullptr;
 }
@@ -491,68 +699,105 @@ void UTestData::GetDocumentIds(const FString& SchemaNameOrId, TArray<FString>& A
 	{
 		return;
 	}
-	else if (SchemaNameOrId == TEXT("ProjectSettings") || SchemaNameOrId == TEXT("55a4f32faca22e191098f3d9"))
+
+	switch (UTestData_FindSchemaIndex(SchemaNameOrId))
 	{
-		for (auto DocumentById : AllProjectSettingsList)
+	case 0: // ProjectSettings
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllProjectSettingsList)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("TestEntity") || SchemaNameOrId == TEXT("592fc86c983a36266c0912a0"))
-	{
-		for (auto DocumentById : AllTestEntities)
+	case 1: // TestEntity
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllTestEntities)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("TestEntity"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("RecursiveEntity") || SchemaNameOrId == TEXT("592fc894983a36266c0912a4"))
-	{
-		for (auto DocumentById : AllRecursiveEntities)
+	case 2: // RecursiveEntity
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllRecursiveEntities)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("RecursiveEntity"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("NumberTestEntity") || SchemaNameOrId == TEXT("592fdb43983a3619c016b696"))
-	{
-		for (auto DocumentById : AllNumberTestEntities)
+	case 3: // NumberTestEntity
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllNumberTestEntities)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("NumberTestEntity"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("UniqueAttributeEntity") || SchemaNameOrId == TEXT("65d3565e27363a98010000ec"))
-	{
-		for (auto DocumentById : AllUniqueAttributeEntities)
+	case 4: // UniqueAttributeEntity
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllUniqueAttributeEntities)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("UniqueAttributeEntity"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("UnionType") || SchemaNameOrId == TEXT("691255870642d17fc832c712"))
-	{
-		for (auto DocumentById : AllUnionTypes)
+	case 5: // UnionType
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllUnionTypes)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("UnionType"), AllIds);
+			}
+			break;
 		}
-	}
-	else if (SchemaNameOrId == TEXT("AllTypesTest") || SchemaNameOrId == TEXT("697fa0a4ecd20b7208b73d2d"))
-	{
-		for (auto DocumentById : AllAllTypesTests)
+	case 6: // AllTypesTest
 		{
-			FString IdString;
-			FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
-			AllIds.Add(IdString);
+			for (auto DocumentById : AllAllTypesTests)
+			{
+				FString IdString;
+				FGameDataDocumentIdConvert::ConvertToString(DocumentById.Key, IdString);
+				AllIds.Add(IdString);
+			}
+			if (LazyDocuments.IsValid())
+			{
+				LazyDocuments->GetDocumentIds(TEXT("AllTypesTest"), AllIds);
+			}
+			break;
 		}
+	default:
+		break;
 	}
 }
 
@@ -569,8 +814,19 @@ void UTestData::GetDocumentSchemaNames(TArray<FString>& AllSchemaNames)
 
 void UTestData::SetSupportedLanguages(const TArray<FString>& LanguageIds)
 {
+	LoadAllDocuments(); // documents created later would keep removed languages
+
 	auto LanguagesUpdateVisitor = UTestData::FLanguagesUpdateVisitor(LanguageIds);
 	ApplyVisitor(LanguagesUpdateVisitor);
+
+	if (LocalizedStringPool.IsValid())
+	{
+		LocalizedStringPool->RemoveLanguagesExcept(LanguageIds);
+	}
+	if (LanguageSwitcher != nullptr)
+	{
+		LanguageSwitcher->MarkLanguageChanged(); // cached texts could be of removed language
+	}
 }
 
 
@@ -582,6 +838,8 @@ TSharedRef<IGameDataReader> UTestData::CreateReader(FArchive* const GameDataStre
 		return FGameDataReaderFactory::CreateJsonReader(GameDataStream);
 	case EGameDataFormat::MessagePack:
 		return FGameDataReaderFactory::CreateMessagePackReader(GameDataStream);
+	case EGameDataFormat::Compiled:
+		return FGameDataReaderFactory::CreateCompiledReader(GameDataStream);
 	default:
 		UE_LOG(LogUTestData, Error, TEXT("Unknown game data format specified in FGameDataLoadOptions. Fallback to JSON formatter."));
 		return FGameDataReaderFactory::CreateJsonReader(GameDataStream);
@@ -793,8 +1051,18 @@ static void UTestData_SweepMarkedChildDocuments(UObject* Document)
 	}
 }
 
-bool UTestData::ReadGameData(const TSharedRef<IGameDataReader>& Reader)
+static void UTestData_SetGameDataPathTail(TArray<FString>& GameDataPath, const FStringView& PropertyName)
+{
+	// overwrite last path segment in-place to avoid string allocation per property
+	FString& PathTail = GameDataPath.Last();
+	PathTail.Reset();
+	PathTail.AppendChars(PropertyName.GetData(), PropertyName.Len());
+}
+
+bool UTestData::ReadGameData(const TSharedRef<IGameDataReader>& Reader, FGameDataLoadStats& LoadStats)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UTestData_ReadGameData, CharonChannel);
+
 	auto GameDataPath = TArray<FString>();
 	GameDataPath.Add(TEXT(""));
 
@@ -815,7 +1083,7 @@ bool UTestData::ReadGameData(const TSharedRef<IGameDataReader>& Reader)
 			return false;
 		}
 
-		auto MemberName = Reader->ReadMember();
+		const FStringView MemberName = Reader->ReadMemberView();
 		if (MemberName == TEXT("ChangeNumber"))
 		{
 			Reader->ReadValue(ChangeNumber);
@@ -829,155 +1097,32 @@ bool UTestData::ReadGameData(const TSharedRef<IGameDataReader>& Reader)
 		else if (MemberName == TEXT("Collections"))
 		{
 			GameDataPath.Add(TEXT("Collections"));
-			Reader->ReadObjectBegin();
-			while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
-			{
-				if (Reader->IsError())
-				{
-					UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-					return false;
-				}
-
-				auto CollectionName = Reader->ReadMember();
-				GameDataPath.Add(CollectionName);
-				switch (CollectionName.Len())
-				{
-					case 9:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("691255870642d17fc832c712") || CollectionName == TEXT("UnionType"))
-						{
-							GameDataPath.Add(TEXT("UnionType"));
-							if (!ReadDocumentCollection(Reader, this->UnionTypes, 100, this, GameDataPath))
-							{
-								UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("UnionType"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 10:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("592fc86c983a36266c0912a0") || CollectionName == TEXT("TestEntity"))
-						{
-							GameDataPath.Add(TEXT("TestEntity"));
-							if (!ReadDocumentCollection(Reader, this->TestEntities, 1, this, GameDataPath))
-							{
-								UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("TestEntity"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 12:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("697fa0a4ecd20b7208b73d2d") || CollectionName == TEXT("AllTypesTest"))
-						{
-							GameDataPath.Add(TEXT("AllTypesTest"));
-							if (!ReadDocumentCollection(Reader, this->AllTypesTests, 100, this, GameDataPath))
-							{
-								UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("AllTypesTest"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 15:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("55a4f32faca22e191098f3d9") || CollectionName == TEXT("ProjectSettings"))
-						{
-							GameDataPath.Add(TEXT("ProjectSettings"));
-							if (!ReadDocumentCollection(Reader, this->ProjectSettingsList, 1, this, GameDataPath))
-							{
-								UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("ProjectSettings"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else if (CollectionName == TEXT("592fc894983a36266c0912a4") || CollectionName == TEXT("RecursiveEntity"))
-						{
-							GameDataPath.Add(TEXT("RecursiveEntity"));
-							if (!ReadDocumentCollection(Reader, this->RecursiveEntities, 1, this, GameDataPath))
-							{
-								UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("RecursiveEntity"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 16:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("592fdb43983a3619c016b696") || CollectionName == TEXT("NumberTestEntity"))
-						{
-							GameDataPath.Add(TEXT("NumberTestEntity"));
-							if (!ReadDocumentCollection(Reader, this->NumberTestEntities, 2, this, GameDataPath))
-							{
-								UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("NumberTestEntity"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					case 21:
-						if (CollectionName.IsEmpty())
-						{
-							Reader->SkipAny();
-						}
-						else if (CollectionName == TEXT("65d3565e27363a98010000ec") || CollectionName == TEXT("UniqueAttributeEntity"))
-						{
-							GameDataPath.Add(TEXT("UniqueAttributeEntity"));
-							if (!ReadDocumentCollection(Reader, this->UniqueAttributeEntities, 1, this, GameDataPath))
-							{
-								UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("UniqueAttributeEntity"), *CombineGameDataPath(GameDataPath));
-								return false;
-							}
-							GameDataPath.Pop();
-						}
-						else
-						{
-							Reader->SkipAny();
-						}
-						break;
-					default:
-						Reader->SkipAny();
-						break;
-				}
-			}
-			Reader->ReadObjectEnd();
+			// collections are decoded in parallel when reader is backed by in-memory buffer, see FGameDataCollectionsReader
+			// lazily loaded collections are only scanned for document ids, so they are never decoded
+			FGameDataCollectionsReader CollectionsReader(Reader, LazyDocuments.IsValid() ? MAX_int64 : FGameDataCollectionsReader::DEFAULT_MIN_PARALLEL_SIZE);
+			CollectionsReader.ReadBegin();
+			FStringView CollectionName;
+			while (CollectionsReader.ReadNextCollection(CollectionName))
+			{
+				GameDataPath.Emplace(CollectionName);
+				LoadStats.BeginCollection(CollectionName, CollectionsReader.GetCollectionSize(), ReadDocumentCount, ReadReferenceCount);
+				bool bReadSuccess;
+				{
+					TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*GameDataPath.Last(), CharonChannel);
+					bReadSuccess = ReadCollection(CollectionsReader.GetCollectionReader(), CollectionName, GameDataPath);
+				}
+				LoadStats.EndCollection(ReadDocumentCount, ReadReferenceCount);
+				if (!bReadSuccess)
+				{
+					return false;
+				}
+				GameDataPath.Pop();
+			}
+			if (CollectionsReader.IsError())
+			{
+				UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *CollectionsReader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+				return false;
+			}
 			GameDataPath.Pop();
 			break;
 		}
@@ -986,6 +1131,12 @@ bool UTestData::ReadGameData(const TSharedRef<IGameDataReader>& Reader)
 			Reader->SkipAny();
 		}
 	}
+
+	if (PatchIndex.IsValid() && !ReadPatchedCollections(GameDataPath))
+	{
+		return false;
+	}
+
 	Reader->ReadObjectEnd();
 	GameDataPath.Pop();
 
@@ -1001,172 +1152,419 @@ bool UTestData::ReadGameData(const TSharedRef<IGameDataReader>& Reader)
 	return true;
 }
 
-bool UTestData::ReadDocument
-(
-	const TSharedRef<IGameDataReader>& Reader,
-	UTestDataProjectSettings*& Document,
-	UObject* Outer,
-	TArray<FString>& GameDataPath,
-	bool NextToken
-)
+bool UTestData::ReadPatchedCollections(TArray<FString>& GameDataPath)
 {
-	Document = NewObject<UTestDataProjectSettings>(Outer, UTestDataProjectSettings::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
-	Outer = Document;
+	if (PatchIndex->GetChangeNumber().IsSet())
+	{
+		ChangeNumber = PatchIndex->GetChangeNumber().GetValue();
+	}
+	if (PatchIndex->GetRevisionHash().IsSet())
+	{
+		RevisionHash = PatchIndex->GetRevisionHash().GetValue();
+	}
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	// collections which are only in patches are read as empty ones, patched documents are added by ReadPatchedDocumentCollection
+	TArray<FString> SchemaNames;
+	PatchIndex->GetSchemaNames(SchemaNames);
+	GameDataPath.Add(TEXT("Collections"));
+	for (const FString& SchemaName : SchemaNames)
 	{
-		if (Reader->IsError())
+		const auto EmptyCollections = MakeShared<FJsonObject>();
+		EmptyCollections->SetArrayField(SchemaName, TArray<TSharedPtr<FJsonValue>>());
+		const TSharedRef<IGameDataReader> CollectionReader = FGameDataReaderFactory::CreateJsonObjectReader(EmptyCollections);
+		CollectionReader->ReadNext(); // initialize reader and move to first token
+		CollectionReader->ReadObjectBegin();
+
+		GameDataPath.Add(SchemaName);
+		if (!ReadCollection(CollectionReader, SchemaName, GameDataPath))
 		{
-			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
+		GameDataPath.Pop();
+	}
+	GameDataPath.Pop();
 
-		auto PropertyName = Reader->ReadMember();
-		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
+	return true;
+}
+
+bool UTestData::ReadCollection(const TSharedRef<IGameDataReader>& Reader, const FStringView CollectionName, TArray<FString>& GameDataPath)
+{
+	// documents are read with statically bound reader when its type is known, see TGameDataReader
+	return FGameDataReaderDispatch::Visit(*Reader, [&](auto& TypedReader)
+	{
+		return ReadCollection(TypedReader, CollectionName, GameDataPath);
+	});
+}
+
+template <typename ReaderType>
+bool UTestData::ReadCollection(ReaderType& Reader, const FStringView CollectionName, TArray<FString>& GameDataPath)
+{
+	switch (CollectionName.Len())
+	{
+		case 9:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("691255870642d17fc832c712") || CollectionName == TEXT("UnionType"))
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("UnionType"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("UnionType"), this->UnionTypeStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->UnionTypeStore, 100, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("UnionType"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			FString NewName = UTestData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UTestDataProjectSettings* ExistingDocument = Cast<UTestDataProjectSettings>(ExistingObject);
-			if (ExistingDocument)
+			else
 			{
-				UTestData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->Name = Document->Name;
-				ExistingDocument->PrimaryLanguage = Document->PrimaryLanguage;
-				ExistingDocument->Languages = Document->Languages;
-				ExistingDocument->Copyright = Document->Copyright;
-				ExistingDocument->Version = Document->Version;
-				ExistingDocument->Extensions = Document->Extensions;
-
-				UTestData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
+				Reader.SkipAny();
 			}
-			else if (ExistingObject)
+			break;
+		case 10:
+			if (CollectionName.IsEmpty())
+			{
+				Reader.SkipAny();
+			}
+			else if (CollectionName == TEXT("592fc86c983a36266c0912a0") || CollectionName == TEXT("TestEntity"))
 			{
-				UTestData_TryDeleteDocument(ExistingObject);
-				UTestData_TryRenameDocument(Document, *NewName);
+				GameDataPath.Add(TEXT("TestEntity"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("TestEntity"), this->TestEntityStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->TestEntityStore, 1, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("TestEntity"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
 			else
 			{
-				UTestData_TryRenameDocument(Document, *NewName);
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("Name"))
-		{
-			if (Reader->IsNull())
+			break;
+		case 12:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Name) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("697fa0a4ecd20b7208b73d2d") || CollectionName == TEXT("AllTypesTest"))
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Name"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("AllTypesTest"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("AllTypesTest"), this->AllTypesTestStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->AllTypesTestStore, 100, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("AllTypesTest"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-		}
-		else if (PropertyName == TEXT("PrimaryLanguage"))
-		{
-			if (Reader->IsNull())
+			else
 			{
-				Reader->ReadNext();
-				continue;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->PrimaryLanguage) && Reader->ReadNext();
-			if (!bReadSuccess)
+			break;
+		case 15:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.PrimaryLanguage"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("Languages"))
-		{
-			if (Reader->IsNull())
+			else if (CollectionName == TEXT("55a4f32faca22e191098f3d9") || CollectionName == TEXT("ProjectSettings"))
 			{
-				Reader->ReadNext();
-				continue;
+				GameDataPath.Add(TEXT("ProjectSettings"));
+				if (!ReadDocumentCollection(Reader, this->TestDataProjectSettingsStore, 1, GameDataPath))
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("ProjectSettings"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Languages) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("592fc894983a36266c0912a4") || CollectionName == TEXT("RecursiveEntity"))
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Languages"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("RecursiveEntity"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("RecursiveEntity"), this->RecursiveEntityStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->RecursiveEntityStore, 1, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("RecursiveEntity"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-		}
-		else if (PropertyName == TEXT("Copyright"))
-		{
-			if (Reader->IsNull())
+			else
 			{
-				Reader->ReadNext();
-				continue;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Copyright) && Reader->ReadNext();
-			if (!bReadSuccess)
+			break;
+		case 16:
+			if (CollectionName.IsEmpty())
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Copyright"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("Version"))
-		{
-			if (Reader->IsNull())
+			else if (CollectionName == TEXT("592fdb43983a3619c016b696") || CollectionName == TEXT("NumberTestEntity"))
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Version"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("NumberTestEntity"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("NumberTestEntity"), this->NumberTestEntityStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->NumberTestEntityStore, 2, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("NumberTestEntity"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Version) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Version"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Reader.SkipAny();
 			}
-		}
-		else if (PropertyName == TEXT("Extensions"))
-		{
-			if (Reader->IsNull())
+			break;
+		case 21:
+			if (CollectionName.IsEmpty())
 			{
-				Reader->ReadNext();
-				continue;
+				Reader.SkipAny();
 			}
-			bReadSuccess = Reader->ReadValue(Document->Extensions) && Reader->ReadNext();
-			if (!bReadSuccess)
+			else if (CollectionName == TEXT("65d3565e27363a98010000ec") || CollectionName == TEXT("UniqueAttributeEntity"))
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Extensions"), *CombineGameDataPath(GameDataPath));
-				return false;
+				GameDataPath.Add(TEXT("UniqueAttributeEntity"));
+				const bool bReadSuccess = LazyDocuments.IsValid() ?
+					ReadLazyDocumentCollection(Reader, TEXT("UniqueAttributeEntity"), this->UniqueAttributeEntityStore, GameDataPath) :
+					ReadDocumentCollection(Reader, this->UniqueAttributeEntityStore, 1, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read '%s' document collection. Path: %s."), TEXT("UniqueAttributeEntity"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				GameDataPath.Pop();
 			}
+			else
+			{
+				Reader.SkipAny();
+			}
+			break;
+		default:
+			Reader.SkipAny();
+			break;
+	}
+	return true;
+}
+
+template <typename ReaderType>
+bool UTestData::ReadDocument
+(
+	ReaderType& Reader,
+	UTestDataProjectSettings*& Document,
+	UObject* Outer,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	Document = NewObject<UTestDataProjectSettings>(Outer, UTestDataProjectSettings::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
+	Outer = Document;
+
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
+	{
+		if (Reader.IsError())
+		{
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			return false;
 		}
-		else
+
+		const FStringView PropertyName = Reader.ReadMemberView();
+		bool bReadSuccess;
+		UTestData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			Reader->SkipAny();
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
+			{
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = UTestData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UTestDataProjectSettings* ExistingDocument = Cast<UTestDataProjectSettings>(ExistingObject);
+				if (ExistingDocument)
+				{
+					UTestData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->Name = Document->Name;
+					ExistingDocument->PrimaryLanguage = Document->PrimaryLanguage;
+					ExistingDocument->Languages = Document->Languages;
+					ExistingDocument->Copyright = Document->Copyright;
+					ExistingDocument->Version = Document->Version;
+					ExistingDocument->Extensions = Document->Extensions;
+
+					UTestData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					UTestData_TryDeleteDocument(ExistingObject);
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				break;
+			}
+		case FGameDataMemberNameHash::Of(TEXT("Name")):
+			{
+				if (!PropertyName.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Name) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Name"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
+			}
+		case FGameDataMemberNameHash::Of(TEXT("PrimaryLanguage")):
+			{
+				if (!PropertyName.Equals(TEXT("PrimaryLanguage"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->PrimaryLanguage) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.PrimaryLanguage"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
+			}
+		case FGameDataMemberNameHash::Of(TEXT("Languages")):
+			{
+				if (!PropertyName.Equals(TEXT("Languages"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Languages) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Languages"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
+			}
+		case FGameDataMemberNameHash::Of(TEXT("Copyright")):
+			{
+				if (!PropertyName.Equals(TEXT("Copyright"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Copyright) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Copyright"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
+			}
+		case FGameDataMemberNameHash::Of(TEXT("Version")):
+			{
+				if (!PropertyName.Equals(TEXT("Version"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Version"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Version) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Version"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
+			}
+		case FGameDataMemberNameHash::Of(TEXT("Extensions")):
+			{
+				if (!PropertyName.Equals(TEXT("Extensions"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Extensions) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("ProjectSettings.Extensions"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
+			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -1175,9 +1573,10 @@ bool UTestData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool UTestData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
+	ReaderType& Reader,
 	UTestEntity*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
@@ -1185,357 +1584,477 @@ bool UTestData::ReadDocument
 )
 {
 	Document = NewObject<UTestEntity>(Outer, UTestEntity::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
+		UTestData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = UTestData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UTestEntity* ExistingDocument = Cast<UTestEntity>(ExistingObject);
+				if (ExistingDocument)
+				{
+					UTestData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->TextField = Document->TextField;
+					ExistingDocument->LocalizedTextFieldRaw = Document->LocalizedTextFieldRaw;
+					ExistingDocument->LogicalField = Document->LogicalField;
+					ExistingDocument->TimeField = Document->TimeField;
+					ExistingDocument->DateField = Document->DateField;
+					ExistingDocument->NumberField = Document->NumberField;
+					ExistingDocument->NumberFieldX64 = Document->NumberFieldX64;
+					ExistingDocument->IntegerField = Document->IntegerField;
+					ExistingDocument->IntegerFieldX64 = Document->IntegerFieldX64;
+					ExistingDocument->PickListField = Document->PickListField;
+					ExistingDocument->MultiPickListField = Document->MultiPickListField;
+					ExistingDocument->DocumentField = Document->DocumentField;
+					ExistingDocument->ListOfDocumentsField = Document->ListOfDocumentsField;
+					ExistingDocument->ReferenceFieldRaw = Document->ReferenceFieldRaw;
+					ExistingDocument->ListOfReferencesFieldRaw = Document->ListOfReferencesFieldRaw;
+					ExistingDocument->FormulaField = Document->FormulaField;
+					ExistingDocument->IsPublished = Document->IsPublished;
+					ExistingDocument->UnionField = Document->UnionField;
+					ExistingDocument->IntFormula = Document->IntFormula;
+
+					UTestData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					UTestData_TryDeleteDocument(ExistingObject);
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("TextField")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = UTestData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UTestEntity* ExistingDocument = Cast<UTestEntity>(ExistingObject);
-			if (ExistingDocument)
-			{
-				UTestData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->TextField = Document->TextField;
-				ExistingDocument->LocalizedTextFieldRaw = Document->LocalizedTextFieldRaw;
-				ExistingDocument->LogicalField = Document->LogicalField;
-				ExistingDocument->TimeField = Document->TimeField;
-				ExistingDocument->DateField = Document->DateField;
-				ExistingDocument->NumberField = Document->NumberField;
-				ExistingDocument->NumberFieldX64 = Document->NumberFieldX64;
-				ExistingDocument->IntegerField = Document->IntegerField;
-				ExistingDocument->IntegerFieldX64 = Document->IntegerFieldX64;
-				ExistingDocument->PickListField = Document->PickListField;
-				ExistingDocument->MultiPickListField = Document->MultiPickListField;
-				ExistingDocument->DocumentField = Document->DocumentField;
-				ExistingDocument->ListOfDocumentsField = Document->ListOfDocumentsField;
-				ExistingDocument->ReferenceFieldRaw = Document->ReferenceFieldRaw;
-				ExistingDocument->ListOfReferencesFieldRaw = Document->ListOfReferencesFieldRaw;
-				ExistingDocument->FormulaField = Document->FormulaField;
-				ExistingDocument->IsPublished = Document->IsPublished;
-				ExistingDocument->UnionField = Document->UnionField;
-				ExistingDocument->IntFormula = Document->IntFormula;
-
-				UTestData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				UTestData_TryDeleteDocument(ExistingObject);
-				UTestData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("TextField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->TextField) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.TextField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else
+		case FGameDataMemberNameHash::Of(TEXT("LocalizedTextField")):
 			{
-				UTestData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("LocalizedTextField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->LocalizedTextFieldRaw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.LocalizedTextField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("TextField"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("LogicalField")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("LogicalField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->LogicalField) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.LogicalField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->TextField) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("TimeField")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.TextField"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("TimeField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->TimeField) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.TimeField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("LocalizedTextField"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("DateField")):
 			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->LocalizedTextFieldRaw, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.LocalizedTextField"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("LogicalField"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->LogicalField) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.LogicalField"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("TimeField"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->TimeField) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.TimeField"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("DateField"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->DateField) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.DateField"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("NumberField"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->NumberField) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.NumberField"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("NumberFieldX64"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.NumberFieldX64"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->NumberFieldX64) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.NumberFieldX64"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("IntegerField"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->IntegerField) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.IntegerField"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("IntegerFieldX64"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.IntegerFieldX64"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->IntegerFieldX64) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.IntegerFieldX64"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("PickListField"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->PickListField) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.PickListField"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("MultiPickListField"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->MultiPickListField) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.MultiPickListField"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("DocumentField"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = ReadDocument(Reader, Document->DocumentField, Outer, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.DocumentField"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("DateField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->DateField) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.DateField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("ListOfDocumentsField"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("NumberField")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.ListOfDocumentsField"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("NumberField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->NumberField) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.NumberField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->ListOfDocumentsField, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("NumberFieldX64")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.ListOfDocumentsField"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("NumberFieldX64"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.NumberFieldX64"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->NumberFieldX64) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.NumberFieldX64"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("ReferenceField"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("IntegerField")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("IntegerField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->IntegerField) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.IntegerField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentReference(Reader, Document->ReferenceFieldRaw, TEXT("TestEntity"), GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("IntegerFieldX64")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.ReferenceField"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("IntegerFieldX64"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.IntegerFieldX64"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->IntegerFieldX64) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.IntegerFieldX64"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("ListOfReferencesField"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("PickListField")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.ListOfReferencesField"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("PickListField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->PickListField) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.PickListField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentReferenceCollection(Reader, Document->ListOfReferencesFieldRaw, TEXT("TestEntity"), GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("MultiPickListField")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.ListOfReferencesField"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("MultiPickListField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->MultiPickListField) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.MultiPickListField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("FormulaField"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("DocumentField")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("DocumentField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocument(Reader, Document->DocumentField, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.DocumentField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadFormula(Reader, Document->FormulaField, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("ListOfDocumentsField")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.FormulaField"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("ListOfDocumentsField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.ListOfDocumentsField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->ListOfDocumentsField, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.ListOfDocumentsField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("IsPublished"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("ReferenceField")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.IsPublished"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("ReferenceField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocumentReference(Reader, Document->ReferenceFieldRaw, TEXT("TestEntity"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.ReferenceField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->IsPublished) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("ListOfReferencesField")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.IsPublished"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("ListOfReferencesField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.ListOfReferencesField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentReferenceCollection(Reader, Document->ListOfReferencesFieldRaw, TEXT("TestEntity"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.ListOfReferencesField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("UnionField"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("FormulaField")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.UnionField"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("FormulaField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadFormula(Reader, Document->FormulaField, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.FormulaField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->UnionField, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("IsPublished")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.UnionField"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("IsPublished"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.IsPublished"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->IsPublished) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.IsPublished"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("IntFormula"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("UnionField")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("UnionField"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("TestEntity.UnionField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->UnionField, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.UnionField"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadFormula(Reader, Document->IntFormula, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("IntFormula")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.IntFormula"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("IntFormula"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadFormula(Reader, Document->IntFormula, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("TestEntity.IntFormula"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -1544,9 +2063,10 @@ bool UTestData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool UTestData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
+	ReaderType& Reader,
 	URecursiveEntity*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
@@ -1554,102 +2074,120 @@ bool UTestData::ReadDocument
 )
 {
 	Document = NewObject<URecursiveEntity>(Outer, URecursiveEntity::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
+		UTestData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("RecursiveEntity.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("RecursiveEntity.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = UTestData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			URecursiveEntity* ExistingDocument = Cast<URecursiveEntity>(ExistingObject);
-			if (ExistingDocument)
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UTestData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->Title = Document->Title;
-				ExistingDocument->Children = Document->Children;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("RecursiveEntity.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("RecursiveEntity.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = UTestData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				URecursiveEntity* ExistingDocument = Cast<URecursiveEntity>(ExistingObject);
+				if (ExistingDocument)
+				{
+					UTestData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->Title = Document->Title;
+					ExistingDocument->Children = Document->Children;
 
-				UTestData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
+					UTestData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
 
-				UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				UTestData_TryDeleteDocument(ExistingObject);
-				UTestData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				UTestData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("Title"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("RecursiveEntity.Title"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Title) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("RecursiveEntity.Title"), *CombineGameDataPath(GameDataPath));
-				return false;
+					UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					UTestData_TryDeleteDocument(ExistingObject);
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Children"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Title")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("RecursiveEntity.Children"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Title"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("RecursiveEntity.Title"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Title) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("RecursiveEntity.Title"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->Children, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Children")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("RecursiveEntity.Children"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Children"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("RecursiveEntity.Children"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->Children, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("RecursiveEntity.Children"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -1658,9 +2196,10 @@ bool UTestData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool UTestData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
+	ReaderType& Reader,
 	UNumberTestEntity*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
@@ -1668,282 +2207,694 @@ bool UTestData::ReadDocument
 )
 {
 	Document = NewObject<UNumberTestEntity>(Outer, UNumberTestEntity::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
+		UTestData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = UTestData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UNumberTestEntity* ExistingDocument = Cast<UNumberTestEntity>(ExistingObject);
+				if (ExistingDocument)
+				{
+					UTestData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->Number32Bit = Document->Number32Bit;
+					ExistingDocument->Number64Bit = Document->Number64Bit;
+					ExistingDocument->Integer8Bit = Document->Integer8Bit;
+					ExistingDocument->Integer16Bit = Document->Integer16Bit;
+					ExistingDocument->Integer32Bit = Document->Integer32Bit;
+					ExistingDocument->Integer64Bit = Document->Integer64Bit;
+					ExistingDocument->PickList8Bit = Document->PickList8Bit;
+					ExistingDocument->PickList16Bit = Document->PickList16Bit;
+					ExistingDocument->PickList32Bit = Document->PickList32Bit;
+					ExistingDocument->PickList64Bit = Document->PickList64Bit;
+					ExistingDocument->MultiPickList8Bit = Document->MultiPickList8Bit;
+					ExistingDocument->MultiPickList16Bit = Document->MultiPickList16Bit;
+					ExistingDocument->MultiPickList32Bit = Document->MultiPickList32Bit;
+					ExistingDocument->MultiPickList64Bit = Document->MultiPickList64Bit;
+
+					UTestData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					UTestData_TryDeleteDocument(ExistingObject);
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Number32Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = UTestData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UNumberTestEntity* ExistingDocument = Cast<UNumberTestEntity>(ExistingObject);
-			if (ExistingDocument)
-			{
-				UTestData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->Number32Bit = Document->Number32Bit;
-				ExistingDocument->Number64Bit = Document->Number64Bit;
-				ExistingDocument->Integer8Bit = Document->Integer8Bit;
-				ExistingDocument->Integer16Bit = Document->Integer16Bit;
-				ExistingDocument->Integer32Bit = Document->Integer32Bit;
-				ExistingDocument->Integer64Bit = Document->Integer64Bit;
-				ExistingDocument->PickList8Bit = Document->PickList8Bit;
-				ExistingDocument->PickList16Bit = Document->PickList16Bit;
-				ExistingDocument->PickList32Bit = Document->PickList32Bit;
-				ExistingDocument->PickList64Bit = Document->PickList64Bit;
-				ExistingDocument->MultiPickList8Bit = Document->MultiPickList8Bit;
-				ExistingDocument->MultiPickList16Bit = Document->MultiPickList16Bit;
-				ExistingDocument->MultiPickList32Bit = Document->MultiPickList32Bit;
-				ExistingDocument->MultiPickList64Bit = Document->MultiPickList64Bit;
-
-				UTestData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				UTestData_TryDeleteDocument(ExistingObject);
-				UTestData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Number32Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Number32Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Number32Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Number32Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else
+		case FGameDataMemberNameHash::Of(TEXT("Number64Bit")):
 			{
-				UTestData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Number64Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Number64Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Number64Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Number64Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Number32Bit"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Integer8Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Number32Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Integer8Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer8Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Integer8Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer8Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Number32Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Integer16Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Number32Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Integer16Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer16Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Integer16Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer16Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Number64Bit"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Integer32Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Number64Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Integer32Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer32Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Integer32Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer32Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Number64Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Integer64Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Number64Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Integer64Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer64Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Integer64Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer64Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Integer8Bit"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("PickList8Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer8Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("PickList8Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList8Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->PickList8Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList8Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Integer8Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("PickList16Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer8Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("PickList16Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList16Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->PickList16Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList16Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Integer16Bit"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("PickList32Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer16Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("PickList32Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList32Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->PickList32Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList32Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Integer16Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("PickList64Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer16Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("PickList64Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList64Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->PickList64Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList64Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Integer32Bit"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("MultiPickList8Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer32Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("MultiPickList8Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList8Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->MultiPickList8Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList8Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Integer32Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("MultiPickList16Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer32Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("MultiPickList16Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList16Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->MultiPickList16Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList16Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Integer64Bit"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("MultiPickList32Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer64Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("MultiPickList32Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList32Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->MultiPickList32Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList32Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Integer64Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("MultiPickList64Bit")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.Integer64Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("MultiPickList64Bit"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList64Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->MultiPickList64Bit) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList64Bit"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else if (PropertyName == TEXT("PickList8Bit"))
+	}
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		return false;
+	}
+
+
+	UTestData_SweepMarkedChildDocuments(Document);
+
+	return true;
+}
+template <typename ReaderType>
+bool UTestData::ReadDocument
+(
+	ReaderType& Reader,
+	UUniqueAttributeEntity*& Document,
+	UObject* Outer,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	Document = NewObject<UUniqueAttributeEntity>(Outer, UUniqueAttributeEntity::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
+	Outer = Document;
+
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
+	{
+		if (Reader.IsError())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList8Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->PickList8Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList8Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			return false;
 		}
-		else if (PropertyName == TEXT("PickList16Bit"))
+
+		const FStringView PropertyName = Reader.ReadMemberView();
+		bool bReadSuccess;
+		UTestData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList16Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = UTestData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UUniqueAttributeEntity* ExistingDocument = Cast<UUniqueAttributeEntity>(ExistingObject);
+				if (ExistingDocument)
+				{
+					UTestData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->SnakeCaseKey = Document->SnakeCaseKey;
+					ExistingDocument->CamelCaseKey = Document->CamelCaseKey;
+					ExistingDocument->DromedaryCaseKey = Document->DromedaryCaseKey;
+					ExistingDocument->TextKey = Document->TextKey;
+					ExistingDocument->NonRequiredKey = Document->NonRequiredKey;
+					ExistingDocument->NumberKey = Document->NumberKey;
+					ExistingDocument->IntegerKey = Document->IntegerKey;
+					ExistingDocument->PickListKey = Document->PickListKey;
+					ExistingDocument->MultiPickListKey = Document->MultiPickListKey;
+					ExistingDocument->TimeSpanKey = Document->TimeSpanKey;
+					ExistingDocument->DateTimeKey = Document->DateTimeKey;
+
+					UTestData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					UTestData_TryDeleteDocument(ExistingObject);
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->PickList16Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("snake_case_key")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList16Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("PickList32Bit"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList32Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->PickList32Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList32Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("snake_case_key"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->SnakeCaseKey) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.SnakeCaseKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("PickList64Bit"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("camelCaseKey")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList64Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("camelCaseKey"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->CamelCaseKey) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.CamelCaseKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->PickList64Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("DromedaryCaseKey")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.PickList64Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("DromedaryCaseKey"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->DromedaryCaseKey) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.DromedaryCaseKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("MultiPickList8Bit"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("TextKey")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList8Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("TextKey"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.TextKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->TextKey) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.TextKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->MultiPickList8Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("NonRequiredKey")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList8Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("NonRequiredKey"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->NonRequiredKey) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.NonRequiredKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("MultiPickList16Bit"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("NumberKey")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList16Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("NumberKey"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.NumberKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->NumberKey) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.NumberKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->MultiPickList16Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("IntegerKey")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList16Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("IntegerKey"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.IntegerKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->IntegerKey) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.IntegerKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("MultiPickList32Bit"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("PickListKey")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList32Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("PickListKey"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.PickListKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->PickListKey) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.PickListKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->MultiPickList32Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("MultiPickListKey")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList32Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("MultiPickListKey"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.MultiPickListKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->MultiPickListKey) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.MultiPickListKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("MultiPickList64Bit"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("TimeSpanKey")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList64Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("TimeSpanKey"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.TimeSpanKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->TimeSpanKey) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.TimeSpanKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->MultiPickList64Bit) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("DateTimeKey")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("NumberTestEntity.MultiPickList64Bit"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("DateTimeKey"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.DateTimeKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->DateTimeKey) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.DateTimeKey"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -1952,997 +2903,1311 @@ bool UTestData::ReadDocument
 
 	return true;
 }
+template <typename ReaderType>
 bool UTestData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UUniqueAttributeEntity*& Document,
+	ReaderType& Reader,
+	UUnionType*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UUniqueAttributeEntity>(Outer, UUniqueAttributeEntity::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<UUnionType>(Outer, UUnionType::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
+		UTestData_SetGameDataPathTail(GameDataPath, PropertyName);
+		if (PropertyName != TEXT("Id") && !Reader.IsNull())
 		{
-			Reader->SkipAny();
+			if (!Document->Tag.IsEmpty())
+			{
+				UE_LOG(LogUTestData, Error, TEXT("Tagged Union has multiple conflicting options. Conflicting Options: %s, %s."), *FString(Document->Tag), *FString(PropertyName));
+			}
+			Document->Tag = FString(PropertyName);
 		}
-		else if (PropertyName == TEXT("Id"))
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UnionType.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = UTestData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UUnionType* ExistingDocument = Cast<UUnionType>(ExistingObject);
+				if (ExistingDocument)
+				{
+					UTestData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->Text1 = Document->Text1;
+					ExistingDocument->TextLocalizable2Raw = Document->TextLocalizable2Raw;
+					ExistingDocument->Logical3 = Document->Logical3;
+					ExistingDocument->Time4 = Document->Time4;
+					ExistingDocument->Date5 = Document->Date5;
+					ExistingDocument->Number6 = Document->Number6;
+					ExistingDocument->NumberInteger7 = Document->NumberInteger7;
+					ExistingDocument->PickList8 = Document->PickList8;
+					ExistingDocument->MultiPickList9 = Document->MultiPickList9;
+					ExistingDocument->Document10 = Document->Document10;
+					ExistingDocument->CollectionofDocuments11 = Document->CollectionofDocuments11;
+					ExistingDocument->Reference12Raw = Document->Reference12Raw;
+					ExistingDocument->CollectionofReferences13Raw = Document->CollectionofReferences13Raw;
+					ExistingDocument->Formula14 = Document->Formula14;
+
+					UTestData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					UTestData_TryDeleteDocument(ExistingObject);
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Text1")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Text1"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Text1) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Text1"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			FString NewName = UTestData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UUniqueAttributeEntity* ExistingDocument = Cast<UUniqueAttributeEntity>(ExistingObject);
-			if (ExistingDocument)
+		case FGameDataMemberNameHash::Of(TEXT("TextLocalizable2")):
 			{
-				UTestData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->SnakeCaseKey = Document->SnakeCaseKey;
-				ExistingDocument->CamelCaseKey = Document->CamelCaseKey;
-				ExistingDocument->DromedaryCaseKey = Document->DromedaryCaseKey;
-				ExistingDocument->TextKey = Document->TextKey;
-				ExistingDocument->NonRequiredKey = Document->NonRequiredKey;
-				ExistingDocument->NumberKey = Document->NumberKey;
-				ExistingDocument->IntegerKey = Document->IntegerKey;
-				ExistingDocument->PickListKey = Document->PickListKey;
-				ExistingDocument->MultiPickListKey = Document->MultiPickListKey;
-				ExistingDocument->TimeSpanKey = Document->TimeSpanKey;
-				ExistingDocument->DateTimeKey = Document->DateTimeKey;
-
-				UTestData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
+				if (!PropertyName.Equals(TEXT("TextLocalizable2"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadLocalizedText(Reader, Document->TextLocalizable2Raw, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.TextLocalizable2"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else if (ExistingObject)
+		case FGameDataMemberNameHash::Of(TEXT("Logical3")):
 			{
-				UTestData_TryDeleteDocument(ExistingObject);
-				UTestData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Logical3"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Logical3) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Logical3"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			else
+		case FGameDataMemberNameHash::Of(TEXT("Time4")):
 			{
-				UTestData_TryRenameDocument(Document, *NewName);
+				if (!PropertyName.Equals(TEXT("Time4"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Time4) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Time4"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("snake_case_key"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Date5")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("Date5"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Date5) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Date5"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->SnakeCaseKey) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Number6")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.SnakeCaseKey"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Number6"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Number6) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Number6"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("camelCaseKey"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("NumberInteger7")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("NumberInteger7"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->NumberInteger7) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.NumberInteger7"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->CamelCaseKey) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("PickList8")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.CamelCaseKey"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("PickList8"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->PickList8) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.PickList8"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("DromedaryCaseKey"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("MultiPickList9")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("MultiPickList9"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = Reader.ReadValue(Document->MultiPickList9) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.MultiPickList9"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->DromedaryCaseKey) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Document10")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.DromedaryCaseKey"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Document10"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocument(Reader, Document->Document10, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Document10"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("TextKey"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("CollectionofDocuments11")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.TextKey"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("CollectionofDocuments11"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocumentCollection(Reader, Document->CollectionofDocuments11, 0, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.CollectionofDocuments11"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->TextKey) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Reference12")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.TextKey"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Reference12"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocumentReference(Reader, Document->Reference12Raw, TEXT("NumberTestEntity"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Reference12"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("NonRequiredKey"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("CollectionofReferences13")):
 			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->NonRequiredKey) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.NonRequiredKey"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("NumberKey"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.NumberKey"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->NumberKey) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.NumberKey"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("IntegerKey"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.IntegerKey"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->IntegerKey) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.IntegerKey"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("PickListKey"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.PickListKey"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->PickListKey) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.PickListKey"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("MultiPickListKey"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.MultiPickListKey"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->MultiPickListKey) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.MultiPickListKey"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("TimeSpanKey"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.TimeSpanKey"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->TimeSpanKey) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.TimeSpanKey"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("DateTimeKey"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.DateTimeKey"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("CollectionofReferences13"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				bReadSuccess = ReadDocumentReferenceCollection(Reader, Document->CollectionofReferences13Raw, TEXT("NumberTestEntity"), GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.CollectionofReferences13"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->DateTimeKey) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Formula14")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UniqueAttributeEntity.DateTimeKey"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Formula14"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+				TSharedPtr<FJsonObject> FormulaObject;
+				bReadSuccess = Reader.ReadObject(FormulaObject);
+				Document->Formula14.JsonObject = FormulaObject;
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Formula14"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else
-		{
-			Reader->SkipAny();
-		}
-		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
+	if (Document->Tag.IsEmpty())
+	{
+		UE_LOG(LogUTestData, Error, TEXT("Tagged Union has no selected option."));
+	}
 
 	UTestData_SweepMarkedChildDocuments(Document);
 
 	return true;
 }
+template <typename ReaderType>
 bool UTestData::ReadDocument
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UUnionType*& Document,
+	ReaderType& Reader,
+	UAllTypesTest*& Document,
 	UObject* Outer,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UUnionType>(Outer, UUnionType::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	Document = NewObject<UAllTypesTest>(Outer, UAllTypesTest::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
+	ReadDocumentCount++;
 	Outer = Document;
 
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	GameDataPath.Emplace();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto PropertyName = Reader->ReadMember();
+		const FStringView PropertyName = Reader.ReadMemberView();
 		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName != TEXT("Id") && !Reader->IsNull())
-		{
-			if (!Document->Tag.IsEmpty())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Tagged Union has multiple conflicting options. Conflicting Options: %s, %s."), *FString(Document->Tag), *PropertyName);
-			}
-			Document->Tag = PropertyName;
-		}
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("UnionType.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = UTestData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UUnionType* ExistingDocument = Cast<UUnionType>(ExistingObject);
-			if (ExistingDocument)
-			{
-				UTestData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->Text1 = Document->Text1;
-				ExistingDocument->TextLocalizable2Raw = Document->TextLocalizable2Raw;
-				ExistingDocument->Logical3 = Document->Logical3;
-				ExistingDocument->Time4 = Document->Time4;
-				ExistingDocument->Date5 = Document->Date5;
-				ExistingDocument->Number6 = Document->Number6;
-				ExistingDocument->NumberInteger7 = Document->NumberInteger7;
-				ExistingDocument->PickList8 = Document->PickList8;
-				ExistingDocument->MultiPickList9 = Document->MultiPickList9;
-				ExistingDocument->Document10 = Document->Document10;
-				ExistingDocument->CollectionofDocuments11 = Document->CollectionofDocuments11;
-				ExistingDocument->Reference12Raw = Document->Reference12Raw;
-				ExistingDocument->CollectionofReferences13Raw = Document->CollectionofReferences13Raw;
-				ExistingDocument->Formula14 = Document->Formula14;
-
-				UTestData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				UTestData_TryDeleteDocument(ExistingObject);
-				UTestData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				UTestData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("Text1"))
-		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Text1) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Text1"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("TextLocalizable2"))
+		UTestData_SetGameDataPathTail(GameDataPath, PropertyName);
+		switch (Reader.GetIdentifierHash())
 		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Id")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("Id"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Id) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Id"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				FString NewName = UTestData_MakeUniqueDocumentName(Document);
+				UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
+				UAllTypesTest* ExistingDocument = Cast<UAllTypesTest>(ExistingObject);
+				if (ExistingDocument)
+				{
+					UTestData_ResetDocumentToDefaultState(ExistingDocument);
+					ExistingDocument->Id = Document->Id;
+					ExistingDocument->AssetPath = Document->AssetPath;
+					ExistingDocument->AssetPathCollection = Document->AssetPathCollection;
+					ExistingDocument->Rectangle = Document->Rectangle;
+					ExistingDocument->Vector2 = Document->Vector2;
+					ExistingDocument->Vector3 = Document->Vector3;
+					ExistingDocument->Vector4 = Document->Vector4;
+					ExistingDocument->IntegerRectangle = Document->IntegerRectangle;
+					ExistingDocument->IntegerVector2 = Document->IntegerVector2;
+					ExistingDocument->IntegerVector3 = Document->IntegerVector3;
+					ExistingDocument->IntegerVector4 = Document->IntegerVector4;
+					ExistingDocument->Tag = Document->Tag;
+					ExistingDocument->TagCollection = Document->TagCollection;
+					ExistingDocument->VoidFormula = Document->VoidFormula;
+					ExistingDocument->NoParamsFormula = Document->NoParamsFormula;
+					ExistingDocument->ParamsFormula = Document->ParamsFormula;
+
+					UTestData_TryDeleteDocument(Document);
+					Document->MarkAsGarbage();
+					Document = ExistingDocument;
+
+					UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
+				}
+				else if (ExistingObject)
+				{
+					UTestData_TryDeleteDocument(ExistingObject);
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				else
+				{
+					UTestData_TryRenameDocument(Document, *NewName);
+				}
+				break;
 			}
-			bReadSuccess = ReadLocalizedText(Reader, Document->TextLocalizable2Raw, GameDataPath);
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("AssetPath")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.TextLocalizable2"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("AssetPath"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.AssetPath"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->AssetPath) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.AssetPath"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Logical3"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("AssetPathCollection")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("AssetPathCollection"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.AssetPathCollection"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->AssetPathCollection) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.AssetPathCollection"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Logical3) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Rectangle")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Logical3"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Rectangle"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Rectangle"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Rectangle) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Rectangle"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Time4"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Vector2")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("Vector2"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Vector2"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Vector2) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Vector2"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Time4) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Vector3")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Time4"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Vector3"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Vector3"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Vector3) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Vector3"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Date5"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("Vector4")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("Vector4"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Vector4"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Vector4) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Vector4"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Date5) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("IntegerRectangle")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Date5"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("IntegerRectangle"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerRectangle"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->IntegerRectangle) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerRectangle"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("Number6"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("IntegerVector2")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("IntegerVector2"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerVector2"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->IntegerVector2) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerVector2"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Number6) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("IntegerVector3")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Number6"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("IntegerVector3"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerVector3"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->IntegerVector3) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerVector3"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("NumberInteger7"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("IntegerVector4")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("IntegerVector4"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerVector4"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->IntegerVector4) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerVector4"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->NumberInteger7) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("Tag")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.NumberInteger7"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("Tag"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Tag"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->Tag) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Tag"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("PickList8"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("TagCollection")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("TagCollection"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.TagCollection"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = Reader.ReadValue(Document->TagCollection) && Reader.ReadNext();
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.TagCollection"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->PickList8) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("VoidFormula")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.PickList8"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("VoidFormula"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.VoidFormula"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadFormula(Reader, Document->VoidFormula, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.VoidFormula"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-		}
-		else if (PropertyName == TEXT("MultiPickList9"))
-		{
-			if (Reader->IsNull())
+		case FGameDataMemberNameHash::Of(TEXT("NoParamsFormula")):
 			{
-				Reader->ReadNext();
-				continue;
+				if (!PropertyName.Equals(TEXT("NoParamsFormula"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.NoParamsFormula"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadFormula(Reader, Document->NoParamsFormula, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.NoParamsFormula"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
-			bReadSuccess = Reader->ReadValue(Document->MultiPickList9) && Reader->ReadNext();
-			if (!bReadSuccess)
+		case FGameDataMemberNameHash::Of(TEXT("ParamsFormula")):
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.MultiPickList9"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (!PropertyName.Equals(TEXT("ParamsFormula"), ESearchCase::IgnoreCase))
+				{
+					Reader.SkipAny(); // hash collision with unknown property
+					break;
+				}
+				if (Reader.IsNull())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.ParamsFormula"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				bReadSuccess = ReadFormula(Reader, Document->ParamsFormula, Outer, GameDataPath);
+				if (!bReadSuccess)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.ParamsFormula"), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				break;
 			}
+		default:
+			Reader.SkipAny();
+			break;
 		}
-		else if (PropertyName == TEXT("Document10"))
+	}
+	GameDataPath.Pop();
+	Reader.ReadObjectEnd(NextToken);
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		return false;
+	}
+
+
+	UTestData_SweepMarkedChildDocuments(Document);
+
+	return true;
+}
+template <typename ReaderType, typename IdType, typename DocumentType>
+bool UTestData::ReadDocumentCollection
+(
+	ReaderType& Reader,
+	TMap<IdType,DocumentType*>& Collection,
+	int32 Capacity,
+	UObject* Outer,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	Collection.Empty();
+	auto Documents = TArray<DocumentType*>();
+	if (!ReadDocumentList(Reader, Documents, Capacity, Outer, GameDataPath, NextToken))
+	{
+		return false;
+	}
+
+	ToMapById(Collection, Documents);
+
+	return true;
+}
+template <typename ReaderType, typename IdType, typename DocumentType>
+bool UTestData::ReadDocumentCollection
+(
+	ReaderType& Reader,
+	TGameDataDocumentStore<IdType,DocumentType>& Store,
+	int32 Capacity,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	// root documents are added to schema's store, embedded documents are added to it by FindAllDocuments()
+	auto Documents = TArray<DocumentType*>();
+	if (!ReadDocumentList(Reader, Documents, Capacity, this, GameDataPath, NextToken))
+	{
+		return false;
+	}
+
+	Store.Append(Documents, /* bIsRoot */ true);
+
+	return true;
+}
+template <typename ReaderType, typename DocumentType>
+bool UTestData::ReadDocumentList
+(
+	ReaderType& Reader,
+	TArray<DocumentType*>& Documents,
+	int32 Capacity,
+	UObject* Outer,
+	TArray<FString>& GameDataPath,
+	bool NextToken
+)
+{
+	// root documents of patched schemas are merged with their patches while read
+	if (PatchIndex.IsValid() && Outer == this && PatchIndex->HasPatches(DocumentType::StaticClass()))
+	{
+		return ReadPatchedDocumentCollection(Reader, Documents, Capacity, GameDataPath, NextToken);
+	}
+	if (Reader.IsNull())
+	{
+		return true;
+	}
+
+	const bool IsByIdCollection = Reader.GetNotation() == EJsonNotation::ObjectStart;
+
+	if (Capacity > 0)
+	{
+		Documents.Reserve(Capacity);
+	}
+
+	if (IsByIdCollection)
+	{
+		Reader.ReadObjectBegin();
+	}
+	else
+	{
+		Reader.ReadArrayBegin();
+	}
+
+	int32 Count = -1;
+	while (Reader.GetNotation() != EJsonNotation::ArrayEnd &&
+			Reader.GetNotation() != EJsonNotation::ObjectEnd)
+	{
+		Count++;
+
+		if (Reader.IsError())
 		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = ReadDocument(Reader, Document->Document10, Outer, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Document10"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			return false;
 		}
-		else if (PropertyName == TEXT("CollectionofDocuments11"))
+		if (Reader.IsNull())
 		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = ReadDocumentCollection(Reader, Document->CollectionofDocuments11, 0, Outer, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.CollectionofDocuments11"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			Reader.ReadNext();
+			continue;
 		}
-		else if (PropertyName == TEXT("Reference12"))
+
+		const FStringView DocumentId = Reader.GetIdentifierView();
+		if (!DocumentId.IsEmpty())
 		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = ReadDocumentReference(Reader, Document->Reference12Raw, TEXT("NumberTestEntity"), GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Reference12"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			GameDataPath.Emplace(DocumentId);
 		}
-		else if (PropertyName == TEXT("CollectionofReferences13"))
+		else
 		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			bReadSuccess = ReadDocumentReferenceCollection(Reader, Document->CollectionofReferences13Raw, TEXT("NumberTestEntity"), GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.CollectionofReferences13"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			GameDataPath.Add(FString::FromInt(Count));
 		}
-		else if (PropertyName == TEXT("Formula14"))
+
+		DocumentType* Document = nullptr;
+		if (ReadDocument(Reader, Document, Outer, GameDataPath) && Document != nullptr)
 		{
-			if (Reader->IsNull())
-			{
-				Reader->ReadNext();
-				continue;
-			}
-			TSharedPtr<FJsonObject> FormulaObject;
-			bReadSuccess = Reader->ReadObject(FormulaObject);
-			Document->Formula14.JsonObject = FormulaObject;
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("UnionType.Formula14"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			Documents.Add(Document);
 		}
 		else
 		{
-			Reader->SkipAny();
+			UE_LOG(LogUTestData, Error, TEXT("Failed to read document. Path: %s."), *CombineGameDataPath(GameDataPath));
+			return false;
 		}
+
 		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
-
-	if (Reader->IsError())
+	if (IsByIdCollection)
 	{
-		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-		return false;
+		Reader.ReadObjectEnd(NextToken);
 	}
-
-	if (Document->Tag.IsEmpty())
+	else
 	{
-		UE_LOG(LogUTestData, Error, TEXT("Tagged Union has no selected option."));
+		Reader.ReadArrayEnd(NextToken);
 	}
 
-	UTestData_SweepMarkedChildDocuments(Document);
+	if (Reader.IsError())
+	{
+		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		return false;
+	}
 
 	return true;
 }
-bool UTestData::ReadDocument
+template <typename ReaderType, typename DocumentType>
+bool UTestData::ReadPatchedDocumentCollection
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	UAllTypesTest*& Document,
-	UObject* Outer,
+	ReaderType& Reader,
+	TArray<DocumentType*>& Documents,
+	int32 Capacity,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Document = NewObject<UAllTypesTest>(Outer, UAllTypesTest::StaticClass(), NAME_None, EObjectFlags::RF_NoFlags);
-	Outer = Document;
-
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	if (Capacity > 0)
 	{
-		if (Reader->IsError())
-		{
-			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-			return false;
-		}
+		Documents.Reserve(Capacity);
+	}
 
-		auto PropertyName = Reader->ReadMember();
-		bool bReadSuccess;
-		GameDataPath.Add(PropertyName);
-		if (PropertyName.IsEmpty())
-		{
-			Reader->SkipAny();
-		}
-		else if (PropertyName == TEXT("Id"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Id) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Id"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			FString NewName = UTestData_MakeUniqueDocumentName(Document);
-			UObject* ExistingObject = UTestData_FindDocumentByUniqueName(NewName, this->NameLookupDuringLoading);
-			UAllTypesTest* ExistingDocument = Cast<UAllTypesTest>(ExistingObject);
-			if (ExistingDocument)
-			{
-				UTestData_ResetDocumentToDefaultState(ExistingDocument);
-				ExistingDocument->Id = Document->Id;
-				ExistingDocument->AssetPath = Document->AssetPath;
-				ExistingDocument->AssetPathCollection = Document->AssetPathCollection;
-				ExistingDocument->Rectangle = Document->Rectangle;
-				ExistingDocument->Vector2 = Document->Vector2;
-				ExistingDocument->Vector3 = Document->Vector3;
-				ExistingDocument->Vector4 = Document->Vector4;
-				ExistingDocument->IntegerRectangle = Document->IntegerRectangle;
-				ExistingDocument->IntegerVector2 = Document->IntegerVector2;
-				ExistingDocument->IntegerVector3 = Document->IntegerVector3;
-				ExistingDocument->IntegerVector4 = Document->IntegerVector4;
-				ExistingDocument->Tag = Document->Tag;
-				ExistingDocument->TagCollection = Document->TagCollection;
-				ExistingDocument->VoidFormula = Document->VoidFormula;
-				ExistingDocument->NoParamsFormula = Document->NoParamsFormula;
-				ExistingDocument->ParamsFormula = Document->ParamsFormula;
-
-				UTestData_TryDeleteDocument(Document);
-				Document->MarkAsGarbage();
-				Document = ExistingDocument;
-
-				UTestData_MarkChildDocumentsForDeletion(ExistingDocument);
-			}
-			else if (ExistingObject)
-			{
-				UTestData_TryDeleteDocument(ExistingObject);
-				UTestData_TryRenameDocument(Document, *NewName);
-			}
-			else
-			{
-				UTestData_TryRenameDocument(Document, *NewName);
-			}
-		}
-		else if (PropertyName == TEXT("AssetPath"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.AssetPath"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->AssetPath) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.AssetPath"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("AssetPathCollection"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.AssetPathCollection"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->AssetPathCollection) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.AssetPathCollection"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Rectangle"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Rectangle"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Rectangle) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Rectangle"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Vector2"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Vector2"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Vector2) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Vector2"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Vector3"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Vector3"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Vector3) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Vector3"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("Vector4"))
-		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Vector4"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->Vector4) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Vector4"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-		}
-		else if (PropertyName == TEXT("IntegerRectangle"))
+	if (!Reader.IsNull())
+	{
+		const bool IsByIdCollection = Reader.GetNotation() == EJsonNotation::ObjectStart;
+		if (IsByIdCollection)
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerRectangle"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->IntegerRectangle) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerRectangle"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			Reader.ReadObjectBegin();
 		}
-		else if (PropertyName == TEXT("IntegerVector2"))
+		else
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerVector2"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->IntegerVector2) && Reader->ReadNext();
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerVector2"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			Reader.ReadArrayBegin();
 		}
-		else if (PropertyName == TEXT("IntegerVector3"))
+
+		TArray<TSharedPtr<FJsonValue>> DocumentPatches;
+		int32 Count = -1;
+		while (Reader.GetNotation() != EJsonNotation::ArrayEnd &&
+				Reader.GetNotation() != EJsonNotation::ObjectEnd)
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerVector3"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = Reader->ReadValue(Document->IntegerVector3) && Reader->ReadNext();
-			if (!bReadSuccess)
+			Count++;
+
+			if (Reader.IsError())
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerVector3"), *CombineGameDataPath(GameDataPath));
+				UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 				return false;
 			}
-		}
-		else if (PropertyName == TEXT("IntegerVector4"))
-		{
-			if (Reader->IsNull())
+
+			// in by-id collection id is known before document is read, so only patched documents are read as FJsonValue
+			FString DocumentId = FString(Reader.GetIdentifierView());
+			if (IsByIdCollection && !PatchIndex->Take(DocumentType::StaticClass(), DocumentId, DocumentPatches))
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerVector4"), *CombineGameDataPath(GameDataPath));
-				return false;
+				if (Reader.IsNull())
+				{
+					Reader.ReadNext();
+					continue;
+				}
+
+				GameDataPath.Add(DocumentId);
+				DocumentType* StreamedDocument = nullptr;
+				if (!ReadDocument(Reader, StreamedDocument, this, GameDataPath) || StreamedDocument == nullptr)
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read document. Path: %s."), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+				Documents.Add(StreamedDocument);
+				GameDataPath.Pop();
+				continue;
 			}
-			bReadSuccess = Reader->ReadValue(Document->IntegerVector4) && Reader->ReadNext();
-			if (!bReadSuccess)
+
+			// in list collection id is inside of document, so document is captured as raw bytes and only its id is read
+			// to look up patches, then document is read from raw bytes as FJsonValue only if it is patched
+			TArrayView<const uint8> RawDocument;
+			if (!IsByIdCollection && !Reader.IsNull() && Reader.ReadRawValue(RawDocument))
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.IntegerVector4"), *CombineGameDataPath(GameDataPath));
-				return false;
+				const TSharedPtr<IGameDataReader> IdReader = Reader.CreateRawValueReader(RawDocument);
+				const TSharedPtr<IGameDataReader> DocumentReader = Reader.CreateRawValueReader(RawDocument);
+				DocumentId.Reset();
+				if (IdReader.IsValid() && IdReader->ReadNext())
+				{
+					FGameDataPatchIndex::ReadDocumentId(*IdReader, DocumentId);
+				}
+				GameDataPath.Add(DocumentId.IsEmpty() ? FString::FromInt(Count) : DocumentId);
+				if (!DocumentReader.IsValid() || !DocumentReader->ReadNext())
+				{
+					UE_LOG(LogUTestData, Error, TEXT("Failed to read document. Path: %s."), *CombineGameDataPath(GameDataPath));
+					return false;
+				}
+
+				if (!DocumentId.IsEmpty() && PatchIndex->Take(DocumentType::StaticClass(), DocumentId, DocumentPatches))
+				{
+					TSharedPtr<FJsonValue> PatchedDocument;
+					if (!DocumentReader->ReadAny(PatchedDocument) || !PatchedDocument.IsValid())
+					{
+						UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *DocumentReader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+						return false;
+					}
+					if (!ReadPatchedDocument(ApplyDocumentPatches<DocumentType>(PatchedDocument, DocumentPatches), Documents, GameDataPath))
+					{
+						return false;
+					}
+				}
+				else
+				{
+					DocumentType* StreamedDocument = nullptr;
+					const bool bReadSuccess = FGameDataReaderDispatch::Visit(*DocumentReader, [&](auto& TypedReader)
+					{
+						return ReadDocument(TypedReader, StreamedDocument, this, GameDataPath);
+					});
+					if (!bReadSuccess || StreamedDocument == nullptr)
+					{
+						UE_LOG(LogUTestData, Error, TEXT("Failed to read document. Path: %s."), *CombineGameDataPath(GameDataPath));
+						return false;
+					}
+					Documents.Add(StreamedDocument);
+				}
+				GameDataPath.Pop();
+				continue;
 			}
-		}
-		else if (PropertyName == TEXT("Tag"))
-		{
-			if (Reader->IsNull())
+
+			// patched document of by-id collection or document of reader which doesn't keep raw bytes is read as FJsonValue
+			TSharedPtr<FJsonValue> Document;
+			if (!Reader.ReadAny(Document) || !Document.IsValid())
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Tag"), *CombineGameDataPath(GameDataPath));
+				UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 				return false;
 			}
-			bReadSuccess = Reader->ReadValue(Document->Tag) && Reader->ReadNext();
-			if (!bReadSuccess)
+
+			const TSharedPtr<FJsonObject>* DocumentObjectPtr;
+			if (!IsByIdCollection && Document->TryGetObject(DocumentObjectPtr) && DocumentObjectPtr->IsValid())
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.Tag"), *CombineGameDataPath(GameDataPath));
-				return false;
+				FGameDataPatchIndex::GetDocumentId(*DocumentObjectPtr->Get(), DocumentId);
 			}
-		}
-		else if (PropertyName == TEXT("TagCollection"))
-		{
-			if (Reader->IsNull())
+			if (IsByIdCollection || (!DocumentId.IsEmpty() && PatchIndex->Take(DocumentType::StaticClass(), DocumentId, DocumentPatches)))
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.TagCollection"), *CombineGameDataPath(GameDataPath));
-				return false;
+				Document = ApplyDocumentPatches<DocumentType>(Document, DocumentPatches);
 			}
-			bReadSuccess = Reader->ReadValue(Document->TagCollection) && Reader->ReadNext();
-			if (!bReadSuccess)
+
+			GameDataPath.Add(DocumentId.IsEmpty() ? FString::FromInt(Count) : DocumentId);
+			if (!ReadPatchedDocument(Document, Documents, GameDataPath))
 			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.TagCollection"), *CombineGameDataPath(GameDataPath));
 				return false;
 			}
+			GameDataPath.Pop();
 		}
-		else if (PropertyName == TEXT("VoidFormula"))
+		if (IsByIdCollection)
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.VoidFormula"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadFormula(Reader, Document->VoidFormula, Outer, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.VoidFormula"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			Reader.ReadObjectEnd(NextToken);
 		}
-		else if (PropertyName == TEXT("NoParamsFormula"))
+		else
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.NoParamsFormula"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadFormula(Reader, Document->NoParamsFormula, Outer, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.NoParamsFormula"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			Reader.ReadArrayEnd(NextToken);
 		}
-		else if (PropertyName == TEXT("ParamsFormula"))
+
+		if (Reader.IsError())
 		{
-			if (Reader->IsNull())
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Unexpected null value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.ParamsFormula"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
-			bReadSuccess = ReadFormula(Reader, Document->ParamsFormula, Outer, GameDataPath);
-			if (!bReadSuccess)
-			{
-				UE_LOG(LogUTestData, Error, TEXT("Failed to read value for property '%s' of document. Path: %s."), TEXT("AllTypesTest.ParamsFormula"), *CombineGameDataPath(GameDataPath));
-				return false;
-			}
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			return false;
 		}
-		else
+	}
+
+	// documents which are only in patches are added after documents of game data
+	TArray<TPair<FString, TArray<TSharedPtr<FJsonValue>>>> PatchesByDocumentId;
+	PatchIndex->TakeAll(DocumentType::StaticClass(), PatchesByDocumentId);
+	for (const auto& DocumentPatchesById : PatchesByDocumentId)
+	{
+		GameDataPath.Add(DocumentPatchesById.Key);
+		if (!ReadPatchedDocument(ApplyDocumentPatches<DocumentType>(nullptr, DocumentPatchesById.Value), Documents, GameDataPath))
 		{
-			Reader->SkipAny();
+			return false;
 		}
 		GameDataPath.Pop();
 	}
-	Reader->ReadObjectEnd(NextToken);
 
-	if (Reader->IsError())
+	return true;
+}
+template <typename DocumentType>
+bool UTestData::ReadPatchedDocument(const TSharedPtr<FJsonValue>& PatchedDocument, TArray<DocumentType*>& Documents, TArray<FString>& GameDataPath)
+{
+	const TSharedPtr<FJsonObject>* DocumentObjectPtr;
+	if (!PatchedDocument.IsValid() || !PatchedDocument->TryGetObject(DocumentObjectPtr) || !DocumentObjectPtr->IsValid())
 	{
-		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-		return false;
+		return true; // deleted by game data or patch
 	}
 
+	const TSharedRef<IGameDataReader> DocumentReader = FGameDataReaderFactory::CreateJsonObjectReader(*DocumentObjectPtr);
+	DocumentReader->ReadNext(); // initialize reader and move to first token
 
-	UTestData_SweepMarkedChildDocuments(Document);
+	DocumentType* Document = nullptr;
+	const bool bReadSuccess = FGameDataReaderDispatch::Visit(*DocumentReader, [&](auto& TypedReader)
+	{
+		return ReadDocument(TypedReader, Document, this, GameDataPath);
+	});
+	if (!bReadSuccess || Document == nullptr)
+	{
+		UE_LOG(LogUTestData, Error, TEXT("Failed to read document. Path: %s."), *CombineGameDataPath(GameDataPath));
+		return false;
+	}
 
+	Documents.Add(Document);
 	return true;
 }
-template <typename IdType, typename DocumentType>
-bool UTestData::ReadDocumentCollection
+template <typename ReaderType, typename IdType, typename DocumentType>
+bool UTestData::ReadLazyDocumentCollection
 (
-	const TSharedRef<IGameDataReader>& Reader,
-	TMap<IdType,DocumentType*>& Collection,
-	int32 Capacity,
-	UObject* Outer,
+	ReaderType& Reader,
+	const FString& SchemaName,
+	TGameDataDocumentStore<IdType,DocumentType>& Store,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
-	Collection.Empty();
-	if (Reader->IsNull())
+	if (Reader.IsNull())
 	{
 		return true;
 	}
 
-	const bool IsByIdCollection = Reader->GetNotation() == EJsonNotation::ObjectStart;
-	auto Documents = TArray<DocumentType*>();
-
-	if (Capacity > 0)
-	{
-		Documents.Reserve(Capacity);
-	}
+	const bool IsByIdCollection = Reader.GetNotation() == EJsonNotation::ObjectStart;
 
 	if (IsByIdCollection)
 	{
-		Reader->ReadObjectBegin();
+		Reader.ReadObjectBegin();
 	}
 	else
 	{
-		Reader->ReadArrayBegin();
+		Reader.ReadArrayBegin();
 	}
 
 	int32 Count = -1;
-	while (Reader->GetNotation() != EJsonNotation::ArrayEnd &&
-			Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	while (Reader.GetNotation() != EJsonNotation::ArrayEnd &&
+			Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
 		Count++;
 
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
-		if (Reader->IsNull())
+		if (Reader.IsNull())
 		{
-			Reader->ReadNext();
+			Reader.ReadNext();
 			continue;
 		}
 
-		auto DocumentId = Reader->GetIdentifier();
-		if (!DocumentId.IsEmpty())
-		{
-			GameDataPath.Add(DocumentId);
-		}
-		else
+		// document is kept as raw bytes until first access, see FindLazyDocument
+		IdType DocumentId = IdType();
+		if (!LazyDocuments->ReadDocument(Reader, SchemaName, DocumentId))
 		{
-			GameDataPath.Add(FString::FromInt(Count));
+			UE_LOG(LogUTestData, Error, TEXT("Failed to read document's id. Path: %s/%d."), *CombineGameDataPath(GameDataPath), Count);
+			return false;
 		}
+		ReadDocumentCount++;
+	}
+	if (IsByIdCollection)
+	{
+		Reader.ReadObjectEnd(NextToken);
+	}
+	else
+	{
+		Reader.ReadArrayEnd(NextToken);
+	}
 
-		DocumentType* Document = nullptr;
-		if (ReadDocument(Reader, Document, Outer, GameDataPath) && Document != nullptr)
+	if (Reader.IsError())
+	{
+		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		return false;
+	}
+
+	return true;
+}
+template <typename IdType, typename DocumentType>
+DocumentType* UTestData::FindLazyDocument(const FString& SchemaName, const IdType& Id, TGameDataDocumentStore<IdType, DocumentType>& Store)
+{
+	FString IdString;
+	FGameDataDocumentIdConvert::ConvertToString(Id, IdString);
+	if (!LazyDocuments->Contains(SchemaName, IdString))
+	{
+		// not a root document, only root documents which embed document with this id are created to find it
+		TArray<TPair<FString, FString>> Owners;
+		LazyDocuments->GetEmbeddedDocumentOwners(IdString, Owners);
+		for (const TPair<FString, FString>& Owner : Owners)
 		{
-			Documents.Add(Document);
+			FindGameDataDocumentById(Owner.Key, Owner.Value);
 		}
-		else
+
+		DocumentType* Document = Store.FindRef(Id);
+		if (Document == nullptr)
 		{
-			UE_LOG(LogUTestData, Error, TEXT("Failed to read document. Path: %s."), *CombineGameDataPath(GameDataPath));
-			return false;
+			UE_LOG(LogUTestData, Verbose, TEXT("Document '%s' of '%s' is not found among root and embedded documents."), *IdString, *SchemaName);
 		}
-
-		GameDataPath.Pop();
+		return Document;
 	}
-	if (IsByIdCollection)
+
+	TSharedPtr<IGameDataReader> DocumentReader = LazyDocuments->Take(SchemaName, IdString);
+	auto GameDataPath = TArray<FString>({ TEXT(""), TEXT("Collections"), SchemaName, IdString });
+	DocumentType* Document = nullptr;
+	const bool bReadSuccess = DocumentReader.IsValid() && FGameDataReaderDispatch::Visit(*DocumentReader, [&](auto& TypedReader)
 	{
-		Reader->ReadObjectEnd(NextToken);
-	}
-	else
+		return ReadDocument(TypedReader, Document, this, GameDataPath);
+	});
+	DocumentReader.Reset();
+
+	if (LazyDocuments->IsEmpty())
 	{
-		Reader->ReadArrayEnd(NextToken);
+		LazyDocuments.Reset();
 	}
 
-	if (Reader->IsError())
+	if (!bReadSuccess || Document == nullptr)
 	{
-		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
-		return false;
+		UE_LOG(LogUTestData, Error, TEXT("Failed to read document. Path: %s."), *CombineGameDataPath(GameDataPath));
+		return nullptr;
 	}
 
-	ToMapById(Collection, Documents);
+	Store.Add(Document, /* bIsRoot */ true);
+	auto FindingVisitor = UTestData::FFindingVisitor();
+	FindingVisitor.Visit(Document);
+	AddFoundDocuments(FindingVisitor);
 
-	return true;
+	RootDocuments = nullptr;
+	AllDocuments = nullptr;
+
+	return Document;
 }
+template <typename ReaderType>
 bool UTestData::ReadLocalizedText
 (
-	const TSharedRef<IGameDataReader>& Reader,
+	ReaderType& Reader,
 	FLocalizedText& LocalizedText,
 	TArray<FString>& GameDataPath,
 	bool NextToken
 )
 {
 	auto LocStringMap = TMap<FString, FText>();
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	const int32 StringPoolIndex = LocalizedStringPool.IsValid() ? LocalizedStringPool->AddText() : INDEX_NONE;
+	Reader.ReadObjectBegin();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		FString LanguageId = Reader->ReadMember();
+		FString LanguageId = Reader.ReadMember();
 		if (LanguageId == TEXT("notes")) {
-			Reader->SkipAny();
+			Reader.SkipAny();
+			continue;
+		}
+		if (LanguageFilter.Num() > 0 && !LanguageFilter.Contains(LanguageId))
+		{
+			Reader.SkipAny(); // text is not decoded for filtered out languages
+			continue;
+		}
+
+		if (StringPoolIndex != INDEX_NONE && Reader.GetNotation() == EJsonNotation::String)
+		{
+			// pooled text is kept as UTF-8 and FText is created only for displayed language
+			LocalizedStringPool->SetText(StringPoolIndex, LanguageId, Reader.GetValueAsStringView());
+			Reader.ReadNext();
 			continue;
 		}
 
 		FText Text;
 		GameDataPath.Add(LanguageId);
-		if (!Reader->ReadValue(Text))
+		if (!Reader.ReadValue(Text))
 		{
 			UE_LOG(LogUTestData, Error, TEXT("Failed to read localized text for language '%s'. Path: %s."), *LanguageId, *CombineGameDataPath(GameDataPath));
 			return false;
 		}
-		Reader->ReadNext();
+		Reader.ReadNext();
 		GameDataPath.Pop();
 
 		if (LanguageId.IsEmpty() || Text.IsEmpty())
@@ -2951,16 +4216,26 @@ bool UTestData::ReadLocalizedText
 		}
 		LocStringMap.Add(LanguageId, Text);
 	}
-	Reader->ReadObjectEnd(NextToken);
+	Reader.ReadObjectEnd(NextToken);
+
+	if (StringPoolIndex != INDEX_NONE)
+	{
+		for (const auto& TextByLanguageId : LocStringMap)
+		{
+			LocalizedStringPool->SetText(StringPoolIndex, TextByLanguageId.Key, TextByLanguageId.Value.ToString());
+		}
+		LocalizedText = FLocalizedText(LocalizedStringPool, StringPoolIndex, LanguageSwitcher);
+		return true;
+	}
 
 	LocalizedText = FLocalizedText(LocStringMap, LanguageSwitcher);
 	return true;
 }
 
-template <typename DocumentReferenceType>
+template <typename ReaderType, typename DocumentReferenceType>
 bool UTestData::ReadDocumentReferenceCollection
 (
-	const TSharedRef<IGameDataReader>& Reader,
+	ReaderType& Reader,
 	TArray<DocumentReferenceType>& Collection,
 	const FString& SchemaIdOrName,
 	TArray<FString>& GameDataPath,
@@ -2968,32 +4243,32 @@ bool UTestData::ReadDocumentReferenceCollection
 )
 {
 	Collection.Empty();
-	if (Reader->IsNull())
+	if (Reader.IsNull())
 	{
 		return true;
 	}
 
-	const bool IsByIdCollection = Reader->GetNotation() == EJsonNotation::ObjectStart;
+	const bool IsByIdCollection = Reader.GetNotation() == EJsonNotation::ObjectStart;
 
 	if (IsByIdCollection)
 	{
-		Reader->ReadObjectBegin();
+		Reader.ReadObjectBegin();
 	}
 	else
 	{
-		Reader->ReadArrayBegin();
+		Reader.ReadArrayBegin();
 	}
-	while (Reader->GetNotation() != EJsonNotation::ArrayEnd &&
-			Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	while (Reader.GetNotation() != EJsonNotation::ArrayEnd &&
+			Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
-		if (Reader->IsNull())
+		if (Reader.IsNull())
 		{
-			Reader->ReadNext();
+			Reader.ReadNext();
 			continue;
 		}
 
@@ -3007,25 +4282,26 @@ bool UTestData::ReadDocumentReferenceCollection
 	}
 	if (IsByIdCollection)
 	{
-		Reader->ReadObjectEnd(NextToken);
+		Reader.ReadObjectEnd(NextToken);
 	}
 	else
 	{
-		Reader->ReadArrayEnd(NextToken);
+		Reader.ReadArrayEnd(NextToken);
 	}
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
 	return true;
 }
 
+template <typename ReaderType>
 bool UTestData::ReadDocumentReference
 (
-	const TSharedRef<IGameDataReader>& Reader,
+	ReaderType& Reader,
 	FGameDataDocumentReference& DocumentReference,
 	const FString& SchemaIdOrName,
 	TArray<FString>& GameDataPath,
@@ -3033,32 +4309,32 @@ bool UTestData::ReadDocumentReference
 )
 {
 	FString Id;
-	Reader->ReadObjectBegin();
-	while (Reader->GetNotation() != EJsonNotation::ObjectEnd)
+	Reader.ReadObjectBegin();
+	while (Reader.GetNotation() != EJsonNotation::ObjectEnd)
 	{
-		if (Reader->IsError())
+		if (Reader.IsError())
 		{
-			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+			UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 			return false;
 		}
 
-		auto MemberName = Reader->ReadMember();
+		const FStringView MemberName = Reader.ReadMemberView();
 		if (MemberName == TEXT("Id"))
 		{
-			if (!Reader->ReadValue(Id))
+			if (!Reader.ReadValue(Id))
 			{
 				UE_LOG(LogUTestData, Error, TEXT("Failed to read 'Id' value for document reference. Path: %s."), *CombineGameDataPath(GameDataPath));
 				return false;
 			}
-			Reader->ReadNext();
+			Reader.ReadNext();
 		}
 		else
 		{
-			Reader->SkipAny();
+			Reader.SkipAny();
 		}
 	}
 
-	Reader->ReadObjectEnd(NextToken);
+	Reader.ReadObjectEnd(NextToken);
 
 	if (Id.IsEmpty())
 	{
@@ -3069,36 +4345,37 @@ bool UTestData::ReadDocumentReference
 	DocumentReference.Id = Id;
 	DocumentReference.SchemaIdOrName = SchemaIdOrName;
 	DocumentReference.GameData = this;
+	ReadReferenceCount++;
 
 	return true;
 }
 
-template <typename FormulaType>
+template <typename ReaderType, typename FormulaType>
 bool UTestData::ReadFormula
 (
-		const TSharedRef<IGameDataReader>& Reader,
+		ReaderType& Reader,
 		FormulaType*& Formula,
 		UObject* Outer,
 		TArray<FString>& GameDataPath,
 		bool NextToken
 )
 {
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
 	TSharedPtr<FJsonObject> FormulaObject;
-	if (!Reader->ReadObject(FormulaObject, NextToken) || FormulaObject == nullptr)
+	if (!Reader.ReadObject(FormulaObject, NextToken) || FormulaObject == nullptr)
 	{
 		UE_LOG(LogUTestData, Error, TEXT("Failed to read JsonObject for Formula data type. Path: %s."), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
-	if (Reader->IsError())
+	if (Reader.IsError())
 	{
-		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader->GetErrorMessage(), *CombineGameDataPath(GameDataPath));
+		UE_LOG(LogUTestData, Error, TEXT("File pasing failed due error '%s'. Path: %s."), *Reader.GetErrorMessage(), *CombineGameDataPath(GameDataPath));
 		return false;
 	}
 
@@ -3118,296 +4395,6 @@ FString UTestData::CombineGameDataPath(const TArray<FString>& GameDataPath)
 {
 	return FString::Join(GameDataPath, TEXT("/"));
 }
-TSharedPtr<FJsonObject> UTestData::MergeGameData(const TSharedPtr<FJsonObject>& GameDataDocument, const TSharedPtr<FJsonObject>& PatchDocument)
-{
-	const TSharedPtr<FJsonObject>* GameDataCollections;
-	if (!GameDataDocument->TryGetObjectField(TEXT("Collections"), GameDataCollections)) {
-		GameDataCollections = nullptr;
-	}
-
-	const TSharedPtr<FJsonObject>* PatchCollections;
-	if (!PatchDocument->TryGetObjectField(TEXT("Collections"), PatchCollections)) {
-		PatchCollections = nullptr;
-	}
-
-	auto MergedCollections = MakeShared<FJsonObject>();
-	if (GameDataCollections != nullptr && GameDataCollections->IsValid() &&
-		PatchCollections != nullptr && PatchCollections->IsValid())
-	{
-		auto& GameDataCollectionsMap = GameDataCollections->Get()->Values;
-		auto& PatchCollectionsMap = PatchCollections->Get()->Values;
-
-#if UE_VERSION_NEWER_THAN(5, 8, -1)
-		TSet<UE::FSharedString> VisitedSchemas;
-#else
-		TSet<FString> VisitedSchemas;
-#endif
-		auto SchemaNames = MergeKeys(GameDataCollectionsMap, PatchCollectionsMap);
-
-		for (auto SchemaName : SchemaNames.Get())
-		{
-			if (VisitedSchemas.Contains(SchemaName))
-			{
-				continue;
-			}
-			if (SchemaName == TEXT("55a4f32faca22e191098f3d9") || SchemaName == TEXT("ProjectSettings"))
-			{
-				VisitedSchemas.Add(TEXT("55a4f32faca22e191098f3d9"));
-				VisitedSchemas.Add(TEXT("ProjectSettings"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("55a4f32faca22e191098f3d9"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("ProjectSettings"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("55a4f32faca22e191098f3d9"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("ProjectSettings"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UTestDataProjectSettings>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("ProjectSettings"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("ProjectSettings"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("ProjectSettings"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("592fc86c983a36266c0912a0") || SchemaName == TEXT("TestEntity"))
-			{
-				VisitedSchemas.Add(TEXT("592fc86c983a36266c0912a0"));
-				VisitedSchemas.Add(TEXT("TestEntity"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("592fc86c983a36266c0912a0"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("TestEntity"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("592fc86c983a36266c0912a0"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("TestEntity"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UTestEntity>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("TestEntity"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("TestEntity"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("TestEntity"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("592fc894983a36266c0912a4") || SchemaName == TEXT("RecursiveEntity"))
-			{
-				VisitedSchemas.Add(TEXT("592fc894983a36266c0912a4"));
-				VisitedSchemas.Add(TEXT("RecursiveEntity"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("592fc894983a36266c0912a4"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("RecursiveEntity"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("592fc894983a36266c0912a4"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("RecursiveEntity"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<URecursiveEntity>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("RecursiveEntity"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("RecursiveEntity"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("RecursiveEntity"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("592fdb43983a3619c016b696") || SchemaName == TEXT("NumberTestEntity"))
-			{
-				VisitedSchemas.Add(TEXT("592fdb43983a3619c016b696"));
-				VisitedSchemas.Add(TEXT("NumberTestEntity"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("592fdb43983a3619c016b696"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("NumberTestEntity"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("592fdb43983a3619c016b696"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("NumberTestEntity"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UNumberTestEntity>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("NumberTestEntity"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("NumberTestEntity"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("NumberTestEntity"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("65d3565e27363a98010000ec") || SchemaName == TEXT("UniqueAttributeEntity"))
-			{
-				VisitedSchemas.Add(TEXT("65d3565e27363a98010000ec"));
-				VisitedSchemas.Add(TEXT("UniqueAttributeEntity"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("65d3565e27363a98010000ec"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("UniqueAttributeEntity"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("65d3565e27363a98010000ec"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("UniqueAttributeEntity"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UUniqueAttributeEntity>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("UniqueAttributeEntity"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("UniqueAttributeEntity"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("UniqueAttributeEntity"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("691255870642d17fc832c712") || SchemaName == TEXT("UnionType"))
-			{
-				VisitedSchemas.Add(TEXT("691255870642d17fc832c712"));
-				VisitedSchemas.Add(TEXT("UnionType"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("691255870642d17fc832c712"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("UnionType"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("691255870642d17fc832c712"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("UnionType"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UUnionType>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("UnionType"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("UnionType"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("UnionType"), *PatchDocumentCollection);
-				}
-			}
-			else
-			if (SchemaName == TEXT("697fa0a4ecd20b7208b73d2d") || SchemaName == TEXT("AllTypesTest"))
-			{
-				VisitedSchemas.Add(TEXT("697fa0a4ecd20b7208b73d2d"));
-				VisitedSchemas.Add(TEXT("AllTypesTest"));
-
-				auto GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("697fa0a4ecd20b7208b73d2d"));
-				if (GameDataDocumentCollection == nullptr)
-				{
-					GameDataDocumentCollection = GameDataCollectionsMap.Find(TEXT("AllTypesTest"));
-				}
-				auto PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("697fa0a4ecd20b7208b73d2d"));
-				if (PatchDocumentCollection == nullptr)
-				{
-					PatchDocumentCollection = PatchCollectionsMap.Find(TEXT("AllTypesTest"));
-				}
-
-				if (GameDataDocumentCollection != nullptr && PatchDocumentCollection != nullptr)
-				{
-					auto MergedCollection = MergeDocumentCollection<UAllTypesTest>(GameDataDocumentCollection->ToSharedRef(), PatchDocumentCollection->ToSharedRef(), false);
-					MergedCollections->SetField(TEXT("AllTypesTest"), MergedCollection);
-				}
-				else if (GameDataDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("AllTypesTest"), *GameDataDocumentCollection);
-				}
-				else if (PatchDocumentCollection != nullptr)
-				{
-					MergedCollections->SetField(TEXT("AllTypesTest"), *PatchDocumentCollection);
-				}
-			}
-			else
-			{
-				/* ignore schema */
-			}
-		}
-	}
-	else if (GameDataCollections != nullptr && GameDataCollections->IsValid())
-	{
-		MergedCollections = GameDataCollections->ToSharedRef();
-	}
-	else if (PatchCollections != nullptr && PatchCollections->IsValid())
-	{
-		MergedCollections = PatchCollections->ToSharedRef();
-	}
-
-	int MergedChangeNumber;
-	if (GameDataDocument->HasTypedField<EJson::Number>(TEXT("ChangeNumber")))
-	{
-		GameDataDocument->GetField<EJson::Number>(TEXT("ChangeNumber"))->TryGetNumber(MergedChangeNumber);
-	}
-	if (PatchDocument->HasTypedField<EJson::Number>(TEXT("ChangeNumber")))
-	{
-		PatchDocument->GetField<EJson::Number>(TEXT("ChangeNumber"))->TryGetNumber(MergedChangeNumber);
-	}
-
-	FString MergedRevisionHash;
-	if (GameDataDocument->HasTypedField<EJson::String>(TEXT("RevisionHash")))
-	{
-		GameDataDocument->GetField<EJson::String>(TEXT("RevisionHash"))->TryGetString(MergedRevisionHash);
-	}
-	if (PatchDocument->HasTypedField<EJson::String>(TEXT("RevisionHash")))
-	{
-		PatchDocument->GetField<EJson::String>(TEXT("RevisionHash"))->TryGetString(MergedRevisionHash);
-	}
-
-	auto MergedGameData = MakeShared<FJsonObject>();
-	MergedGameData->SetField(TEXT("ChangeNumber"), MakeShared<FJsonValueNumber>(MergedChangeNumber));
-	MergedGameData->SetField(TEXT("RevisionHash"), MakeShared<FJsonValueString>(MergedRevisionHash));
-	MergedGameData->SetField(TEXT("Collections"), MakeShared<FJsonValueObject>(MergedCollections));
-	return MergedGameData;
-}
-
 struct UTestData_ToIdMapper
 {
 	static TSharedPtr<FJsonObject> ToDocumentById(TSharedRef<FJsonValue> Collection)
@@ -3512,6 +4499,36 @@ TSharedPtr<FJsonValue> UTestData::MergeDocumentCollection(TSharedRef<FJsonValue>
 	return MakeShared<FJsonValueObject>(MergedCollectionById);
 }
 
+template <typename DocumentType>
+TSharedPtr<FJsonValue> UTestData::ApplyDocumentPatches(TSharedPtr<FJsonValue> Document, const TArray<TSharedPtr<FJsonValue>>& DocumentPatches)
+{
+	// same rules as MergeDocumentCollection, applied once per patch
+	for (const TSharedPtr<FJsonValue>& DocumentPatch : DocumentPatches)
+	{
+		if (!Document.IsValid())
+		{
+			// added
+			Document = DocumentPatch;
+		}
+		else if (Document->IsNull())
+		{
+			// keep deleted documents as deleted
+			break;
+		}
+		else if (Document->Type == EJson::Object && DocumentPatch->Type == EJson::Object)
+		{
+			// merged
+			Document = MergeDocument<DocumentType>(Document.ToSharedRef(), DocumentPatch.ToSharedRef());
+		}
+		else
+		{
+			// modified
+			Document = DocumentPatch;
+		}
+	}
+	return Document;
+}
+
 template <typename DocumentType>
 TSharedPtr<FJsonValue> UTestData::MergeDocument(TSharedRef<FJsonValue> OriginalDocument, TSharedRef<FJsonValue> ModifiedDocument)
 {
@@ -3894,25 +4911,87 @@ void UTestData::ApplyVisitor(FVisitor& Visitor) const
 	}
 }
 
-void UTestData::ResolveAllReferences()
+int32 UTestData::ResolveAllReferences(const bool bBuildReferrersIndex)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UTestData_ResolveAllReferences, CharonChannel);
+
+	ReferrersIndex.Reset();
+
 	auto DereferencingVisitor = UTestData::FDereferencingVisitor();
+	DereferencingVisitor.ReferrersIndex = bBuildReferrersIndex ? &ReferrersIndex : nullptr;
 	ApplyVisitor(DereferencingVisitor);
+
+	if (bBuildReferrersIndex)
+	{
+		ReferrersIndex.Finalize();
+	}
+	return DereferencingVisitor.UnresolvedReferenceCount;
+}
+
+void UTestData::FDereferencingVisitor::ResolveReference(UGameDataDocument& Document, const FName& PropertyName, const FGameDataDocumentReference& Reference)
+{
+	if (!Reference.IsValid())
+	{
+		return;
+	}
+
+	UGameDataDocument* ReferencedDocument = Reference.GetReferencedDocument();
+	if (ReferencedDocument == nullptr)
+	{
+		UnresolvedReferenceCount++;
+		UE_LOG(LogUTestData, Warning, TEXT("Referenced document '%s' of '%s' is not found."), *Reference.Id, *Reference.SchemaIdOrName);
+		return;
+	}
+
+	if (ReferrersIndex != nullptr)
+	{
+		ReferrersIndex->Add(ReferencedDocument, &Document, PropertyName);
+	}
 }
 
 void UTestData::FindAllDocuments()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(UTestData_FindAllDocuments, CharonChannel);
+
 	auto FindingVisitor = UTestData::FFindingVisitor();
 	ApplyVisitor(FindingVisitor);
 
+	AddFoundDocuments(FindingVisitor);
+}
+
+void UTestData::AddFoundDocuments(FFindingVisitor& FindingVisitor)
+{
+	this->TestDataProjectSettingsStore.Append(FindingVisitor.ProjectSettings, /* bIsRoot */ false);
+	this->TestEntityStore.Append(FindingVisitor.TestEntity, /* bIsRoot */ false);
+	this->RecursiveEntityStore.Append(FindingVisitor.RecursiveEntity, /* bIsRoot */ false);
+	this->NumberTestEntityStore.Append(FindingVisitor.NumberTestEntity, /* bIsRoot */ false);
+	this->UniqueAttributeEntityStore.Append(FindingVisitor.UniqueAttributeEntity, /* bIsRoot */ false);
+	this->UnionTypeStore.Append(FindingVisitor.UnionType, /* bIsRoot */ false);
+	this->AllTypesTestStore.Append(FindingVisitor.AllTypesTest, /* bIsRoot */ false);
+}
+
+void UTestData::LoadAllDocuments()
+{
+	if (!LazyDocuments.IsValid())
+	{
+		return;
+	}
 
-	ToMapById(this->AllProjectSettingsList, FindingVisitor.ProjectSettings);
-	ToMapById(this->AllTestEntities, FindingVisitor.TestEntity);
-	ToMapById(this->AllRecursiveEntities, FindingVisitor.RecursiveEntity);
-	ToMapById(this->AllNumberTestEntities, FindingVisitor.NumberTestEntity);
-	ToMapById(this->AllUniqueAttributeEntities, FindingVisitor.UniqueAttributeEntity);
-	ToMapById(this->AllUnionTypes, FindingVisitor.UnionType);
-	ToMapById(this->AllAllTypesTests, FindingVisitor.AllTypesTest);
+	TArray<FString> SchemaNames;
+	LazyDocuments->GetSchemaNames(SchemaNames);
+	for (const FString& SchemaName : SchemaNames)
+	{
+		TArray<FString> DocumentIds;
+		if (LazyDocuments.IsValid())
+		{
+			LazyDocuments->GetDocumentIds(SchemaName, DocumentIds);
+		}
+		for (const FString& DocumentId : DocumentIds)
+		{
+			FindGameDataDocumentById(SchemaName, DocumentId);
+		}
+	}
+	LazyDocuments.Reset();
 }
 
 void UTestData::FVisitor::Visit(UGameDataDocument* Document)
@@ -4075,10 +5154,13 @@ void UTestData::FDereferencingVisitor::Visit(UTestDataProjectSettings& Document)
 }
 void UTestData::FDereferencingVisitor::Visit(UTestEntity& Document)
 {
-	if (Document.ReferenceFieldRaw.IsValid())
-	{ auto _ = Document.ReferenceFieldRaw.GetReferencedDocument(); }
-	for (auto Reference : Document.ListOfReferencesFieldRaw)
-	{ auto _ = Reference.IsValid() ? Reference.GetReferencedDocument() : nullptr; }
+	static const FName ReferenceFieldPropertyName(TEXT("ReferenceField"));
+	static const FName ListOfReferencesFieldPropertyName(TEXT("ListOfReferencesField"));
+	ResolveReference(Document, ReferenceFieldPropertyName, Document.ReferenceFieldRaw);
+	for (const auto& Reference : Document.ListOfReferencesFieldRaw)
+	{
+		ResolveReference(Document, ListOfReferencesFieldPropertyName, Reference);
+	}
 	FVisitor::Visit(Document);
 }
 void UTestData::FDereferencingVisitor::Visit(URecursiveEntity& Document)
@@ -4095,10 +5177,13 @@ void UTestData::FDereferencingVisitor::Visit(UUniqueAttributeEntity& Document)
 }
 void UTestData::FDereferencingVisitor::Visit(UUnionType& Document)
 {
-	if (Document.Reference12Raw.IsValid())
-	{ auto _ = Document.Reference12Raw.GetReferencedDocument(); }
-	for (auto Reference : Document.CollectionofReferences13Raw)
-	{ auto _ = Reference.IsValid() ? Reference.GetReferencedDocument() : nullptr; }
+	static const FName Reference12PropertyName(TEXT("Reference12"));
+	static const FName CollectionofReferences13PropertyName(TEXT("CollectionofReferences13"));
+	ResolveReference(Document, Reference12PropertyName, Document.Reference12Raw);
+	for (const auto& Reference : Document.CollectionofReferences13Raw)
+	{
+		ResolveReference(Document, CollectionofReferences13PropertyName, Reference);
+	}
 	FVisitor::Visit(Document);
 }
 void UTestData::FDereferencingVisitor::Visit(UAllTypesTest& Document)
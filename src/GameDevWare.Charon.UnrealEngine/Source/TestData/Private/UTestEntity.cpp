@@ -28,6 +28,8 @@ UTestEntity* UTestEntity::GetReferenceField() const {
 	return _ReferenceFieldDocument;
 }
 TMap<FString,UTestEntity*> UTestEntity::GetListOfReferencesField() const {
-	FGameDataDocumentReference::GetReferencedDocuments(ListOfReferencesFieldRaw, _ListOfReferencesFieldDocuments);
-	return _ListOfReferencesFieldDocuments;
+	return GetListOfReferencesFieldView();
+}
+const TMap<FString,UTestEntity*>& UTestEntity::GetListOfReferencesFieldView() const {
+	return FGameDataDocumentReference::GetReferencedDocumentsCached(ListOfReferencesFieldRaw, _ListOfReferencesFieldDocuments, _ListOfReferencesFieldDocumentsLoadGeneration);
 }
@@ -26,8 +26,10 @@ UNumberTestEntity* UUnionType::GetReference12() const {
 	return _Reference12Document;
 }
 TMap<int32,UNumberTestEntity*> UUnionType::GetCollectionofReferences13() const {
-	FGameDataDocumentReference::GetReferencedDocuments(CollectionofReferences13Raw, _CollectionofReferences13Documents);
-	return _CollectionofReferences13Documents;
+	return GetCollectionofReferences13View();
+}
+const TMap<int32,UNumberTestEntity*>& UUnionType::GetCollectionofReferences13View() const {
+	return FGameDataDocumentReference::GetReferencedDocumentsCached(CollectionofReferences13Raw, _CollectionofReferences13Documents, _CollectionofReferences13DocumentsLoadGeneration);
 }
 void UUnionType::Apply(FUnionVisitor& visitor)
 {
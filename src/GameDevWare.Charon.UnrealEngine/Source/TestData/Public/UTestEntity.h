@@ -50,6 +50,7 @@ public:
 	  */
 	UPROPERTY()
 	mutable TMap<FString,UTestEntity*> _ListOfReferencesFieldDocuments;
+	mutable uint32 _ListOfReferencesFieldDocumentsLoadGeneration = 0;
 public:
 	/**
 	  * Id property of Text type. Not Empty, Unique.
@@ -141,6 +142,18 @@ public:
 	  */
 	UFUNCTION(BlueprintCallable)
 	TMap<FString,UTestEntity*> GetListOfReferencesField() const;
+	/**
+	  * Same as GetListOfReferencesField() without copying collection. Collection is built once per load of game data.
+	  */
+	const TMap<FString,UTestEntity*>& GetListOfReferencesFieldView() const;
+	/**
+	  * Call Func with each document of ListOfReferencesField without building collection.
+	  */
+	template <typename FuncType>
+	void ForEachListOfReferencesField(FuncType&& Func) const
+	{
+		FGameDataDocumentReference::ForEachReferencedDocument<UTestEntity>(ListOfReferencesFieldRaw, Forward<FuncType>(Func));
+	}
 	/**
 	  * Raw value of ListOfReferencesField.
 	  */
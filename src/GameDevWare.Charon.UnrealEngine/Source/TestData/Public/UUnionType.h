@@ -48,6 +48,7 @@ public:
 	  */
 	UPROPERTY()
 	mutable TMap<int32,UNumberTestEntity*> _CollectionofReferences13Documents;
+	mutable uint32 _CollectionofReferences13DocumentsLoadGeneration = 0;
 public:
 	/**
 	  * Id property of Integer type. Not Null, Unique.
@@ -129,6 +130,18 @@ public:
 	  */
 	UFUNCTION(BlueprintCallable)
 	TMap<int32,UNumberTestEntity*> GetCollectionofReferences13() const;
+	/**
+	  * Same as GetCollectionofReferences13() without copying collection. Collection is built once per load of game data.
+	  */
+	const TMap<int32,UNumberTestEntity*>& GetCollectionofReferences13View() const;
+	/**
+	  * Call Func with each document of CollectionofReferences13 without building collection.
+	  */
+	template <typename FuncType>
+	void ForEachCollectionofReferences13(FuncType&& Func) const
+	{
+		FGameDataDocumentReference::ForEachReferencedDocument<UNumberTestEntity>(CollectionofReferences13Raw, Forward<FuncType>(Func));
+	}
 	/**
 	  * Raw value of CollectionofReferences13.
 	  */